@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/architecture/driver/atomic/queue.hpp>
+
+// Compares moving bytes through a UART-sized modm::atomic::Queue one element
+// at a time with the bulk and claim/commit interfaces.
+
+constexpr uint32_t Iterations = 100'000'000;
+constexpr std::size_t BurstSize = 32;
+
+modm::atomic::Queue<uint8_t, 255> queue;
+uint8_t input[BurstSize];
+uint8_t output[BurstSize];
+volatile uint32_t checksum;
+
+template< class Function >
+void
+measure(const char* name, Function&& function)
+{
+	const auto start = std::chrono::steady_clock::now();
+	uint32_t sum = 0;
+	for (uint32_t ii = 0; ii < Iterations; ii += BurstSize) {
+		sum += function();
+	}
+	checksum = sum;
+	const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-16s %8.2f MB/s\n", name, Iterations / duration.count() / 1e6);
+}
+
+int
+main()
+{
+	for (std::size_t ii = 0; ii < BurstSize; ++ii) input[ii] = ii;
+
+	MODM_LOG_INFO << "Moving " << Iterations << " bytes in bursts of "
+				  << BurstSize << " bytes:" << modm::endl;
+
+	measure("per element", []
+	{
+		for (uint8_t value : input) queue.push(value);
+		for (uint8_t& value : output) {
+			value = queue.get();
+			queue.pop();
+		}
+		return output[BurstSize - 1];
+	});
+
+	measure("bulk", []
+	{
+		queue.push(input, BurstSize);
+		queue.pop(output, BurstSize);
+		return output[BurstSize - 1];
+	});
+
+	measure("claim/commit", []
+	{
+		uint8_t* write;
+		// emulates a DMA filling the buffer directly
+		const std::size_t size = std::min<std::size_t>(queue.claimWrite(write), BurstSize);
+		for (std::size_t ii = 0; ii < size; ++ii) write[ii] = ii;
+		queue.commitWrite(size);
+
+		const uint8_t* read;
+		uint32_t sum = 0;
+		const std::size_t available = queue.claimRead(read);
+		for (std::size_t ii = 0; ii < available; ++ii) sum += read[ii];
+		queue.commitRead(available);
+		return sum;
+	});
+
+	return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/driver/storage/block_allocator.hpp>
+
+// Replays synthetic allocation traces on a 32kB block heap as used on
+// Cortex-M devices and reports the latency percentiles of the heap
+// operations, as well as the allocations that failed even though enough
+// memory was free in total, which is caused by fragmentation.
+
+constexpr std::size_t HeapSize = 32 * 1024;
+constexpr std::size_t MaxSlots = 256;
+constexpr uint32_t Steps = 200'000;
+
+alignas(8) static uint8_t heap[HeapSize];
+
+struct Allocation
+{
+	void *ptr;
+	std::size_t size;
+};
+
+/// Linear congruential generator, so that every run replays the same trace
+class Random
+{
+public:
+	uint32_t
+	operator() (uint32_t range)
+	{
+		state = state * 1664525 + 1013904223;
+		return (state >> 8) % range;
+	}
+
+private:
+	uint32_t state = 42;
+};
+
+/// @return size of the next request, or 0 to free the slot instead
+using Trace = std::size_t (*)(Random&, const Allocation&);
+
+// Packet buffers of a communication stack: mostly small and short lived
+static std::size_t
+messages(Random& random, const Allocation& slot)
+{
+	if (slot.ptr) return 0;
+	return (random(16) == 0) ? 64 + random(192) : 8 + random(56);
+}
+
+// Containers that grow by doubling their capacity and are eventually freed
+static std::size_t
+vectors(Random& random, const Allocation& slot)
+{
+	if (slot.ptr == nullptr) return 4 + random(12);
+	if (slot.size >= 512 or random(8) == 0) return 0;
+	return slot.size * 2;
+}
+
+// Random sizes and lifetimes, some allocations are resized
+static std::size_t
+mixed(Random& random, const Allocation& slot)
+{
+	if (slot.ptr and random(2)) return 0;
+	return 1 + random((random(4) == 0) ? 1024 : 128);
+}
+
+/// @param	count	number of concurrent allocations, so that the heap is
+/// 				filled to about two thirds on average
+void
+replay(const char *name, Trace trace, std::size_t count)
+{
+	// no page faults during the measurement
+	std::memset(heap, 0, HeapSize);
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + HeapSize);
+
+	Allocation slots[MaxSlots] = {};
+	Random random;
+
+	uint32_t failed = 0, fragmented = 0;
+	std::vector<uint32_t> latencies;
+	latencies.reserve(Steps);
+	for (uint32_t step = 0; step < Steps; ++step)
+	{
+		Allocation &slot = slots[random(count)];
+		const std::size_t size = trace(random, slot);
+
+		const auto start = std::chrono::steady_clock::now();
+		void *ptr = nullptr;
+		if (size) {
+			ptr = allocator.reallocate(slot.ptr, size);
+		} else {
+			allocator.free(slot.ptr);
+		}
+		latencies.push_back(std::chrono::nanoseconds(std::chrono::steady_clock::now() - start).count());
+
+		if (size == 0) {
+			slot = {nullptr, 0};
+		}
+		else if (ptr) {
+			std::memset(ptr, 0, size);
+			slot = {ptr, size};
+		}
+		else {
+			failed++;
+			if (allocator.getAvailableSize() >= size + 4) fragmented++;
+		}
+	}
+
+	// the clock itself adds a constant offset to every operation
+	std::sort(latencies.begin(), latencies.end());
+	const auto percentile = [&](double p) { return (unsigned long) latencies[latencies.size() * p]; };
+	MODM_LOG_INFO.printf("%-8s median %4lu ns, 99%% %4lu ns, 99.9%% %5lu ns, %5lu failed, %5lu of them fragmented\n",
+						 name, percentile(0.5), percentile(0.99), percentile(0.999),
+						 (unsigned long) failed, (unsigned long) fragmented);
+}
+
+int
+main()
+{
+	replay("messages", messages, 256);
+	replay("vectors", vectors, 96);
+	replay("mixed", mixed, 128);
+	return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/math/utils/crc.hpp>
+
+// Measures the throughput of the CRC computations over a 4kB block, the
+// bitwise crc32() compared to the lookup tables with 1 to 8 slices. Compile
+// with `-msse4.2` to use the CRC32 instruction for CRC-32C.
+
+using namespace modm::math;
+
+constexpr uint32_t Size = 4096;
+constexpr uint32_t Iterations = 10'000;
+static uint8_t data[Size];
+
+template< typename Function >
+static void
+benchmark(const char* name, Function&& function)
+{
+	uint32_t result{0};
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ii++) {
+		data[0] = ii;
+		result += function(data, Size);
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+
+	const double seconds = std::chrono::duration<double>(time).count();
+	MODM_LOG_INFO.printf("%-24s %8.1f MB/s (%08lx)\n", name,
+						 double(Size) * Iterations / seconds / 1e6, (unsigned long) result);
+}
+
+int
+main()
+{
+	for (uint32_t ii = 0; ii < Size; ii++) {
+		data[ii] = ii * 251 + (ii >> 8);
+	}
+
+	benchmark("crc32() bitwise", crc32);
+	benchmark("CRC-32 1 slice", Crc<uint32_t, 0x04C11DB7, ~0u, ~0u, true, 32, 1>::compute);
+	benchmark("CRC-32 4 slices", Crc<uint32_t, 0x04C11DB7, ~0u, ~0u, true, 32, 4>::compute);
+	benchmark("CRC-32 8 slices", Crc<uint32_t, 0x04C11DB7, ~0u, ~0u, true, 32, 8>::compute);
+	benchmark("CRC-32/BZIP2 8 slices", Crc<uint32_t, 0x04C11DB7, ~0u, ~0u, false, 32, 8>::compute);
+	benchmark("CRC-32C", Crc32c::compute);
+	benchmark("crc16_ccitt()", crc16_ccitt);
+	benchmark("CRC-16/MCRF4XX 4 slices", Crc<uint16_t, 0x1021, 0xFFFF, 0, true, 16, 4>::compute);
+	benchmark("crc8_ccitt()", crc8_ccitt);
+	benchmark("CRC-64/XZ 8 slices", Crc<uint64_t, 0x42F0E1EBA9EA3693, ~0ull, ~0ull, true, 64, 8>::compute);
+
+	return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdlib>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/math/filter/fir.hpp>
+
+// Measures the throughput of modm::filter::Fir in samples per second for
+// different tap counts, filtering one sample at a time with append() and
+// update() compared to filtering blocks with process().
+
+constexpr std::size_t Block = 64;
+constexpr std::size_t Samples = 1 << 20;
+
+template< typename T, int N, int ScaleFactor >
+void
+measure(const char *name)
+{
+	float coefficients[N];
+	for (int ii = 0; ii < N; ++ii) {
+		coefficients[ii] = 0.9f / N;
+	}
+	static T input[Block];
+	static T output[Block];
+	for (T &sample : input) {
+		sample = T(std::rand() % 2000 - 1000);
+	}
+
+	modm::filter::Fir<T, N, N, ScaleFactor> single(coefficients);
+	auto start = std::chrono::steady_clock::now();
+	for (std::size_t ii = 0; ii < Samples; ++ii)
+	{
+		single.append(input[ii % Block]);
+		single.update();
+		output[ii % Block] = single.getValue();
+	}
+	const std::chrono::duration<double> singleDuration = std::chrono::steady_clock::now() - start;
+
+	modm::filter::Fir<T, N, N, ScaleFactor> block(coefficients);
+	start = std::chrono::steady_clock::now();
+	for (std::size_t ii = 0; ii < Samples; ii += Block) {
+		block.process(input, output, Block);
+	}
+	const std::chrono::duration<double> blockDuration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-6s %3d taps: %7.2f Msamples/s single, %7.2f Msamples/s block (%d)\n",
+						 name, N, Samples / singleDuration.count() / 1e6,
+						 Samples / blockDuration.count() / 1e6, int(output[Block - 1]));
+}
+
+template< int N >
+void
+measureTaps()
+{
+	measure<float, N, 1>("float");
+	measure<int16_t, N, 32768>("q15");
+	measure<int32_t, N, 0x7fffffff>("q31");
+}
+
+int
+main()
+{
+	measureTaps<8>();
+	measureTaps<32>();
+	measureTaps<128>();
+	return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdlib>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+
+// Draws into the framebuffer of a 128x64 pixel display, like the SSD1306,
+// without sending it anywhere. The per pixel display only implements
+// setPixelFast() and clearPixelFast() on the same buffer layout, so it uses
+// the default implementation drawing everything pixel by pixel. The buffered
+// display fills and copies whole bytes instead.
+
+constexpr uint16_t Width = 128;
+constexpr uint16_t Height = 64;
+constexpr uint32_t Iterations = 20'000;
+
+using modm::glcd::Point;
+
+class PixelDisplay : public modm::GraphicDisplay<Width, Height>
+{
+public:
+	std::size_t getBufferWidth() const final { return Width; }
+	std::size_t getBufferHeight() const final { return Height / 8; }
+	void clear() final { std::fill(&buffer[0][0], &buffer[0][0] + sizeof(buffer), 0); }
+	void update() final {}
+
+protected:
+	void setPixelFast(Point pos) final { buffer[pos.y / 8][pos.x] |= (1 << pos.y % 8); }
+	void clearPixelFast(Point pos) final { buffer[pos.y / 8][pos.x] &= ~(1 << pos.y % 8); }
+	void setClipping(Point, Point) final {}
+
+	uint8_t buffer[Height / 8][Width];
+};
+
+class BufferedDisplay : public modm::MonochromeGraphicDisplayVertical<Width, Height>
+{
+public:
+	void update() final {}
+
+protected:
+	void setClipping(Point, Point) final {}
+};
+
+static PixelDisplay pixelDisplay;
+static BufferedDisplay bufferedDisplay;
+
+// 16x16 pixels
+static const uint8_t image[] = {
+	0xe0, 0x18, 0x04, 0x02, 0x02, 0x01, 0x31, 0x31, 0x01, 0x31, 0x31, 0x01, 0x02, 0x02, 0x04, 0x18,
+	0x07, 0x18, 0x20, 0x40, 0x44, 0x88, 0x90, 0x90, 0x90, 0x90, 0x88, 0x44, 0x40, 0x20, 0x18, 0x07,
+};
+
+struct Shape
+{
+	Point start;
+	Point end;
+};
+static Shape shapes[256];
+
+// draws the same shapes on a display and returns the drawn pixels per second
+template< class Display, typename Function >
+static double
+measure(Display& display, uint32_t pixels, Function&& function)
+{
+	display.clear();
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ii++) {
+		function(display, shapes[ii % std::size(shapes)]);
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+	return pixels * (double(Iterations) / std::size(shapes)) / std::chrono::duration<double>(time).count();
+}
+
+template< typename Function >
+static void
+benchmark(const char* name, uint32_t pixels, Function&& function)
+{
+	const double before = measure(pixelDisplay, pixels, function);
+	const double after = measure(bufferedDisplay, pixels, function);
+	MODM_LOG_INFO.printf("%-20s %8.1f Mpixel/s per pixel %8.1f Mpixel/s buffered (%5.1fx)\n",
+						 name, before / 1e6, after / 1e6, after / before);
+}
+
+int
+main()
+{
+	std::srand(42);
+	for (Shape& shape : shapes)
+	{
+		// partially outside of the screen
+		shape.start = {int16_t(std::rand() % (Width + 16) - 8), int16_t(std::rand() % (Height + 16) - 8)};
+		shape.end = {int16_t(std::rand() % (Width + 16) - 8), int16_t(std::rand() % (Height + 16) - 8)};
+	}
+
+	// the number of pixels drawn for all shapes, including the clipped part of lines
+	uint32_t rectangles{0}, lines{0}, images{0}, characters{0};
+	for (const Shape& shape : shapes)
+	{
+		const auto visible = [](int16_t begin, int16_t length, int16_t size) {
+			return std::max(0, std::min<int>(begin + length, size) - std::max<int>(begin, 0));
+		};
+		const int16_t width = std::abs(shape.end.x - shape.start.x);
+		const int16_t height = std::abs(shape.end.y - shape.start.y);
+		const Point corner{std::min(shape.start.x, shape.end.x), std::min(shape.start.y, shape.end.y)};
+		rectangles += visible(corner.x, width, Width) * visible(corner.y, height, Height);
+		lines += std::max(width, height) + 1;
+		images += visible(shape.start.x, 16, Width) * visible(shape.start.y, 16, Height);
+		characters += visible(shape.start.x, 4 * 6, Width) * visible(shape.start.y, 8, Height);
+	}
+
+	benchmark("fillRectangle", rectangles, [](auto& display, const Shape& shape)
+	{
+		display.fillRectangle({std::min(shape.start.x, shape.end.x), std::min(shape.start.y, shape.end.y)},
+							  std::abs(shape.end.x - shape.start.x), std::abs(shape.end.y - shape.start.y));
+	});
+	benchmark("drawLine", lines, [](auto& display, const Shape& shape)
+	{
+		display.drawLine(shape.start, shape.end);
+	});
+	benchmark("drawImage", images, [](auto& display, const Shape& shape)
+	{
+		display.drawImageRaw(shape.start, 16, 16, modm::accessor::asFlash(image));
+	});
+	benchmark("text", characters, [](auto& display, const Shape& shape)
+	{
+		display.setCursor(shape.start);
+		display << "modm";
+	});
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/math/interpolation.hpp>
+
+// Measures the lookup cost of modm::interpolation::Linear with linear and
+// binary search and of modm::interpolation::UniformLinear versus table size.
+
+using Point = modm::Pair<int16_t, int16_t>;
+constexpr int16_t Step = 4;
+constexpr uint32_t Iterations = 1'000'000;
+
+static volatile int32_t sink;
+
+template< class Interpolation >
+void
+measure(const char *name, const Interpolation &interpolation,
+		const std::vector<int16_t> &inputs, uint16_t size)
+{
+	int32_t sum = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ++ii) {
+		sum += interpolation.interpolate(inputs[ii % inputs.size()]);
+	}
+	const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+	sink = sum;
+
+	MODM_LOG_INFO.printf("%-8s %4u points: %6.2f ns/lookup\n",
+						 name, size, duration.count() / Iterations);
+}
+
+int
+main()
+{
+	for (uint16_t size : {8, 16, 64, 256, 1024})
+	{
+		std::vector<Point> points;
+		std::vector<int16_t> values;
+		for (uint16_t ii = 0; ii < size; ++ii)
+		{
+			// a monotonic calibration curve
+			const int16_t value = (ii * ii) / 64 + ii;
+			points.emplace_back(ii * Step, value);
+			values.push_back(value);
+		}
+
+		std::vector<int16_t> inputs(4096);
+		for (int16_t &input : inputs) {
+			input = std::rand() % (size * Step);
+		}
+
+		using namespace modm::interpolation;
+		const Linear<Point> linear(points.data(), size);
+		const Linear<Point, modm::accessor::Ram, Search::Binary> binary(points.data(), size);
+		const UniformLinear<int16_t, int16_t, 0, Step> uniform(values.data(), size);
+
+		measure("linear", linear, inputs, size);
+		measure("binary", binary, inputs, size);
+		measure("uniform", uniform, inputs, size);
+	}
+	return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/io/iostream_format.hpp>
+
+// Compares modm::IOStream::printf(), which parses the format string on every
+// call, with modm::format, which parses it when compiling. The output goes to
+// a device discarding all characters, so only the formatting is measured.
+
+constexpr uint32_t Iterations = 1'000'000;
+
+class NullDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+
+	void
+	write(char) override
+	{ count++; }
+
+	void
+	write(const char*, std::size_t length) override
+	{ count += length; }
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	std::size_t count = 0;
+};
+
+static NullDevice device;
+static modm::IOStream stream(device);
+
+template< typename Function >
+static void
+benchmark(const char* name, Function&& function)
+{
+	device.count = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ii++) {
+		function(ii);
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+
+	const double ns = std::chrono::duration<double, std::nano>(time).count() / Iterations;
+	MODM_LOG_INFO.printf("%-24s %8.1f ns per call %6.1f characters\n",
+						 name, ns, double(device.count) / Iterations);
+}
+
+int
+main()
+{
+	benchmark("printf text", [](uint32_t)
+	{
+		stream.printf("The quick brown fox jumps over the lazy dog\n");
+	});
+	benchmark("format text", [](uint32_t)
+	{
+		stream << modm::format<"The quick brown fox jumps over the lazy dog\n">();
+	});
+
+	benchmark("printf integers", [](uint32_t ii)
+	{
+		stream.printf("id=%lu value=%ld mask=%08lx\n", (unsigned long) ii, -long(ii), (unsigned long) ii * 7);
+	});
+	benchmark("format integers", [](uint32_t ii)
+	{
+		stream << modm::format<"id={} value={} mask={:08x}\n">(ii, -int32_t(ii), ii * 7);
+	});
+
+	benchmark("printf mixed", [](uint32_t ii)
+	{
+		stream.printf("i=%lu y=%.3f state=%s\n", (unsigned long) ii, double(ii * 0.001f), "running");
+	});
+	benchmark("format mixed", [](uint32_t ii)
+	{
+		stream << modm::format<"i={} y={:.3f} state={}\n">(ii, ii * 0.001f, "running");
+	});
+
+	return 0;
+}
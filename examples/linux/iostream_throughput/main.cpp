@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <mutex>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+// Measures the throughput of formatted output through modm::IOStream into
+// two devices, which copy the characters into a ring buffer guarded by a
+// lock, like the transmit buffer of a UART guarded by disabling interrupts:
+// - char: only implements write(char), so every character is one virtual
+//   call and one lock, like devices without a bulk write.
+// - block: also implements write(const char*, std::size_t), so every
+//   formatted value costs one virtual call and one lock.
+
+constexpr uint32_t Iterations = 1'000'000;
+
+class RingDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+
+	void
+	write(char c) override
+	{
+		std::lock_guard lock(mutex);
+		push(c);
+	}
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	std::size_t index = 0;
+
+protected:
+	void
+	push(char c)
+	{ buffer[index++ % sizeof(buffer)] = c; }
+
+	std::mutex mutex;
+	char buffer[1024];
+};
+
+class BlockRingDevice : public RingDevice
+{
+public:
+	using RingDevice::write;
+
+	void
+	write(const char* data, std::size_t length) override
+	{
+		std::lock_guard lock(mutex);
+		while (length--) push(*data++);
+	}
+};
+
+template< typename Function >
+static void
+benchmark(const char* name, RingDevice& device, Function&& function)
+{
+	modm::IOStream stream(device);
+	device.index = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ii++) {
+		function(stream, ii);
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+
+	const double seconds = std::chrono::duration<double>(time).count();
+	MODM_LOG_INFO.printf("%-24s %8.1f ns per call %8.1f MB/s\n", name,
+						 seconds * 1e9 / Iterations, device.index / seconds / 1e6);
+}
+
+template< typename Function >
+static void
+compare(const char* name, Function&& function)
+{
+	RingDevice charDevice;
+	BlockRingDevice blockDevice;
+	MODM_LOG_INFO << name << modm::endl;
+	benchmark("  char", charDevice, function);
+	benchmark("  block", blockDevice, function);
+}
+
+int
+main()
+{
+	compare("uint32_t", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream << (ii * 2654435761u) << ' ';
+	});
+
+	compare("int64_t", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream << int64_t(ii * -1'000'000'007ll) << ' ';
+	});
+
+	compare("float", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream << (ii * 0.001f) << ' ';
+	});
+
+	compare("hex", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream << modm::hex << ii << modm::ascii << ' ';
+	});
+
+	compare("printf", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream.printf("i=%lu y=%.3f state=%s\n", (unsigned long) ii, double(ii * 0.001f), "running");
+	});
+
+	return 0;
+}
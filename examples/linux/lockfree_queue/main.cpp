@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/architecture/driver/atomic/queue.hpp>
+#include <modm/architecture/driver/atomic/spsc_queue.hpp>
+#include <modm/architecture/driver/atomic/mpsc_queue.hpp>
+
+// Throughput of one producer and one consumer thread passing bytes through
+// the different queue implementations.
+// modm::atomic::Queue is not thread-safe on hosted, so it is guarded by a mutex.
+
+constexpr uint32_t Iterations = 10'000'000;
+constexpr std::size_t BulkSize = 64;
+
+template< class Queue >
+class MutexQueue
+{
+public:
+	bool
+	push(uint8_t value)
+	{
+		std::lock_guard lock(mutex);
+		return queue.push(value);
+	}
+
+	bool
+	pop(uint8_t& value)
+	{
+		std::lock_guard lock(mutex);
+		if (queue.isEmpty()) return false;
+		value = queue.get();
+		queue.pop();
+		return true;
+	}
+
+private:
+	std::mutex mutex;
+	Queue queue;
+};
+
+template< class Producer, class Consumer >
+void
+measure(const char* name, Producer&& producer, Consumer&& consumer)
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::thread thread(producer);
+	consumer();
+	thread.join();
+	const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-24s %8.2f MB/s\n", name, Iterations / duration.count() / 1e6);
+}
+
+template< class Queue >
+void
+measureSingle(const char* name, Queue& queue)
+{
+	measure(name, [&queue]
+	{
+		for (uint32_t ii = 0; ii < Iterations; ++ii) {
+			while (not queue.push(uint8_t(ii))) std::this_thread::yield();
+		}
+	},
+	[&queue]
+	{
+		uint8_t value;
+		for (uint32_t ii = 0; ii < Iterations; ++ii) {
+			while (not queue.pop(value)) std::this_thread::yield();
+		}
+	});
+}
+
+template< class Queue >
+void
+measureBulk(const char* name, Queue& queue)
+{
+	measure(name, [&queue]
+	{
+		uint8_t data[BulkSize] = {};
+		for (uint32_t ii = 0; ii < Iterations; ii += BulkSize)
+		{
+			std::span<const uint8_t> pending{data};
+			while (not pending.empty())
+			{
+				const std::size_t pushed = queue.push(pending);
+				if (not pushed) std::this_thread::yield();
+				pending = pending.subspan(pushed);
+			}
+		}
+	},
+	[&queue]
+	{
+		uint8_t data[BulkSize];
+		for (uint32_t ii = 0; ii < Iterations; )
+		{
+			const std::size_t popped = queue.pop(data);
+			if (not popped) std::this_thread::yield();
+			ii += popped;
+		}
+	});
+}
+
+MutexQueue< modm::atomic::Queue<uint8_t, 1023> > mutexQueue;
+modm::atomic::SpscQueue<uint8_t, 1024> spscQueue;
+modm::atomic::MpscQueue<uint8_t, 1024> mpscQueue;
+
+int
+main()
+{
+	MODM_LOG_INFO << "Passing " << Iterations << " bytes between two threads:" << modm::endl;
+
+	measureSingle("Queue + std::mutex", mutexQueue);
+	measureSingle("SpscQueue", spscQueue);
+	measureBulk("SpscQueue (bulk)", spscQueue);
+	measureSingle("MpscQueue", mpscQueue);
+	measureBulk("MpscQueue (bulk)", mpscQueue);
+
+	return 0;
+}
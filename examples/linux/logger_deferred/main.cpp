@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/debug/logger/deferred.hpp>
+
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+
+// Measures the cost of a log call with three arguments in the calling
+// context. The output goes to a device discarding all characters, so only
+// the formatting is measured, not the waiting for a slow device.
+// - stream: modm::log::Logger with the stream operators
+// - printf: modm::log::Logger::printf()
+// - deferred: modm::log::DeferredLogger::log(), and the costs of process()
+//   and transmit(), which are deferred to the idle loop or the host.
+
+constexpr uint32_t Iterations = 100'000;
+constexpr std::size_t Records = 1024;
+
+class NullDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+
+	void
+	write(char) override
+	{ count++; }
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	std::size_t count = 0;
+};
+
+static NullDevice device;
+static modm::log::Logger logger(device);
+static modm::log::DeferredLogger<Records> deferred;
+
+static inline uint64_t
+cycles()
+{
+#ifdef __x86_64__
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+template< typename Function >
+static void
+benchmark(const char* name, uint32_t iterations, Function&& function)
+{
+	const uint64_t start_cycles = cycles();
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < iterations; ii++) {
+		function(ii);
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+	const uint64_t end_cycles = cycles();
+
+	const double ns = std::chrono::duration<double, std::nano>(time).count() / iterations;
+	MODM_LOG_INFO.printf("%-24s %8.1f ns %8.1f cycles per call\n",
+						 name, ns, double(end_cycles - start_cycles) / iterations);
+}
+
+int
+main()
+{
+	const float y = 3.1415f;
+
+	benchmark("stream", Iterations, [&](uint32_t ii)
+	{
+		logger << "i=" << ii << " y=" << y << " state=" << "running" << modm::endl;
+	});
+
+	benchmark("printf", Iterations, [&](uint32_t ii)
+	{
+		logger.printf("i=%lu y=%.3f state=%s\n", (unsigned long) ii, double(y), "running");
+	});
+
+	// the deferred logger is measured in batches that fit into the buffer
+	double logTime = 0, processTime = 0, transmitTime = 0;
+	uint64_t logCycles = 0, processCycles = 0, transmitCycles = 0;
+	for (uint32_t batch = 0; batch < Iterations / Records; batch++)
+	{
+		for (const bool binary : {false, true})
+		{
+			uint64_t c = cycles();
+			auto t = std::chrono::steady_clock::now();
+			for (uint32_t ii = 0; ii < Records; ii++) {
+				deferred.log(modm::log::INFO, "i=%lu y=%.3f state=%s", ii, y, "running");
+			}
+			logTime += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t).count();
+			logCycles += cycles() - c;
+
+			c = cycles();
+			t = std::chrono::steady_clock::now();
+			if (binary) {
+				while (deferred.transmit(device)) {}
+			} else {
+				while (deferred.process(logger)) {}
+			}
+			const double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t).count();
+			(binary ? transmitTime : processTime) += time;
+			(binary ? transmitCycles : processCycles) += cycles() - c;
+		}
+	}
+	const uint32_t count = (Iterations / Records) * Records;
+	MODM_LOG_INFO.printf("%-24s %8.1f ns %8.1f cycles per call\n", "deferred log()",
+						 logTime / (2 * count), double(logCycles) / (2 * count));
+	MODM_LOG_INFO.printf("%-24s %8.1f ns %8.1f cycles per call\n", "deferred process()",
+						 processTime / count, double(processCycles) / count);
+	MODM_LOG_INFO.printf("%-24s %8.1f ns %8.1f cycles per call\n", "deferred transmit()",
+						 transmitTime / count, double(transmitCycles) / count);
+	MODM_LOG_INFO.printf("%zu characters discarded\n", device.count);
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/math/matrix.hpp>
+
+// Compares `A*B + C*D - E` calculated with the matrix operators, which create
+// a temporary matrix for every operation, with two calls to modm::gemm().
+// The previous multiplication, which calculated each element as a dot product
+// of a row and a column, is included for comparison.
+
+template< typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS >
+static modm::Matrix<T, ROWS, COLUMNS>
+dotProductMultiply(const modm::Matrix<T, ROWS, INNER>& a, const modm::Matrix<T, INNER, COLUMNS>& b)
+{
+	modm::Matrix<T, ROWS, COLUMNS> m;
+	for (uint_fast8_t i = 0; i < ROWS; ++i)
+	{
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j)
+		{
+			m[i][j] = a[i][0] * b[0][j];
+			for (uint_fast8_t x = 1; x < INNER; ++x) {
+				m[i][j] += a[i][x] * b[x][j];
+			}
+		}
+	}
+	return m;
+}
+
+template< uint8_t N >
+static modm::Matrix<float, N, N>
+createMatrix(uint32_t seed)
+{
+	modm::Matrix<float, N, N> m;
+	for (uint8_t i = 0; i < N * N; ++i) {
+		m.element[i] = float((seed + i * 7) % 11) * 0.1f;
+	}
+	return m;
+}
+
+static volatile float sink;
+
+template< typename Function >
+static void
+benchmark(const char* name, uint8_t size, uint32_t iterations, Function&& function)
+{
+	// the fastest of several runs is the least disturbed by other processes
+	double ns = 1e9;
+	for (uint8_t run = 0; run < 5; run++)
+	{
+		float result = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (uint32_t ii = 0; ii < iterations; ii++) {
+			result += function(ii);
+		}
+		const auto time = std::chrono::steady_clock::now() - start;
+		sink = result;
+
+		ns = std::min(ns, std::chrono::duration<double, std::nano>(time).count() / iterations);
+	}
+	MODM_LOG_INFO.printf("%-24s N=%u %8.1f ns per call\n", name, size, ns);
+}
+
+template< uint8_t N >
+static void
+benchmarkSize(uint32_t iterations)
+{
+	using Matrix = modm::Matrix<float, N, N>;
+	static Matrix A, B, C, D, E;
+	A = createMatrix<N>(1); B = createMatrix<N>(2); C = createMatrix<N>(3);
+	D = createMatrix<N>(4); E = createMatrix<N>(5);
+
+	benchmark("dot product operators", N, iterations, [](uint32_t ii)
+	{
+		A.element[0] = float(ii);
+		const Matrix X = dotProductMultiply(A, B) + dotProductMultiply(C, D) - E;
+		return X.element[N * N - 1];
+	});
+	benchmark("operators", N, iterations, [](uint32_t ii)
+	{
+		A.element[0] = float(ii);
+		const Matrix X = A * B + C * D - E;
+		return X.element[N * N - 1];
+	});
+	benchmark("gemm", N, iterations, [](uint32_t ii)
+	{
+		A.element[0] = float(ii);
+		Matrix X = E;
+		modm::gemm(1.f, A, B, -1.f, &X);
+		modm::gemm(1.f, C, D, 1.f, &X);
+		return X.element[N * N - 1];
+	});
+}
+
+int
+main()
+{
+	benchmarkSize<3>(1'000'000);
+	benchmarkSize<6>(400'000);
+	benchmarkSize<9>(200'000);
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/math/matrix.hpp>
+#include <modm/math/cholesky_decomposition.hpp>
+
+// Compares the cofactor expansion previously used by Matrix::determinant(),
+// which needs O(N!) operations, with the LU decomposition, and the solution of
+// a linear system with the LU and the Cholesky decomposition. The matrices
+// are symmetric positive-definite, so that all algorithms can be used.
+
+// The recursive cofactor expansion along the first row
+template< typename T, uint8_t N >
+static T
+cofactorDeterminant(const modm::Matrix<T, N, N>& m)
+{
+	if constexpr (N == 1) {
+		return m[0][0];
+	} else {
+		T result = 0;
+		T factor = 1;
+		for (uint8_t i = 0; i < N; ++i)
+		{
+			// the minor without the first row and the column i
+			modm::Matrix<T, N - 1, N - 1> minor;
+			for (uint8_t y = 1; y < N; ++y) {
+				for (uint8_t x = 0, k = 0; x < N; ++x) {
+					if (x != i) minor[y - 1][k++] = m[y][x];
+				}
+			}
+			result += factor * m[0][i] * cofactorDeterminant(minor);
+			factor = -factor;
+		}
+		return result;
+	}
+}
+
+template< uint8_t N >
+static modm::Matrix<float, N, N>
+createMatrix(uint32_t seed)
+{
+	modm::Matrix<float, N, N> m;
+	for (uint8_t j = 0; j < N; ++j) {
+		for (uint8_t i = 0; i <= j; ++i) {
+			m[j][i] = m[i][j] = (i == j) ? float(N + 1) : float((seed + i * 7 + j * 3) % 5) * 0.2f;
+		}
+	}
+	return m;
+}
+
+static volatile float sink;
+
+template< typename Function >
+static void
+benchmark(const char* name, uint8_t size, uint32_t iterations, Function&& function)
+{
+	float result = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < iterations; ii++) {
+		result += function(ii);
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+	sink = result;
+
+	const double ns = std::chrono::duration<double, std::nano>(time).count() / iterations;
+	MODM_LOG_INFO.printf("%-24s N=%u %12.1f ns per call\n", name, size, ns);
+}
+
+template< uint8_t N >
+static void
+benchmarkSize(uint32_t iterations)
+{
+	benchmark("cofactor determinant", N, N > 6 ? iterations / 1000 : iterations, [](uint32_t ii)
+	{
+		return cofactorDeterminant(createMatrix<N>(ii));
+	});
+	benchmark("LU determinant", N, iterations, [](uint32_t ii)
+	{
+		return createMatrix<N>(ii).determinant();
+	});
+	benchmark("LU inverse", N, iterations, [](uint32_t ii)
+	{
+		return createMatrix<N>(ii).asInversed()[N - 1][0];
+	});
+	benchmark("LU solve", N, iterations, [](uint32_t ii)
+	{
+		modm::Matrix<float, N, 1> b = modm::Matrix<float, N, 1>::zeroMatrix();
+		b[0][0] = 1.f;
+		modm::LUDecomposition::solve(createMatrix<N>(ii), &b);
+		return b[N - 1][0];
+	});
+	benchmark("Cholesky solve", N, iterations, [](uint32_t ii)
+	{
+		modm::Matrix<float, N, 1> b = modm::Matrix<float, N, 1>::zeroMatrix();
+		b[0][0] = 1.f;
+		modm::Matrix<float, N, N> l;
+		modm::CholeskyDecomposition::decompose(createMatrix<N>(ii), &l);
+		modm::CholeskyDecomposition::solve(l, &b);
+		return b[N - 1][0];
+	});
+}
+
+int
+main()
+{
+	benchmarkSize<3>(1'000'000);
+	benchmarkSize<6>(200'000);
+	benchmarkSize<9>(100'000);
+	return 0;
+}
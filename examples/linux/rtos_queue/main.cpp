@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <deque>
+#include <thread>
+
+#include <modm/platform.hpp>
+#include <modm/processing/rtos.hpp>
+#include <modm/debug/logger.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+// The previous implementation: a std::deque guarded by a timed mutex, which
+// returns immediately if the queue is empty, so that consumers have to poll.
+template< typename T >
+class PollingQueue
+{
+public:
+	PollingQueue(uint32_t length) : maxSize(length) {}
+
+	bool
+	append(const T& item, uint32_t timeout = -1)
+	{
+		std::unique_lock lock(mutex, std::chrono::milliseconds(timeout));
+		if (not lock or deque.size() >= maxSize) return false;
+		deque.push_back(item);
+		return true;
+	}
+
+	bool
+	get(T& item, uint32_t timeout = -1)
+	{
+		std::unique_lock lock(mutex, std::chrono::milliseconds(timeout));
+		if (not lock or deque.empty()) return false;
+		item = deque.front();
+		deque.pop_front();
+		return true;
+	}
+
+private:
+	std::timed_mutex mutex;
+	uint32_t maxSize;
+	std::deque<T> deque;
+};
+
+// Throughput: the producer sends as fast as possible
+template< class Queue >
+void
+measureThroughput(const char* name)
+{
+	constexpr uint32_t Iterations = 1'000'000;
+	Queue queue(64);
+
+	const auto start = Clock::now();
+	std::thread producer([&queue]
+	{
+		for (uint32_t ii = 0; ii < Iterations; ++ii) {
+			while (not queue.append(ii, 10)) std::this_thread::yield();
+		}
+	});
+	uint32_t item;
+	for (uint32_t ii = 0; ii < Iterations; ++ii) {
+		while (not queue.get(item, 10)) ;
+	}
+	producer.join();
+	const std::chrono::duration<double> duration = Clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-16s throughput %8.2f items/us\n", name,
+						 Iterations / duration.count() / 1e6);
+}
+
+// Latency and consumer CPU time: the producer sends one item every 100us
+template< class Queue >
+void
+measureLatency(const char* name)
+{
+	constexpr uint32_t Iterations = 10'000;
+	Queue queue(64);
+
+	std::thread producer([&queue]
+	{
+		for (uint32_t ii = 0; ii < Iterations; ++ii)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+			queue.append(Clock::now(), 10);
+		}
+	});
+
+	std::chrono::nanoseconds latency{};
+	Clock::time_point timestamp;
+	const std::clock_t cpuStart = std::clock();
+	for (uint32_t ii = 0; ii < Iterations; ++ii)
+	{
+		while (not queue.get(timestamp, 10)) ;
+		latency += Clock::now() - timestamp;
+	}
+	const double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+	producer.join();
+
+	MODM_LOG_INFO.printf("%-16s latency %8.2f us, process CPU time %6.3f s\n", name,
+						 std::chrono::duration<double, std::micro>(latency).count() / Iterations, cpu);
+}
+
+int
+main()
+{
+	measureThroughput< PollingQueue<uint32_t> >("polling");
+	measureThroughput< modm::rtos::Queue<uint32_t> >("rtos::Queue");
+
+	measureLatency< PollingQueue<Clock::time_point> >("polling");
+	measureLatency< modm::rtos::Queue<Clock::time_point> >("rtos::Queue");
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/processing/scheduler/scheduler.hpp>
+
+// Measures the overhead of modm::Scheduler::schedule() per tick depending on
+// the number of tasks. The tasks have periods between 100 and 1099 ticks and
+// do nothing, so mostly the tick itself is measured and not the execution.
+
+constexpr uint32_t Ticks = 1'000'000;
+
+class EmptyTask : public modm::Scheduler::Task
+{
+public:
+	void
+	run() override
+	{ runs++; }
+
+	uint32_t runs = 0;
+};
+
+static void
+benchmark(uint16_t tasks)
+{
+	modm::Scheduler scheduler;
+	EmptyTask* task = new EmptyTask[tasks];
+	for (uint16_t ii = 0; ii < tasks; ii++) {
+		scheduler.scheduleTask(task[ii], 100 + (ii * 337) % 1000, 1 + ii % 255);
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Ticks; ii++) {
+		scheduler.schedule();
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+
+	uint32_t runs = 0;
+	for (uint16_t ii = 0; ii < tasks; ii++) {
+		runs += task[ii].runs;
+	}
+	delete[] task;
+
+	const double ns = std::chrono::duration<double, std::nano>(time).count() / Ticks;
+	MODM_LOG_INFO.printf("%5u tasks %8.1f ns per tick %8.3f runs per tick\n",
+						 tasks, ns, double(runs) / Ticks);
+}
+
+int
+main()
+{
+	for (uint16_t tasks : {1, 10, 50, 100, 500, 1000}) {
+		benchmark(tasks);
+	}
+	return 0;
+}
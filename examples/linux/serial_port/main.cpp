@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+// Measures the throughput of modm::platform::SerialPort on the slave side of
+// pseudo terminals, threads on the master sides produce or consume the data
+// as fast as possible.
+// - read: read(char&) and readBytes() from a port with its own event loop.
+// - write: write(char) and writeBytes() followed by flush().
+// - shared: several ports read in parallel, each with its own event loop
+//   thread or all sharing one io_context run by a single thread.
+
+constexpr std::size_t TotalSize = 16 * 1024 * 1024;
+constexpr std::size_t BlockSize = 1024;
+constexpr std::size_t Ports = 4;
+
+using Clock = std::chrono::steady_clock;
+
+class PseudoTerminal
+{
+public:
+	PseudoTerminal()
+	{
+		master = posix_openpt(O_RDWR | O_NOCTTY);
+		if (master < 0 or grantpt(master) < 0 or unlockpt(master) < 0)
+		{
+			MODM_LOG_INFO.printf("Could not open pseudo terminal\n");
+			std::exit(1);
+		}
+		struct termios configuration;
+		tcgetattr(master, &configuration);
+		cfmakeraw(&configuration);
+		tcsetattr(master, TCSANOW, &configuration);
+	}
+
+	~PseudoTerminal()
+	{ ::close(master); }
+
+	const char*
+	getSlaveName() const
+	{ return ptsname(master); }
+
+	/// Writes `size` bytes into the master side
+	void
+	produce(std::size_t size)
+	{
+		std::vector<uint8_t> data(BlockSize, 0x55);
+		for (std::size_t count = 0; count < size; )
+		{
+			const ssize_t result = ::write(master, data.data(), std::min(BlockSize, size - count));
+			if (result > 0) count += result;
+		}
+	}
+
+	/// Reads `size` bytes from the master side
+	void
+	consume(std::size_t size)
+	{
+		std::vector<uint8_t> data(BlockSize);
+		for (std::size_t count = 0; count < size; )
+		{
+			const ssize_t result = ::read(master, data.data(), BlockSize);
+			if (result > 0) count += result;
+		}
+	}
+
+private:
+	int master;
+};
+
+static void
+report(const char* name, std::size_t size, Clock::duration time)
+{
+	const double seconds = std::chrono::duration<double>(time).count();
+	MODM_LOG_INFO.printf("%-32s %8.1f MB/s\n", name, size / seconds / 1e6);
+}
+
+static void
+open(modm::platform::SerialPort& port, const PseudoTerminal& terminal)
+{
+	if (not port.open(terminal.getSlaveName(), 115'200))
+	{
+		MODM_LOG_INFO.printf("Could not open %s\n", terminal.getSlaveName());
+		std::exit(1);
+	}
+}
+
+template< typename Function >
+static void
+benchmarkRead(const char* name, Function&& read)
+{
+	PseudoTerminal terminal;
+	modm::platform::SerialPort port;
+	open(port, terminal);
+
+	const auto start = Clock::now();
+	std::thread producer(&PseudoTerminal::produce, &terminal, TotalSize);
+	read(port);
+	const auto time = Clock::now() - start;
+	producer.join();
+	port.close();
+	report(name, TotalSize, time);
+}
+
+template< typename Function >
+static void
+benchmarkWrite(const char* name, Function&& write)
+{
+	PseudoTerminal terminal;
+	modm::platform::SerialPort port;
+	open(port, terminal);
+
+	const auto start = Clock::now();
+	std::thread consumer(&PseudoTerminal::consume, &terminal, TotalSize);
+	write(port);
+	port.flush();
+	consumer.join();
+	const auto time = Clock::now() - start;
+	port.close();
+	report(name, TotalSize, time);
+}
+
+/// Reads TotalSize bytes from each port, polling all ports in turn
+static void
+benchmarkShared(const char* name, std::vector<std::unique_ptr<modm::platform::SerialPort>>& ports)
+{
+	PseudoTerminal terminals[Ports];
+	for (std::size_t ii = 0; ii < Ports; ii++) {
+		open(*ports[ii], terminals[ii]);
+	}
+
+	const auto start = Clock::now();
+	std::vector<std::thread> producers;
+	for (auto& terminal : terminals) {
+		producers.emplace_back(&PseudoTerminal::produce, &terminal, TotalSize);
+	}
+	std::size_t counts[Ports] = {};
+	uint8_t data[BlockSize];
+	for (std::size_t finished = 0; finished < Ports; )
+	{
+		bool received = false;
+		for (std::size_t ii = 0; ii < Ports; ii++)
+		{
+			if (counts[ii] == TotalSize) continue;
+			const std::size_t count = ports[ii]->readBytes(data, BlockSize);
+			counts[ii] += count;
+			if (counts[ii] == TotalSize) finished++;
+			received |= (count > 0);
+		}
+		if (not received) std::this_thread::yield();
+	}
+	const auto time = Clock::now() - start;
+	for (auto& producer : producers) producer.join();
+	for (auto& port : ports) port->close();
+	report(name, Ports * TotalSize, time);
+}
+
+int
+main()
+{
+	benchmarkRead("read(char&)", [](modm::platform::SerialPort& port)
+	{
+		char c;
+		for (std::size_t count = 0; count < TotalSize; )
+		{
+			if (port.read(c)) count++;
+			else std::this_thread::yield();
+		}
+	});
+
+	benchmarkRead("readBytes()", [](modm::platform::SerialPort& port)
+	{
+		uint8_t data[BlockSize];
+		for (std::size_t count = 0; count < TotalSize; )
+		{
+			const std::size_t result = port.readBytes(data, BlockSize);
+			if (result) count += result;
+			else std::this_thread::yield();
+		}
+	});
+
+	benchmarkWrite("write(char)", [](modm::platform::SerialPort& port)
+	{
+		for (std::size_t count = 0; count < TotalSize; count++) {
+			port.write(char(0x55));
+		}
+	});
+
+	benchmarkWrite("writeBytes()", [](modm::platform::SerialPort& port)
+	{
+		uint8_t data[BlockSize] = {};
+		for (std::size_t count = 0; count < TotalSize; count += BlockSize) {
+			port.writeBytes(data, BlockSize);
+		}
+	});
+
+	{
+		std::vector<std::unique_ptr<modm::platform::SerialPort>> ports;
+		for (std::size_t ii = 0; ii < Ports; ii++) {
+			ports.push_back(std::make_unique<modm::platform::SerialPort>());
+		}
+		benchmarkShared("4 ports, 4 event loop threads", ports);
+	}
+	{
+		boost::asio::io_context context;
+		auto work = boost::asio::make_work_guard(context);
+		std::thread loop([&context] { context.run(); });
+
+		std::vector<std::unique_ptr<modm::platform::SerialPort>> ports;
+		for (std::size_t ii = 0; ii < Ports; ii++) {
+			ports.push_back(std::make_unique<modm::platform::SerialPort>(context));
+		}
+		benchmarkShared("4 ports, 1 event loop thread", ports);
+
+		work.reset();
+		loop.join();
+	}
+
+	return 0;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+// Measures the throughput of modm::platform::SerialInterface on the slave side
+// of a pseudo terminal, a thread on the master side produces or consumes the
+// data as fast as possible.
+// - read: one read() system call per byte as reference, read(char&) served
+//   from the receive buffer, readBytes() and read(data, length) in blocks.
+// - write: write(char), writeBytes() of whole packets and writeVectored() of
+//   packets split into header and payload.
+
+constexpr std::size_t TotalSize = 4 * 1024 * 1024;
+constexpr std::size_t BlockSize = 1024;
+constexpr std::size_t HeaderSize = 4;
+constexpr std::size_t PayloadSize = 60;
+constexpr std::size_t PacketSize = HeaderSize + PayloadSize;
+
+using Clock = std::chrono::steady_clock;
+
+static int
+openMaster()
+{
+	const int master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master < 0 or grantpt(master) < 0 or unlockpt(master) < 0) {
+		return -1;
+	}
+	struct termios configuration;
+	tcgetattr(master, &configuration);
+	cfmakeraw(&configuration);
+	tcsetattr(master, TCSANOW, &configuration);
+	return master;
+}
+
+/// Writes TotalSize bytes into the master side
+static void
+produce(int master)
+{
+	std::vector<uint8_t> data(BlockSize, 0x55);
+	std::size_t count = 0;
+	while (count < TotalSize)
+	{
+		const ssize_t result = ::write(master, data.data(), std::min(BlockSize, TotalSize - count));
+		if (result > 0) count += result;
+	}
+}
+
+/// Reads TotalSize bytes from the master side
+static void
+consume(int master)
+{
+	std::vector<uint8_t> data(BlockSize);
+	std::size_t count = 0;
+	while (count < TotalSize)
+	{
+		const ssize_t result = ::read(master, data.data(), BlockSize);
+		if (result > 0) count += result;
+	}
+}
+
+static void
+report(const char* name, Clock::duration time)
+{
+	const double seconds = std::chrono::duration<double>(time).count();
+	MODM_LOG_INFO.printf("%-28s %8.1f MB/s\n", name, TotalSize / seconds / 1e6);
+}
+
+template< typename Function >
+static void
+benchmarkRead(const char* name, Function&& read)
+{
+	const int master = openMaster();
+	modm::platform::SerialInterface port(ptsname(master), 115'200);
+	if (master < 0 or not port.open()) {
+		MODM_LOG_INFO.printf("%s: could not open pseudo terminal\n", name);
+		std::exit(1);
+	}
+	const auto start = Clock::now();
+	std::thread producer(produce, master);
+	read(port);
+	const auto time = Clock::now() - start;
+	producer.join();
+	report(name, time);
+	port.close();
+	::close(master);
+}
+
+template< typename Function >
+static void
+benchmarkWrite(const char* name, Function&& write)
+{
+	const int master = openMaster();
+	modm::platform::SerialInterface port(ptsname(master), 115'200);
+	if (master < 0 or not port.open()) {
+		MODM_LOG_INFO.printf("%s: could not open pseudo terminal\n", name);
+		std::exit(1);
+	}
+	const auto start = Clock::now();
+	std::thread consumer(consume, master);
+	write(port);
+	consumer.join();
+	const auto time = Clock::now() - start;
+	report(name, time);
+	port.close();
+	::close(master);
+}
+
+int
+main()
+{
+	benchmarkRead("read syscall per byte", [](modm::platform::SerialInterface& port)
+	{
+		const int fd = port.getFileDescriptor();
+		struct pollfd wait = { fd, POLLIN, 0 };
+		uint8_t c;
+		for (std::size_t count = 0; count < TotalSize; )
+		{
+			if (::read(fd, &c, 1) == 1) count++;
+			else poll(&wait, 1, -1);
+		}
+	});
+
+	benchmarkRead("read(char&) buffered", [](modm::platform::SerialInterface& port)
+	{
+		char c;
+		for (std::size_t count = 0; count < TotalSize; )
+		{
+			if (port.read(c)) count++;
+			else port.waitForData(std::chrono::milliseconds(-1));
+		}
+	});
+
+	benchmarkRead("readBytes()", [](modm::platform::SerialInterface& port)
+	{
+		uint8_t data[BlockSize];
+		for (std::size_t count = 0; count < TotalSize; count += BlockSize) {
+			port.readBytes(data, BlockSize);
+		}
+	});
+
+	benchmarkRead("read(data, length)", [](modm::platform::SerialInterface& port)
+	{
+		uint8_t data[BlockSize];
+		for (std::size_t count = 0; count < TotalSize; )
+		{
+			const std::size_t result = port.read(data, BlockSize);
+			if (result) count += result;
+			else port.waitForData(std::chrono::milliseconds(-1));
+		}
+	});
+
+	static uint8_t header[HeaderSize] = {0xaa, 0x55, PayloadSize, 0};
+	static uint8_t payload[PayloadSize] = {};
+
+	benchmarkWrite("write(char)", [](modm::platform::SerialInterface& port)
+	{
+		for (std::size_t count = 0; count < TotalSize; count++) {
+			port.write(char(0x55));
+		}
+	});
+
+	benchmarkWrite("writeBytes() packets", [](modm::platform::SerialInterface& port)
+	{
+		uint8_t packet[PacketSize];
+		for (std::size_t count = 0; count < TotalSize; count += PacketSize)
+		{
+			// the header must be copied in front of the payload
+			std::copy_n(header, HeaderSize, packet);
+			std::copy_n(payload, PayloadSize, packet + HeaderSize);
+			port.writeBytes(packet, std::min(PacketSize, TotalSize - count));
+		}
+	});
+
+	benchmarkWrite("writeVectored() packets", [](modm::platform::SerialInterface& port)
+	{
+		constexpr std::size_t Packets = 16;
+		struct iovec buffers[2 * Packets];
+		for (std::size_t ii = 0; ii < Packets; ii++)
+		{
+			buffers[2 * ii] = { header, HeaderSize };
+			buffers[2 * ii + 1] = { payload, PayloadSize };
+		}
+		std::size_t count = 0;
+		for (; count + Packets * PacketSize <= TotalSize; count += Packets * PacketSize) {
+			port.writeVectored(buffers, 2 * Packets);
+		}
+		std::vector<uint8_t> rest(TotalSize - count);
+		port.writeBytes(rest.data(), rest.size());
+	});
+
+	return 0;
+}
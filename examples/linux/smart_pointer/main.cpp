@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/communication/xpcc.hpp>
+
+// Counts heap allocations and measures the throughput of modm::SmartPointer
+// payloads backed by the block pools, compared to allocating every payload
+// on the heap, and of the payloads of xpcc messages passing the Dispatcher.
+
+static uint32_t allocations = 0;
+
+void *
+operator new(std::size_t size)
+{
+	allocations++;
+	if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+	throw std::bad_alloc();
+}
+
+void *
+operator new[](std::size_t size)
+{ return operator new(size); }
+
+void
+operator delete(void *ptr) noexcept
+{ std::free(ptr); }
+
+void
+operator delete[](void *ptr) noexcept
+{ std::free(ptr); }
+
+void
+operator delete(void *ptr, std::size_t) noexcept
+{ std::free(ptr); }
+
+void
+operator delete[](void *ptr, std::size_t) noexcept
+{ std::free(ptr); }
+
+constexpr uint32_t Iterations = 1'000'000;
+
+/// The previous implementation: every payload is allocated on the heap
+class HeapPointer
+{
+public:
+	HeapPointer(uint16_t size) :
+		ptr(new uint8_t[size ? size + 4 : 5])
+	{
+		ptr[0] = 1;
+		*reinterpret_cast<uint16_t*>(ptr + 2) = size;
+	}
+
+	HeapPointer(const HeapPointer& other) :
+		ptr(other.ptr)
+	{ ptr[0]++; }
+
+	~HeapPointer()
+	{ if (--ptr[0] == 0) delete[] ptr; }
+
+	uint8_t *
+	getPointer() { return ptr + 4; }
+
+private:
+	uint8_t *ptr;
+};
+
+template< class Pointer >
+void
+measurePayload(const char *name, uint16_t size)
+{
+	allocations = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ++ii)
+	{
+		// payload is created, queued by the dispatcher and sent by the backend
+		Pointer payload(size);
+		if (size) payload.getPointer()[0] = ii;
+		Pointer entry(payload);
+		Pointer backend(entry);
+	}
+	const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-12s %3u bytes: %6.1f ns/payload, %4.2f allocations/payload\n",
+						 name, size, duration.count() / Iterations, double(allocations) / Iterations);
+}
+
+// ----------------------------------------------------------------------------
+class Backend : public xpcc::BackendInterface
+{
+public:
+	void update() override {}
+	void sendPacket(const xpcc::Header&, modm::SmartPointer) override {}
+	bool isPacketAvailable() const override { return false; }
+	const xpcc::Header& getPacketHeader() const override { return header; }
+	const modm::SmartPointer getPacketPayload() const override { return modm::SmartPointer(); }
+	void dropPacket() override {}
+
+	xpcc::Header header;
+};
+
+/// Delivers all messages to a local component
+class Postman : public xpcc::Postman
+{
+public:
+	DeliverInfo
+	deliverPacket(const xpcc::Header&, const modm::SmartPointer& payload) override
+	{
+		sum += payload.getSize();
+		return OK;
+	}
+
+	bool
+	isComponentAvailable(uint8_t) const override
+	{ return true; }
+
+	uint32_t sum = 0;
+};
+
+class Component : public xpcc::AbstractComponent
+{
+public:
+	using xpcc::AbstractComponent::AbstractComponent;
+	using xpcc::AbstractComponent::callAction;
+	using xpcc::AbstractComponent::publishEvent;
+};
+
+void
+measureDispatcher()
+{
+	Backend backend;
+	Postman postman;
+	xpcc::Dispatcher dispatcher(&backend, &postman);
+	Component component(1, dispatcher);
+
+	allocations = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Iterations; ++ii)
+	{
+		component.publishEvent(0x10, ii);
+		component.callAction(2, 0x20);
+		dispatcher.update();
+	}
+	const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("xpcc::Dispatcher: %6.1f ns/message, %4.2f allocations/message\n",
+						 duration.count() / (2 * Iterations), double(allocations) / (2 * Iterations));
+}
+
+int
+main()
+{
+	for (uint16_t size : {0, 4, 48, 200})
+	{
+		measurePayload<HeapPointer>("heap", size);
+		measurePayload<modm::SmartPointer>("SmartPointer", size);
+	}
+	measureDispatcher();
+	return 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <memory>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/processing/timer.hpp>
+
+using namespace std::chrono_literals;
+
+// Measures the cost of one main loop iteration polling many timeouts with
+// intervals between 10ms and 1s, which are restarted after expiring:
+// - Timeout: every modm::Timeout reads the clock when polled.
+// - Wheel Timeout: one modm::TimerWheel::update() reads the clock, the
+//   modm::TimerWheel::Timeout only check their state when polled.
+// - Wheel Entry: only the expired entries are called by the wheel, nothing
+//   is polled.
+
+constexpr auto Runtime = 500ms;
+
+static uint32_t
+interval(uint32_t index)
+{ return 10 + (index * 7919) % 991; }
+
+template< typename Setup, typename Loop >
+static void
+benchmark(const char* name, uint32_t timers, Setup&& setup, Loop&& loop)
+{
+	uint32_t expired{0};
+	auto state = setup(timers);
+
+	uint32_t iterations{0};
+	const auto start = std::chrono::steady_clock::now();
+	const auto end = start + Runtime;
+	while (std::chrono::steady_clock::now() < end)
+	{
+		// amortize reading the steady clock of the benchmark itself
+		for (uint8_t ii = 0; ii < 16; ii++) {
+			expired += loop(*state, timers);
+		}
+		iterations += 16;
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+
+	const double ns = std::chrono::duration<double, std::nano>(time).count() / iterations;
+	MODM_LOG_INFO.printf("%-14s %6lu timers %10.1f ns per loop %8.1f expired per second\n",
+			name, (unsigned long) timers, ns,
+			expired / std::chrono::duration<double>(time).count());
+}
+
+struct TimeoutState
+{
+	std::unique_ptr<modm::Timeout[]> timeouts;
+};
+
+struct WheelTimeoutState
+{
+	modm::TimerWheel wheel;
+	std::unique_ptr<std::unique_ptr<modm::TimerWheel::Timeout>[]> timeouts;
+};
+
+class RestartingEntry : public modm::TimerWheel::Entry
+{
+public:
+	RestartingEntry(modm::TimerWheel& wheel, modm::TimerWheel::duration interval) :
+		Entry(wheel), interval(interval)
+	{ wheel.insert(*this, interval); }
+
+protected:
+	void
+	expired() override
+	{ wheel.insert(*this, interval); }
+
+	modm::TimerWheel::duration interval;
+};
+
+struct WheelEntryState
+{
+	modm::TimerWheel wheel;
+	std::unique_ptr<std::unique_ptr<RestartingEntry>[]> entries;
+};
+
+int
+main()
+{
+	for (uint32_t timers : {10, 100, 1000, 10'000})
+	{
+		benchmark("Timeout", timers, [](uint32_t timers)
+		{
+			auto state = std::make_unique<TimeoutState>();
+			state->timeouts = std::make_unique<modm::Timeout[]>(timers);
+			for (uint32_t ii = 0; ii < timers; ii++) {
+				state->timeouts[ii].restart(std::chrono::milliseconds(interval(ii)));
+			}
+			return state;
+		},
+		[](TimeoutState& state, uint32_t timers)
+		{
+			uint32_t expired{0};
+			for (uint32_t ii = 0; ii < timers; ii++)
+			{
+				if (state.timeouts[ii].execute()) {
+					state.timeouts[ii].restart();
+					expired++;
+				}
+			}
+			return expired;
+		});
+
+		benchmark("Wheel Timeout", timers, [](uint32_t timers)
+		{
+			auto state = std::make_unique<WheelTimeoutState>();
+			state->timeouts = std::make_unique<std::unique_ptr<modm::TimerWheel::Timeout>[]>(timers);
+			for (uint32_t ii = 0; ii < timers; ii++) {
+				state->timeouts[ii] = std::make_unique<modm::TimerWheel::Timeout>(
+						state->wheel, std::chrono::milliseconds(interval(ii)));
+			}
+			return state;
+		},
+		[](WheelTimeoutState& state, uint32_t timers)
+		{
+			uint32_t expired{0};
+			state.wheel.update();
+			for (uint32_t ii = 0; ii < timers; ii++)
+			{
+				if (state.timeouts[ii]->execute()) {
+					state.timeouts[ii]->restart();
+					expired++;
+				}
+			}
+			return expired;
+		});
+
+		benchmark("Wheel Entry", timers, [](uint32_t timers)
+		{
+			auto state = std::make_unique<WheelEntryState>();
+			state->entries = std::make_unique<std::unique_ptr<RestartingEntry>[]>(timers);
+			for (uint32_t ii = 0; ii < timers; ii++) {
+				state->entries[ii] = std::make_unique<RestartingEntry>(
+					state->wheel, modm::TimerWheel::duration(interval(ii)));
+			}
+			return state;
+		},
+		[](WheelEntryState& state, uint32_t)
+		{
+			return uint32_t(state.wheel.update());
+		});
+	}
+	return 0;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/architecture/interface/can.hpp>
+#include <modm/communication/xpcc/backend/can.hpp>
+
+// Simulates xpcc::CanConnector nodes on a shared CAN bus. The bus transmits
+// one frame per step, chosen by arbitration of the lowest identifier among
+// the first pending frames of all nodes, and delivers it to all other nodes.
+// - bulk: several senders transmit 48 byte packets to one receiver at the
+//   same time. Reports the bus load, the payload rate at 1 Mbit/s and the
+//   host CPU time per frame of all connectors.
+// - latency: a short packet is queued behind large packets of the same
+//   sender. Reports the number of frames until it is received.
+
+constexpr uint8_t Receiver = 0x10;
+constexpr uint8_t LargeSize = 48;
+constexpr uint8_t ShortIdentifier = 0xff;
+/// Extended frame with 8 bytes and bit stuffing at 1 Mbit/s
+constexpr std::chrono::microseconds FrameTime{130};
+
+/// CAN controller with three transmit mailboxes sent in order
+class SimulatedCan : public modm::Can
+{
+public:
+	static constexpr std::size_t Mailboxes = 3;
+
+	bool
+	isMessageAvailable()
+	{ return not rx.empty(); }
+
+	bool
+	getMessage(modm::can::Message& message)
+	{
+		if (rx.empty()) return false;
+		message = rx.front();
+		rx.pop_front();
+		return true;
+	}
+
+	bool
+	isReadyToSend()
+	{ return tx.size() < Mailboxes; }
+
+	bool
+	sendMessage(const modm::can::Message& message)
+	{
+		if (not isReadyToSend()) return false;
+		tx.push_back(message);
+		return true;
+	}
+
+	BusState
+	getBusState()
+	{ return BusState::Connected; }
+
+	std::deque<modm::can::Message> rx;
+	std::deque<modm::can::Message> tx;
+};
+
+using Connector = xpcc::CanConnector<SimulatedCan>;
+
+struct Node
+{
+	SimulatedCan can;
+	Connector connector{&can};
+};
+
+/// Transmits the winning frame of the arbitration
+/// \return	`false` if no node has a frame to send
+bool
+transmit(std::vector<Node>& nodes)
+{
+	Node* winner = nullptr;
+	for (Node& node : nodes)
+	{
+		if (not node.can.tx.empty() and (winner == nullptr or
+				node.can.tx.front().identifier < winner->can.tx.front().identifier)) {
+			winner = &node;
+		}
+	}
+	if (winner == nullptr) return false;
+
+	for (Node& node : nodes) {
+		if (&node != winner) node.can.rx.push_back(winner->can.tx.front());
+	}
+	winner->can.tx.pop_front();
+	return true;
+}
+
+void
+send(Node& node, uint8_t source, uint8_t identifier, uint8_t size)
+{
+	modm::SmartPointer payload(size);
+	for (uint8_t ii = 0; ii < size; ++ii) {
+		payload.getPointer()[ii] = ii;
+	}
+	node.connector.sendPacket(xpcc::Header(xpcc::Header::Type::REQUEST, false,
+			Receiver, source, identifier), payload);
+}
+
+void
+bulk(uint8_t senders, uint8_t packets)
+{
+	// node 0 is the receiver
+	std::vector<Node> nodes(senders + 1);
+	for (uint8_t sender = 1; sender <= senders; ++sender) {
+		for (uint8_t packet = 0; packet < packets; ++packet) {
+			send(nodes[sender], sender, packet, LargeSize);
+		}
+	}
+
+	const uint32_t expected = uint32_t(senders) * packets;
+	uint32_t received = 0;
+	uint32_t frames = 0;
+	uint32_t steps = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (; received < expected; ++steps)
+	{
+		for (Node& node : nodes) {
+			node.connector.update();
+		}
+		while (nodes[0].connector.isPacketAvailable())
+		{
+			if (nodes[0].connector.getPacketPayload().getSize() == LargeSize) {
+				received++;
+			}
+			nodes[0].connector.dropPacket();
+		}
+		if (transmit(nodes)) frames++;
+	}
+	const std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+
+	const double busTime = frames * std::chrono::duration<double>(FrameTime).count();
+	MODM_LOG_INFO.printf("bulk %u senders x %2u packets: %5lu frames, %5.1f%% bus load, %6.1f kB/s payload, %6.3f us CPU/frame\n",
+						 senders, packets, (unsigned long) frames, 100.0 * frames / steps,
+						 expected * LargeSize / busTime / 1000, duration.count() / frames);
+}
+
+void
+latency(uint8_t packets)
+{
+	std::vector<Node> nodes(2);
+	for (uint8_t packet = 0; packet < packets; ++packet) {
+		send(nodes[1], 1, packet, LargeSize);
+	}
+	send(nodes[1], 1, ShortIdentifier, 4);
+
+	uint32_t frames = 0;
+	bool received = false;
+	while (not received)
+	{
+		for (Node& node : nodes) {
+			node.connector.update();
+		}
+		while (nodes[0].connector.isPacketAvailable())
+		{
+			if (nodes[0].connector.getPacketHeader().packetIdentifier == ShortIdentifier) {
+				received = true;
+			}
+			nodes[0].connector.dropPacket();
+		}
+		if (not received and transmit(nodes)) frames++;
+	}
+
+	const uint32_t fragments = (LargeSize + 5) / 6;
+	MODM_LOG_INFO.printf("latency behind %2u packets: %3lu frames (%lu frames queued before it)\n",
+						 packets, (unsigned long) frames, (unsigned long) (packets * fragments));
+}
+
+int
+main()
+{
+	for (uint8_t senders : {1, 2, 3})
+	{
+		bulk(senders, 16);
+		bulk(senders, 64);
+	}
+	for (uint8_t packets : {1, 4, 16}) {
+		latency(packets);
+	}
+	return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <deque>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/communication/xpcc.hpp>
+
+// Measures the cost of xpcc::Dispatcher::update() with 10, 100 and 1000
+// actions waiting for an acknowledge from a remote component:
+// - idle: no packet is received, only the timeouts are checked.
+// - ack: every update one acknowledge is received and a new action is sent.
+// Each measurement stops well before the acknowledge timeout, so that no
+// action is retransmitted or aborted in between.
+
+constexpr uint32_t Updates = 200'000;
+constexpr auto MaxDuration = xpcc::Dispatcher::acknowledgeTimeout / 4;
+constexpr uint8_t Sender = 1;
+
+/// Receives the acknowledges pushed by the benchmark and counts sent packets
+class Backend : public xpcc::BackendInterface
+{
+public:
+	void
+	update() override {}
+
+	void
+	sendPacket(const xpcc::Header&, modm::SmartPointer) override
+	{ sent++; }
+
+	bool
+	isPacketAvailable() const override
+	{ return not received.empty(); }
+
+	const xpcc::Header&
+	getPacketHeader() const override
+	{ return received.front(); }
+
+	const modm::SmartPointer
+	getPacketPayload() const override
+	{ return modm::SmartPointer(); }
+
+	void
+	dropPacket() override
+	{ received.pop_front(); }
+
+	std::deque<xpcc::Header> received;
+	uint32_t sent = 0;
+};
+
+/// All action calls go to remote components
+class Postman : public xpcc::Postman
+{
+public:
+	DeliverInfo
+	deliverPacket(const xpcc::Header&, const modm::SmartPointer&) override
+	{ return NO_COMPONENT; }
+
+	bool
+	isComponentAvailable(uint8_t component) const override
+	{ return component == Sender; }
+};
+
+class Component : public xpcc::AbstractComponent
+{
+public:
+	using xpcc::AbstractComponent::AbstractComponent;
+	using xpcc::AbstractComponent::callAction;
+};
+
+// unique (destination, packet id) of every outstanding action
+static constexpr uint8_t
+destination(uint32_t index) { return 10 + index / 200; }
+
+static constexpr uint8_t
+identifier(uint32_t index) { return index % 200; }
+
+/// \return average duration of one step in nanoseconds
+template< class Step >
+double
+run(Step&& step)
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::chrono::duration<double, std::nano> duration{};
+	uint32_t steps = 0;
+	while (steps < Updates and duration < MaxDuration)
+	{
+		for (uint32_t ii = 0; ii < 64; ++ii, ++steps) {
+			step(steps);
+		}
+		duration = std::chrono::steady_clock::now() - start;
+	}
+	return duration.count() / steps;
+}
+
+void
+measure(uint32_t outstanding)
+{
+	Backend backend;
+	Postman postman;
+	xpcc::Dispatcher dispatcher(&backend, &postman);
+	Component component(Sender, dispatcher);
+
+	for (uint32_t ii = 0; ii < outstanding; ++ii) {
+		component.callAction(destination(ii), identifier(ii));
+	}
+	dispatcher.update();
+
+	const double idle = run([&](uint32_t) { dispatcher.update(); });
+
+	backend.sent = 0;
+	uint32_t acknowledged = 0;
+	const double ack = run([&](uint32_t step)
+	{
+		// acknowledge the oldest action and replace it with a new one
+		const uint32_t index = step % outstanding;
+		backend.received.emplace_back(xpcc::Header::Type::REQUEST, true,
+				Sender, destination(index), identifier(index));
+		component.callAction(destination(index), identifier(index));
+		dispatcher.update();
+		acknowledged++;
+	});
+
+	MODM_LOG_INFO.printf("%4lu outstanding: idle %8.1f ns/update, ack %8.1f ns/update (%lu resent)\n",
+						 (unsigned long) outstanding, idle, ack,
+						 (unsigned long) (backend.sent - acknowledged));
+}
+
+int
+main()
+{
+	for (uint32_t outstanding : {10, 100, 1000}) {
+		measure(outstanding);
+	}
+	return 0;
+}
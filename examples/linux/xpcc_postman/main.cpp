@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <functional>
+#include <map>
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/communication/xpcc/postman/dynamic_postman.hpp>
+
+// Measures how many packets per second the DynamicPostman dispatches with
+// many registered actions and events, compared to the previous std::map and
+// std::function based implementation.
+
+constexpr uint32_t Packets = 10'000'000;
+constexpr uint8_t Components = 32;
+constexpr uint8_t Actions = 16;
+constexpr uint8_t Events = 128;
+
+class Component
+{
+public:
+	void
+	action(const xpcc::ResponseHandle&, const uint32_t& payload)
+	{ sum += payload; }
+
+	void
+	event(const xpcc::Header&, const uint32_t& payload)
+	{ sum += payload; }
+
+	uint32_t sum = 0;
+};
+
+// The previous implementation
+class MapPostman
+{
+public:
+	void
+	registerEventListener(uint8_t eventId, Component *component)
+	{
+		using namespace std::placeholders;
+		eventMap.emplace(eventId, std::bind(&Component::event, component, _1, _2));
+	}
+
+	void
+	registerActionHandler(uint8_t componentId, uint8_t actionId, Component *component)
+	{
+		using namespace std::placeholders;
+		actionMap[componentId][actionId] = std::bind(&Component::action, component, _1, _2);
+	}
+
+	xpcc::Postman::DeliverInfo
+	deliverPacket(const xpcc::Header &header, const modm::SmartPointer& payload)
+	{
+		const uint32_t& value = *reinterpret_cast<const uint32_t*>(payload.getPointer());
+		if (header.destination == 0)
+		{
+			auto range = eventMap.equal_range(header.packetIdentifier);
+			if (range.first == range.second) return xpcc::Postman::NO_EVENT;
+			for (auto it = range.first; it != range.second; ++it) it->second(header, value);
+			return xpcc::Postman::OK;
+		}
+		auto component = actionMap.find(header.destination);
+		if (component == actionMap.end()) return xpcc::Postman::NO_COMPONENT;
+		auto action = component->second.find(header.packetIdentifier);
+		if (action == component->second.end()) return xpcc::Postman::NO_ACTION;
+		action->second(xpcc::ResponseHandle(header), value);
+		return xpcc::Postman::OK;
+	}
+
+private:
+	std::multimap<uint8_t, std::function<void (const xpcc::Header&, const uint32_t&)>> eventMap;
+	std::map<uint8_t, std::map<uint8_t, std::function<void (const xpcc::ResponseHandle&, const uint32_t&)>>> actionMap;
+};
+
+Component components[Components];
+
+template< class Postman >
+void
+measure(const char* name, Postman& postman)
+{
+	const uint32_t value = 1;
+	const modm::SmartPointer payload(&value);
+
+	const auto start = std::chrono::steady_clock::now();
+	uint32_t delivered = 0;
+	for (uint32_t ii = 0; ii < Packets; ++ii)
+	{
+		// alternate between actions and events of all components
+		const xpcc::Header header(xpcc::Header::Type::REQUEST, false,
+				(ii & 1) ? (1 + ii % Components) : 0, 0x80,
+				(ii & 1) ? (ii / 2) % Actions : (ii / 2) % Events);
+		delivered += (postman.deliverPacket(header, payload) == xpcc::Postman::OK);
+	}
+	const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-16s %8.2f Mpackets/s (%lu delivered)\n", name,
+						 Packets / duration.count() / 1e6, (unsigned long) delivered);
+}
+
+int
+main()
+{
+	MapPostman mapPostman;
+	xpcc::DynamicPostman dynamicPostman;
+
+	for (uint8_t component = 0; component < Components; ++component)
+	{
+		for (uint8_t action = 0; action < Actions; ++action)
+		{
+			mapPostman.registerActionHandler(1 + component, action, &components[component]);
+			dynamicPostman.registerActionHandler(1 + component, action,
+					&components[component], &Component::action);
+		}
+	}
+	for (uint8_t event = 0; event < Events; ++event)
+	{
+		mapPostman.registerEventListener(event, &components[event % Components]);
+		dynamicPostman.registerEventListener(event, &components[event % Components], &Component::event);
+	}
+
+	measure("std::map", mapPostman);
+	measure("DynamicPostman", dynamicPostman);
+
+	return 0;
+}
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -13,3 +14,5 @@
 #include "atomic/flag.hpp"
 #include "atomic/container.hpp"
 #include "atomic/queue.hpp"
+#include "atomic/spsc_queue.hpp"
+#include "atomic/mpsc_queue.hpp"
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_ATOMIC_MPSC_QUEUE_HPP
+#define MODM_ATOMIC_MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "spsc_queue.hpp"
+
+namespace modm::atomic
+{
+
+/**
+ * Lock-free multi-producer/single-consumer ring buffer.
+ *
+ * Any number of contexts may push concurrently, while only one context may
+ * pop. Each slot carries a sequence number, so that producers can reserve a
+ * slot with a single compare-and-swap and publish it independently of each
+ * other. The consumer never waits on a producer that has reserved, but not yet
+ * written its slot, it simply sees the queue as empty up to that slot.
+ *
+ * The interface is compatible with `modm::atomic::Queue` and
+ * `modm::atomic::SpscQueue`.
+ *
+ * @warning	On Cortex-M0 the compare-and-swap is emulated with an interrupt lock.
+ *
+ * @tparam	T	element type, should be trivially copyable
+ * @tparam	N	capacity, must be a power of two
+ *
+ * @ingroup	modm_architecture_atomic
+ * @author	Thomas Sommer
+ */
+template<typename T, std::size_t N>
+class MpscQueue
+{
+	static_assert(N >= 2 and std::has_single_bit(N), "MpscQueue capacity must be a power of two!");
+
+public:
+	using Index = std::size_t;
+	using Size = std::size_t;
+
+public:
+	MpscQueue()
+	{
+		for (Index ii = 0; ii < N; ++ii) {
+			buffer[ii].sequence.store(ii, std::memory_order_relaxed);
+		}
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+
+	MpscQueue&
+	operator = (const MpscQueue&) = delete;
+
+	/// Only a snapshot if called concurrently.
+	bool
+	isFull() const
+	{
+		return getSize() >= N;
+	}
+
+	bool
+	isNotFull() const { return not isFull(); }
+
+	/// Only valid when called from the consumer context.
+	bool
+	isEmpty() const
+	{
+		const Index t = tail.load(std::memory_order_relaxed);
+		return buffer[t & Mask].sequence.load(std::memory_order_acquire) != Index(t + 1);
+	}
+
+	bool
+	isNotEmpty() const { return not isEmpty(); }
+
+	static constexpr Size
+	getMaxSize() { return N; }
+
+	/// Number of reserved elements, including those which are still being
+	/// written by a producer. Only a snapshot if called concurrently.
+	Size
+	getSize() const
+	{
+		return Index(head.load(std::memory_order_acquire) -
+					 tail.load(std::memory_order_acquire));
+	}
+
+	// ------------------------------------------------------------------------
+	/// @name Producer
+	/// @{
+
+	/// May be called concurrently from any context.
+	/// @return `false` if the queue is full
+	bool
+	push(const T& value)
+	{
+		Index h = head.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell& cell = buffer[h & Mask];
+			const Index sequence = cell.sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::make_signed_t<Index>>(sequence - h);
+			if (diff == 0)
+			{
+				// slot is free, try to reserve it
+				if (head.compare_exchange_weak(h, h + 1, std::memory_order_relaxed))
+				{
+					cell.value = value;
+					cell.sequence.store(h + 1, std::memory_order_release);
+					return true;
+				}
+				// h was reloaded by compare_exchange
+			}
+			else if (diff < 0) {
+				// slot still occupied by an unconsumed value
+				return false;
+			}
+			else {
+				// another producer reserved this slot first
+				h = head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// Pushes elements one by one until the queue is full.
+	/// @return number of pushed elements
+	std::size_t
+	push(std::span<const T> values)
+	{
+		std::size_t count = 0;
+		for (const T& value : values)
+		{
+			if (not push(value)) break;
+			count++;
+		}
+		return count;
+	}
+
+	/// @}
+	// ------------------------------------------------------------------------
+	/// @name Consumer
+	/// @{
+
+	/// Oldest element, only valid if the queue is not empty.
+	const T&
+	get() const
+	{
+		return buffer[tail.load(std::memory_order_relaxed) & Mask].value;
+	}
+
+	/// Removes the oldest element, the queue must not be empty.
+	void
+	pop()
+	{
+		const Index t = tail.load(std::memory_order_relaxed);
+		// hand the slot back to the producers one lap later
+		buffer[t & Mask].sequence.store(t + N, std::memory_order_release);
+		tail.store(t + 1, std::memory_order_release);
+	}
+
+	/// Copies and removes the oldest element.
+	/// @return `false` if the queue is empty
+	bool
+	pop(T& value)
+	{
+		if (isEmpty()) return false;
+		value = get();
+		pop();
+		return true;
+	}
+
+	/// Copies and removes as many published elements as fit into `values`.
+	/// @return number of popped elements
+	std::size_t
+	pop(std::span<T> values)
+	{
+		std::size_t count = 0;
+		for (T& value : values)
+		{
+			if (not pop(value)) break;
+			count++;
+		}
+		return count;
+	}
+
+	/// @}
+
+private:
+	static constexpr Index Mask = N - 1;
+
+	struct Cell
+	{
+		std::atomic<Index> sequence;
+		T value;
+	};
+
+	alignas(detail::QueueAlignment) std::atomic<Index> head{0};
+	alignas(detail::QueueAlignment) std::atomic<Index> tail{0};
+	alignas(detail::QueueAlignment) Cell buffer[N];
+};
+
+}	// namespace modm::atomic
+
+#endif	// MODM_ATOMIC_MPSC_QUEUE_HPP
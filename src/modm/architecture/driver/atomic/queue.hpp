@@ -94,6 +94,57 @@ namespace modm
 			void
 			pop();
 
+			/**
+			 * Push up to `count` values at once.
+			 *
+			 * \returns	number of pushed values
+			 */
+			std::size_t
+			push(const T* values, std::size_t count);
+
+			/**
+			 * Copy and remove up to `count` values at once.
+			 *
+			 * \returns	number of popped values
+			 */
+			std::size_t
+			pop(T* values, std::size_t count);
+
+			/**
+			 * Access the largest contiguous block of free space.
+			 *
+			 * The producer can fill this block directly, e.g. via DMA, and
+			 * then make the values available with `commitWrite()`.
+			 * Due to the ring buffer wrap-around, there may be more free
+			 * space available after committing.
+			 *
+			 * \param[out]	data	start of the writable block
+			 * \returns	number of writable values
+			 */
+			Size
+			claimWrite(T*& data);
+
+			/// Makes `count` values of the claimed block available.
+			void
+			commitWrite(Size count);
+
+			/**
+			 * Access the largest contiguous block of stored values,
+			 * starting with the oldest one.
+			 *
+			 * The consumer can read this block directly, e.g. via DMA, and
+			 * then release it with `commitRead()`.
+			 *
+			 * \param[out]	data	start of the readable block
+			 * \returns	number of readable values
+			 */
+			Size
+			claimRead(const T*& data) const;
+
+			/// Removes `count` values of the claimed block.
+			void
+			commitRead(Size count);
+
 		private:
 			volatile Index head;
 			volatile Index tail;
@@ -14,6 +14,7 @@
 #ifndef	MODM_ATOMIC_QUEUE_IMPL_HPP
 #define	MODM_ATOMIC_QUEUE_IMPL_HPP
 
+#include <algorithm>
 #include <modm/architecture/detect.hpp>
 
 template<typename T, std::size_t N>
@@ -122,4 +123,94 @@ modm::atomic::Queue<T, N>::pop()
 	this->tail = tmptail;
 }
 
+template<typename T, std::size_t N>
+std::size_t
+modm::atomic::Queue<T, N>::push(const T* values, std::size_t count)
+{
+	std::size_t pushed = 0;
+	// at most two blocks due to the wrap-around
+	while (pushed < count)
+	{
+		T* data;
+		const std::size_t size = std::min<std::size_t>(claimWrite(data), count - pushed);
+		if (size == 0) break;
+		std::copy(values + pushed, values + pushed + size, data);
+		commitWrite(size);
+		pushed += size;
+	}
+	return pushed;
+}
+
+template<typename T, std::size_t N>
+std::size_t
+modm::atomic::Queue<T, N>::pop(T* values, std::size_t count)
+{
+	std::size_t popped = 0;
+	while (popped < count)
+	{
+		const T* data;
+		const std::size_t size = std::min<std::size_t>(claimRead(data), count - popped);
+		if (size == 0) break;
+		std::copy(data, data + size, values + popped);
+		commitRead(size);
+		popped += size;
+	}
+	return popped;
+}
+
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::Size
+modm::atomic::Queue<T, N>::claimWrite(T*& data)
+{
+	const Index tmphead = this->head;
+	const Index tmptail = this->tail;
+	data = &this->buffer[tmphead];
+
+	// one slot must stay empty to distinguish a full from an empty queue
+	if (tmphead >= tmptail) {
+		return ((tmptail == 0) ? N : (N + 1)) - tmphead;
+	}
+	return tmptail - tmphead - 1;
+}
+
+template<typename T, std::size_t N>
+void
+modm::atomic::Queue<T, N>::commitWrite(Size count)
+{
+	std::size_t tmphead = this->head + count;
+	if (tmphead >= (N+1)) {
+		tmphead -= (N+1);
+	}
+	// the values must be written before they are published
+	asm volatile ("" ::: "memory");
+	this->head = tmphead;
+}
+
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::Size
+modm::atomic::Queue<T, N>::claimRead(const T*& data) const
+{
+	const Index tmphead = this->head;
+	const Index tmptail = this->tail;
+	data = &this->buffer[tmptail];
+
+	if (tmphead >= tmptail) {
+		return tmphead - tmptail;
+	}
+	return (N + 1) - tmptail;
+}
+
+template<typename T, std::size_t N>
+void
+modm::atomic::Queue<T, N>::commitRead(Size count)
+{
+	std::size_t tmptail = this->tail + count;
+	if (tmptail >= (N+1)) {
+		tmptail -= (N+1);
+	}
+	// the values must be read before they are released
+	asm volatile ("" ::: "memory");
+	this->tail = tmptail;
+}
+
 #endif	// MODM_ATOMIC_QUEUE_IMPL_HPP
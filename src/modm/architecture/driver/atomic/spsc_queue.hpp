@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_ATOMIC_SPSC_QUEUE_HPP
+#define MODM_ATOMIC_SPSC_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <modm/architecture/detect.hpp>
+#include <modm/architecture/utils.hpp>
+
+namespace modm::atomic
+{
+
+/// @cond
+namespace detail
+{
+#ifdef MODM_OS_HOSTED
+/// Keeps indices written by different threads on different cache lines
+inline constexpr std::size_t QueueAlignment = 64;
+#else
+/// Single core targets do not suffer from false sharing
+inline constexpr std::size_t QueueAlignment = alignof(std::max_align_t);
+#endif
+}
+/// @endcond
+
+/**
+ * Lock-free single-producer/single-consumer ring buffer.
+ *
+ * The queue is safe to use between exactly one producer and exactly one
+ * consumer context, which may be an interrupt and the main loop or two
+ * threads on a hosted or multi-core target. No interrupt lock is required.
+ *
+ * The interface is compatible with `modm::atomic::Queue`, so that it can be
+ * used as a drop-in replacement for the buffers of the UART and CAN drivers.
+ * In addition, multiple elements can be pushed and popped at once.
+ *
+ * The head and tail indices run freely and are only masked when accessing the
+ * buffer, therefore all `N` slots can be used and the capacity must be a
+ * power of two. On hosted targets the indices are placed on separate cache
+ * lines to avoid false sharing between producer and consumer.
+ *
+ * @tparam	T	element type, should be trivially copyable
+ * @tparam	N	capacity, must be a power of two
+ *
+ * @ingroup	modm_architecture_atomic
+ * @author	Thomas Sommer
+ */
+template<typename T, std::size_t N>
+class SpscQueue
+{
+	static_assert(N >= 2 and std::has_single_bit(N), "SpscQueue capacity must be a power of two!");
+
+public:
+	/// Smallest index type that can count up to 2*N, so that 8-bit targets
+	/// can access small queues atomically.
+	using Index = std::conditional_t< (N <= 128), uint8_t,
+				  std::conditional_t< (N <= 32768), uint16_t, uint32_t > >;
+	using Size = std::conditional_t< (N < 256), uint8_t,
+				 std::conditional_t< (N < 65536), uint16_t, uint32_t > >;
+
+public:
+	SpscQueue() = default;
+
+	SpscQueue(const SpscQueue&) = delete;
+
+	SpscQueue&
+	operator = (const SpscQueue&) = delete;
+
+	bool
+	isFull() const
+	{
+		return Index(head.load(std::memory_order_acquire) -
+					 tail.load(std::memory_order_acquire)) >= N;
+	}
+
+	bool
+	isNotFull() const { return not isFull(); }
+
+	bool
+	isEmpty() const
+	{
+		return head.load(std::memory_order_acquire) ==
+			   tail.load(std::memory_order_acquire);
+	}
+
+	bool
+	isNotEmpty() const { return not isEmpty(); }
+
+	static constexpr Size
+	getMaxSize() { return N; }
+
+	/// Number of stored elements. Only a snapshot if called concurrently.
+	Size
+	getSize() const
+	{
+		return Index(head.load(std::memory_order_acquire) -
+					 tail.load(std::memory_order_acquire));
+	}
+
+	// ------------------------------------------------------------------------
+	/// @name Producer
+	/// @{
+
+	/// @return `false` if the queue is full
+	bool
+	push(const T& value)
+	{
+		const Index h = head.load(std::memory_order_relaxed);
+		if (Index(h - tailCache) >= N)
+		{
+			tailCache = tail.load(std::memory_order_acquire);
+			if (Index(h - tailCache) >= N) return false;
+		}
+		buffer[h & Mask] = value;
+		head.store(Index(h + 1), std::memory_order_release);
+		return true;
+	}
+
+	/// Pushes as many elements as fit into the queue.
+	/// @return number of pushed elements
+	std::size_t
+	push(std::span<const T> values)
+	{
+		const Index h = head.load(std::memory_order_relaxed);
+		std::size_t free = N - Index(h - tailCache);
+		if (free < values.size())
+		{
+			tailCache = tail.load(std::memory_order_acquire);
+			free = N - Index(h - tailCache);
+		}
+		const std::size_t count = std::min(free, values.size());
+		for (std::size_t ii = 0; ii < count; ++ii) {
+			buffer[(h + ii) & Mask] = values[ii];
+		}
+		head.store(Index(h + count), std::memory_order_release);
+		return count;
+	}
+
+	/// @}
+	// ------------------------------------------------------------------------
+	/// @name Consumer
+	/// @{
+
+	/// Oldest element, only valid if the queue is not empty.
+	const T&
+	get() const
+	{
+		return buffer[tail.load(std::memory_order_relaxed) & Mask];
+	}
+
+	/// Removes the oldest element, the queue must not be empty.
+	void
+	pop()
+	{
+		const Index t = tail.load(std::memory_order_relaxed);
+		// the cached head must never fall behind the tail
+		if (t == headCache) headCache = head.load(std::memory_order_acquire);
+		tail.store(Index(t + 1), std::memory_order_release);
+	}
+
+	/// Copies and removes the oldest element.
+	/// @return `false` if the queue is empty
+	bool
+	pop(T& value)
+	{
+		const Index t = tail.load(std::memory_order_relaxed);
+		if (t == headCache)
+		{
+			headCache = head.load(std::memory_order_acquire);
+			if (t == headCache) return false;
+		}
+		value = buffer[t & Mask];
+		tail.store(Index(t + 1), std::memory_order_release);
+		return true;
+	}
+
+	/// Copies and removes as many elements as are stored and fit into `values`.
+	/// @return number of popped elements
+	std::size_t
+	pop(std::span<T> values)
+	{
+		const Index t = tail.load(std::memory_order_relaxed);
+		std::size_t stored = Index(headCache - t);
+		if (stored < values.size())
+		{
+			headCache = head.load(std::memory_order_acquire);
+			stored = Index(headCache - t);
+		}
+		const std::size_t count = std::min(stored, values.size());
+		for (std::size_t ii = 0; ii < count; ++ii) {
+			values[ii] = buffer[(t + ii) & Mask];
+		}
+		tail.store(Index(t + count), std::memory_order_release);
+		return count;
+	}
+
+	/// @}
+
+private:
+	static constexpr Index Mask = N - 1;
+
+	// written by the producer only
+	alignas(detail::QueueAlignment) std::atomic<Index> head{0};
+	Index tailCache{0};
+
+	// written by the consumer only
+	alignas(detail::QueueAlignment) std::atomic<Index> tail{0};
+	Index headCache{0};
+
+	alignas(detail::QueueAlignment) T buffer[N];
+};
+
+}	// namespace modm::atomic
+
+#endif	// MODM_ATOMIC_SPSC_QUEUE_HPP
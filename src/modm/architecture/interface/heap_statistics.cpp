@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/heap_statistics.hpp>
+
+// Defaults for targets whose heap does not track its usage, overwritten by
+// the strong definitions of a heap implementation.
+modm_weak modm::HeapStatistics
+modm::getHeapStatistics()
+{
+	return {};
+}
+
+modm_weak void
+modm::resetHeapStatistics()
+{}
+
+modm_weak void
+modm::setHeapTraceHandler(HeapTraceHandler)
+{}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+#include <cstddef>
+#include <modm/architecture/utils.hpp>
+
+namespace modm
+{
+
+/// Usage statistics of the heap.
+/// @ingroup modm_architecture_memory
+struct HeapStatistics
+{
+	/// Number of histogram buckets: <=8, <=16, ..., <=512 and >512 bytes.
+	static constexpr uint8_t SizeClasses = 8;
+
+	std::size_t totalSize;		///< Size of all heap memories in bytes
+	std::size_t usedSize;		///< Currently allocated bytes, including rounding
+	std::size_t peakSize;		///< Maximum of `usedSize` since the last reset
+	std::size_t largestFree;	///< Largest block that can currently be allocated
+
+	uint32_t allocations;		///< Successful allocations, including reallocations
+	uint32_t frees;				///< Freed blocks, including the old block of reallocations
+	uint32_t failures;			///< Allocations that returned `nullptr`
+
+	/// Successful allocations by requested size
+	uint32_t histogram[SizeClasses];
+
+	/// @return histogram bucket of the requested size
+	static constexpr uint8_t
+	getSizeClass(std::size_t size)
+	{
+		uint8_t sizeClass = 0;
+		for (std::size_t limit = 8; size > limit and sizeClass < SizeClasses - 1; limit *= 2) {
+			sizeClass++;
+		}
+		return sizeClass;
+	}
+};
+
+/// Compact binary record of one heap operation.
+/// A reallocation is recorded as `Free` of the old followed by `Allocate` of
+/// the new address.
+/// @ingroup modm_architecture_memory
+struct modm_packed HeapTraceRecord
+{
+	enum class
+	Type : uint8_t
+	{
+		Allocate = 0,
+		Free = 1,
+		Failure = 2,
+	};
+
+	Type type;
+	uint32_t address;	///< Address of the block, zero for failures
+	uint32_t size;		///< Requested size, usable size for `Free`
+	uint32_t caller;	///< Return address of the heap function
+};
+
+/// Called for every heap operation, while the heap is locked.
+/// @ingroup modm_architecture_memory
+using HeapTraceHandler = void (*)(const HeapTraceRecord &record);
+
+/**
+ * Keeps the statistics and forwards the trace of a heap implementation.
+ *
+ * The heap implementation calls this tracker for every operation with the
+ * usable size of the block, the allocator itself provides the total size and
+ * the largest free block. It is zero initialized, so it can be used before
+ * static constructors have run.
+ *
+ * @ingroup modm_architecture_memory
+ * @author	Thomas Sommer
+ */
+class HeapTracker
+{
+public:
+	void
+	allocated(const void *ptr, std::size_t requested, std::size_t usable, const void *caller)
+	{
+		statistics.usedSize += usable;
+		if (statistics.usedSize > statistics.peakSize) {
+			statistics.peakSize = statistics.usedSize;
+		}
+		statistics.allocations++;
+		statistics.histogram[HeapStatistics::getSizeClass(requested)]++;
+		trace(HeapTraceRecord::Type::Allocate, ptr, requested, caller);
+	}
+
+	void
+	freed(const void *ptr, std::size_t usable, const void *caller)
+	{
+		statistics.usedSize -= usable;
+		statistics.frees++;
+		trace(HeapTraceRecord::Type::Free, ptr, usable, caller);
+	}
+
+	void
+	failed(std::size_t requested, const void *caller)
+	{
+		statistics.failures++;
+		trace(HeapTraceRecord::Type::Failure, nullptr, requested, caller);
+	}
+
+	/// Only `usedSize` and the counters are valid, the heap fills in the rest.
+	const HeapStatistics&
+	getStatistics() const
+	{ return statistics; }
+
+	/// Resets the counters and the histogram, the peak to the current usage.
+	void
+	reset()
+	{
+		const std::size_t used = statistics.usedSize;
+		statistics = HeapStatistics{};
+		statistics.usedSize = used;
+		statistics.peakSize = used;
+	}
+
+	/// @param	handler	`nullptr` disables tracing
+	void
+	setTraceHandler(HeapTraceHandler handler)
+	{ traceHandler = handler; }
+
+private:
+	void
+	trace(HeapTraceRecord::Type type, const void *ptr, std::size_t size, const void *caller)
+	{
+		if (traceHandler)
+		{
+			const HeapTraceRecord record{type, uint32_t(uintptr_t(ptr)), uint32_t(size),
+										 uint32_t(uintptr_t(caller))};
+			traceHandler(record);
+		}
+	}
+
+	HeapStatistics statistics;
+	HeapTraceHandler traceHandler;
+};
+
+/// @return	statistics of the heap, all zero if the heap does not support them.
+/// @ingroup modm_architecture_memory
+HeapStatistics
+getHeapStatistics();
+
+/// Resets the counters, the histogram and the peak usage to the current usage.
+/// @ingroup modm_architecture_memory
+void
+resetHeapStatistics();
+
+/// Enables the binary allocation trace, `nullptr` disables it.
+/// @ingroup modm_architecture_memory
+void
+setHeapTraceHandler(HeapTraceHandler handler);
+
+} // namespace modm
@@ -5,6 +5,7 @@
  * Copyright (c) 2010, Thorsten Lajewski
  * Copyright (c) 2012-2014, Niklas Hauser
  * Copyright (c) 2013, 2016, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -17,6 +18,9 @@
 #ifndef	XPCC_CAN_CONNECTOR_HPP
 #define	XPCC_CAN_CONNECTOR_HPP
 
+#include <chrono>
+#include <modm/architecture/interface/can_message.hpp>
+#include <modm/architecture/interface/clock.hpp>
 #include <modm/container/linked_list.hpp>
 #include "../backend_interface.hpp"
 
@@ -75,6 +79,17 @@ namespace xpcc
 		static uint8_t
 		getNumberOfFragments(uint8_t messageSize);
 
+		/// Maximum size of a fragmented message
+		static constexpr uint8_t maxFragmentedSize = 48;
+
+		/// Incomplete messages are discarded if no fragment was received
+		/// for this time.
+		static constexpr std::chrono::milliseconds reassemblyTimeout{50};
+
+		/// Number of fragmented messages, which are sent interleaved. The
+		/// receivers need a reassembly slot for each of them.
+		static constexpr uint8_t maxInterleavedMessages = 2;
+
 	protected:
 		static uint8_t messageCounter;
 	};
@@ -116,15 +131,48 @@ namespace xpcc
 	 *
 	 * Every event is send with the destination identifier \c 0x00.
 	 *
-	 * \todo timeout
+	 * Payloads with more than 8 bytes are split into fragments of 6 bytes,
+	 * each prefixed with the fragment index, the message counter and the
+	 * size of the complete payload. With CAN FD enabled, a payload of up to
+	 * 62 bytes is instead sent as a single CAN FD frame, which contains the
+	 * same two byte prefix with fragment index 0 and the complete payload.
+	 * Such frames are always accepted if the `message.buffer` option of
+	 * `modm:architecture:can` is set to 64 bytes.
+	 *
+	 * The fragments of up to `maxInterleavedMessages` fragmented messages
+	 * are sent interleaved with all other waiting messages, one frame per
+	 * message in turn, so that a short message is not blocked by a large
+	 * message queued before it. Each update sends as many frames as the
+	 * driver accepts.
+	 *
+	 * Fragmented messages are reassembled in a table of \p ReassemblySlots
+	 * preallocated entries, identified by the source and the message counter.
+	 * Memory is only allocated for completely received messages.
+	 *
+	 * An incomplete message is discarded after `reassemblyTimeout` (50 ms)
+	 * without a new fragment. If a fragment of a new message arrives while
+	 * the table is full, the entry whose last fragment is the oldest is
+	 * evicted to make room for it.
+	 *
+	 * \tparam	ReassemblySlots		Number of fragmented messages, which can be
+	 * 								received at the same time.
 	 *
 	 * \ingroup	modm_communication_xpcc_backend
 	 */
-	template <typename Driver>
+	template <typename Driver, uint8_t ReassemblySlots = 4>
 	class CanConnector : protected CanConnectorBase, public BackendInterface
 	{
 	public:
-		CanConnector(Driver *driver);
+		/// Largest payload, which can be sent in a single CAN FD frame
+		static constexpr uint8_t maxFlexibleDataSize = modm::can::Message::capacity - 2;
+
+		/**
+		 * \param	flexibleData	Send payloads with more than 8 bytes as
+		 * 				single CAN FD frames with bit rate switching. Only
+		 * 				effective with a CAN FD capable driver and 64 byte
+		 * 				CAN messages.
+		 */
+		CanConnector(Driver *driver, bool flexibleData = false);
 
 		virtual
 		~CanConnector();
@@ -164,28 +212,44 @@ namespace xpcc
 		sendMessage(const uint32_t & identifier,
 				const uint8_t *data, uint8_t size);
 
+		/// Payload is sent in a single CAN FD frame instead of fragments
+		bool
+		isFlexibleData(uint8_t messageSize) const;
+
+		/// Try to send a complete fragmented message in one CAN FD frame
+		bool
+		sendFlexibleData(const uint32_t & identifier,
+				const modm::SmartPointer& payload);
+
 		void
 		sendWaitingMessages();
 
 		bool
 		retrieveMessage();
 
+		/// Frees reassembly slots without a fragment for `reassemblyTimeout`
+		void
+		discardIncompleteMessages();
+
 	protected:
 		class SendListItem
 		{
 		public:
 			SendListItem(const uint32_t & inIdentifier,
-					const modm::SmartPointer& inPayload) :
+					const modm::SmartPointer& inPayload,
+					uint8_t messageCounter = 0) :
 				identifier(inIdentifier),
 				payload(inPayload),
-				fragmentIndex(0)
+				fragmentIndex(0),
+				counter(messageCounter)
 			{
 			}
 
 			SendListItem(const SendListItem& other) :
 				identifier(other.identifier),
 				payload(other.payload),
-				fragmentIndex(other.fragmentIndex)
+				fragmentIndex(other.fragmentIndex),
+				counter(other.counter)
 			{
 			}
 
@@ -193,6 +257,7 @@ namespace xpcc
 			modm::SmartPointer payload;
 
 			uint8_t fragmentIndex;
+			const uint8_t counter;
 
 		private:
 			SendListItem&
@@ -202,41 +267,54 @@ namespace xpcc
 		class ReceiveListItem
 		{
 		public:
-			ReceiveListItem(uint8_t size, const Header& inHeader,
-					uint8_t messageCounter = 0) :
-				header(inHeader), payload(size),
-				receivedFragments(0),
-				counter(messageCounter)
+			ReceiveListItem(uint8_t size, const Header& inHeader) :
+				header(inHeader), payload(size)
 			{
 			}
 
 			ReceiveListItem(const ReceiveListItem& other) :
-				header(other.header), payload(other.payload),
-				receivedFragments(other.receivedFragments),
-				counter(other.counter)
+				header(other.header), payload(other.payload)
 			{
 			}
 
 			Header header;
 			modm::SmartPointer payload;
 
-			uint8_t receivedFragments;
-			const uint8_t counter;
-
 		private:
 			ReceiveListItem&
 			operator = (const ReceiveListItem& other);
 		};
 
+		/// Preallocated buffer for a fragmented message
+		struct ReassemblySlot
+		{
+			Header header;
+			modm::Clock::time_point lastFragment;
+			uint8_t counter;
+			uint8_t size;
+			/// One bit per fragment, the slot is free if zero
+			uint8_t receivedFragments;
+			uint8_t data[maxFragmentedSize];
+		};
+
 		typedef modm::LinkedList< SendListItem > SendList;
 		typedef modm::LinkedList< ReceiveListItem > ReceiveList;
 
+		/// Sends the next fragment or the complete message.
+		/// \return	\b true if the message was sent completely
+		bool
+		sendNextFrame(SendListItem& message, bool& sent);
+
+		ReassemblySlot&
+		getReassemblySlot(const Header& header, uint8_t counter, uint8_t messageSize);
+
 	protected:
 		SendList sendList;
-		ReceiveList pendingMessages;
+		ReassemblySlot reassemblySlots[ReassemblySlots];
 		ReceiveList receivedMessages;
 
 		Driver *canDriver;
+		bool flexibleData;
 	};
 }
 
@@ -4,6 +4,7 @@
  * Copyright (c) 2010-2011, Georgi Grinshpun
  * Copyright (c) 2012-2014, Niklas Hauser
  * Copyright (c) 2012, 2016, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -21,43 +22,44 @@
 #include <modm/architecture/interface/can_message.hpp>
 
 // ----------------------------------------------------------------------------
-template<typename Driver>
-xpcc::CanConnector<Driver>::CanConnector(Driver *driver) :
-	canDriver(driver)
+template<typename Driver, uint8_t ReassemblySlots>
+xpcc::CanConnector<Driver, ReassemblySlots>::CanConnector(Driver *driver, bool flexibleData) :
+	reassemblySlots(), canDriver(driver),
+	flexibleData(flexibleData and modm::can::Message::capacity > 8)
 {
 }
 
-template<typename Driver>
-xpcc::CanConnector<Driver>::~CanConnector()
+template<typename Driver, uint8_t ReassemblySlots>
+xpcc::CanConnector<Driver, ReassemblySlots>::~CanConnector()
 {
 }
 
 // ----------------------------------------------------------------------------
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 bool
-xpcc::CanConnector<Driver>::isPacketAvailable() const
+xpcc::CanConnector<Driver, ReassemblySlots>::isPacketAvailable() const
 {
 	return !this->receivedMessages.isEmpty();
 }
 
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 const xpcc::Header&
-xpcc::CanConnector<Driver>::getPacketHeader() const
+xpcc::CanConnector<Driver, ReassemblySlots>::getPacketHeader() const
 {
 	return this->receivedMessages.getFront().header;
 }
 
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 const modm::SmartPointer
-xpcc::CanConnector<Driver>::getPacketPayload() const
+xpcc::CanConnector<Driver, ReassemblySlots>::getPacketPayload() const
 {
 	return this->receivedMessages.getFront().payload;
 }
 
 // ----------------------------------------------------------------------------
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 void
-xpcc::CanConnector<Driver>::sendPacket(const Header &header, modm::SmartPointer payload)
+xpcc::CanConnector<Driver, ReassemblySlots>::sendPacket(const Header &header, modm::SmartPointer payload)
 {
 	bool successful = false;
 	bool fragmented = (payload.getSize() > 8);
@@ -69,30 +71,43 @@ xpcc::CanConnector<Driver>::sendPacket(const Header &header, modm::SmartPointer
 		successful = this->sendMessage(identifier,
 				payload.getPointer(), payload.getSize());
 	}
+	else if (fragmented && this->isFlexibleData(payload.getSize()) &&
+			this->canDriver->isReadyToSend())
+	{
+		successful = this->sendFlexibleData(identifier, payload);
+	}
 
 	if (!successful)
 	{
-		// append the message to the list of waiting messages
-		this->sendList.append(SendListItem(identifier, payload));
+		// append the message to the list of waiting messages, fragmented
+		// messages get their counter now, since they are sent interleaved
+		uint8_t counter = 0;
+		if (fragmented && !this->isFlexibleData(payload.getSize()))
+		{
+			counter = this->messageCounter & 0xf0;
+			this->messageCounter += 0x10;
+		}
+		this->sendList.append(SendListItem(identifier, payload, counter));
 	}
 }
 
 // ----------------------------------------------------------------------------
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 void
-xpcc::CanConnector<Driver>::dropPacket()
+xpcc::CanConnector<Driver, ReassemblySlots>::dropPacket()
 {
 	this->receivedMessages.removeFront();
 }
 
 // ----------------------------------------------------------------------------
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 void
-xpcc::CanConnector<Driver>::update()
+xpcc::CanConnector<Driver, ReassemblySlots>::update()
 {
 	while (this->canDriver->isMessageAvailable()) {
 		this->retrieveMessage();
 	}
+	this->discardIncompleteMessages();
 	this->sendWaitingMessages();
 }
 
@@ -100,9 +115,9 @@ xpcc::CanConnector<Driver>::update()
 // protected
 // ----------------------------------------------------------------------------
 
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 bool
-xpcc::CanConnector<Driver>::sendMessage(const uint32_t & identifier,
+xpcc::CanConnector<Driver, ReassemblySlots>::sendMessage(const uint32_t & identifier,
 		const uint8_t *data, uint8_t size)
 {
 	modm::can::Message message(identifier, size);
@@ -113,31 +128,53 @@ xpcc::CanConnector<Driver>::sendMessage(const uint32_t & identifier,
 	return this->canDriver->sendMessage(message);
 }
 
-template<typename Driver>
-void
-xpcc::CanConnector<Driver>::sendWaitingMessages()
+template<typename Driver, uint8_t ReassemblySlots>
+bool
+xpcc::CanConnector<Driver, ReassemblySlots>::isFlexibleData(uint8_t messageSize) const
 {
-	if (this->sendList.isEmpty()) {
-		// no message in the queue
-		return;
-	}
-	else if (canDriver->getBusState() != Driver::BusState::Connected) {
-		// No connection to the CAN bus, drop all messages which should be send
-		while (!sendList.isEmpty()) {
-			sendList.removeFront();
-		}
-		return;
-	}
+	return (this->flexibleData && messageSize > 8 && messageSize <= maxFlexibleDataSize);
+}
 
-	SendListItem& message = this->sendList.getFront();
+template<typename Driver, uint8_t ReassemblySlots>
+bool
+xpcc::CanConnector<Driver, ReassemblySlots>::sendFlexibleData(const uint32_t & identifier,
+		const modm::SmartPointer& payload)
+{
+	const uint8_t messageSize = payload.getSize();
+
+	// same header as the first fragment, the frame is padded to the next
+	// valid CAN FD length, so the receiver needs the size of the message
+	modm::can::Message message(identifier, messageSize + 2);
+	message.setFlexibleData();
+	message.setBitRateSwitching();
+	message.data[0] = (this->messageCounter & 0xf0);
+	message.data[1] = messageSize;
+	std::memcpy(message.data + 2, payload.getPointer(), messageSize);
+
+	if (this->canDriver->sendMessage(message))
+	{
+		this->messageCounter += 0x10;
+		return true;
+	}
+	return false;
+}
 
+template<typename Driver, uint8_t ReassemblySlots>
+bool
+xpcc::CanConnector<Driver, ReassemblySlots>::sendNextFrame(SendListItem& message, bool& sent)
+{
 	uint8_t messageSize = message.payload.getSize();
-	if (messageSize > 8)
+	if (this->isFlexibleData(messageSize))
+	{
+		sent = this->sendFlexibleData(message.identifier, message.payload);
+		return sent;
+	}
+	else if (messageSize > 8)
 	{
 		// fragmented message
 		uint8_t data[8];
 
-		data[0] = message.fragmentIndex | (this->messageCounter & 0xf0);
+		data[0] = message.fragmentIndex | message.counter;
 		data[1] = messageSize; 	// size of the complete message
 
 		bool sendFinished = true;
@@ -153,31 +190,75 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 
 		memcpy(data + 2, message.payload.getPointer() + offset, fragmentSize);
 
-		if (sendMessage(message.identifier, data, fragmentSize + 2))
-		{
+		sent = sendMessage(message.identifier, data, fragmentSize + 2);
+		if (sent) {
 			message.fragmentIndex++;
-			if (sendFinished)
-			{
-				// message was the last fragment
-				// => remove it from the list
-				this->sendList.removeFront();
-				this->messageCounter += 0x10;
-			}
 		}
+		return (sent && sendFinished);
 	}
 	else
 	{
-		if (this->sendMessage(message.identifier, message.payload.getPointer(),
-				messageSize))
+		sent = this->sendMessage(message.identifier, message.payload.getPointer(),
+				messageSize);
+		return sent;
+	}
+}
+
+template<typename Driver, uint8_t ReassemblySlots>
+void
+xpcc::CanConnector<Driver, ReassemblySlots>::sendWaitingMessages()
+{
+	if (this->sendList.isEmpty()) {
+		// no message in the queue
+		return;
+	}
+	else if (canDriver->getBusState() != Driver::BusState::Connected) {
+		// No connection to the CAN bus, drop all messages which should be send
+		while (!sendList.isEmpty()) {
+			sendList.removeFront();
+		}
+		return;
+	}
+
+	// Send one frame of every waiting message in turn, until the driver
+	// does not accept any more frames.
+	while (!this->sendList.isEmpty())
+	{
+		uint8_t fragmentedMessages = 0;
+		typename SendList::iterator message = this->sendList.begin();
+		while (message != this->sendList.end())
 		{
-			this->sendList.removeFront();
+			if (!this->canDriver->isReadyToSend()) {
+				return;
+			}
+
+			// limit the number of messages the receivers have to reassemble
+			const uint8_t messageSize = message->payload.getSize();
+			if (messageSize > 8 && !this->isFlexibleData(messageSize) &&
+					++fragmentedMessages > maxInterleavedMessages)
+			{
+				++message;
+				continue;
+			}
+
+			bool sent;
+			if (this->sendNextFrame(*message, sent)) {
+				// message was sent completely => remove it from the list
+				message = this->sendList.remove(message);
+			}
+			else if (!sent) {
+				return;
+			}
+			else {
+				++message;
+			}
 		}
 	}
 }
 
-template<typename Driver>
+template<typename Driver, uint8_t ReassemblySlots>
 bool
-xpcc::CanConnector<Driver>::retrieveMessage()
+xpcc::CanConnector<Driver, ReassemblySlots>::retrieveMessage()
 {
 	modm::can::Message message;
 	if (this->canDriver->getMessage(message))
@@ -199,10 +280,27 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			const uint8_t counter = message.data[0] & 0xf0;
 			const uint8_t messageSize = message.data[1];
 
+			if (message.length > 8)
+			{
+				// CAN FD frame containing the complete message, which may
+				// be followed by padding
+				if (fragmentIndex != 0 || messageSize <= 8 ||
+						messageSize > message.length - 2)
+				{
+					// illegal format
+					return false;
+				}
+				this->receivedMessages.append(ReceiveListItem(messageSize, header));
+				std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
+						message.data + 2,
+						messageSize);
+				return true;
+			}
+
 			// calculate the number of messages need to send messageSize-bytes
 			uint8_t numberOfFragments = this->getNumberOfFragments(messageSize);
 
-			if (message.length < 3 || messageSize > 48 ||
+			if (message.length < 3 || messageSize > maxFragmentedSize ||
 					fragmentIndex >= numberOfFragments)
 			{
 				// illegal format:
@@ -231,46 +329,32 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 				return false;
 			}
 
-			// Check if other parts of this message are already in the
-			// list of receiving messages.
-			typename ReceiveList::iterator packet = this->pendingMessages.begin();
-			for ( ; packet != this->pendingMessages.end(); ++packet)
-			{
-				if (packet->header == header &&
-					packet->counter == counter)
-				{
-					break;
-				}
-			}
-
-			if (packet == this->pendingMessages.end()) {
-				// message not found => first part of this message,
-				// prepend it to the list
-				this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter));
-				packet = this->pendingMessages.begin();
-			}
+			ReassemblySlot& slot = this->getReassemblySlot(header, counter, messageSize);
 
 			// create a marker for the currently received fragment and
 			// test if the fragment was already received
 			const uint8_t currentFragment = (1 << fragmentIndex);
-			if (currentFragment & packet->receivedFragments)
+			if (currentFragment & slot.receivedFragments)
 			{
 				// error: received fragment twice -> most likely a new message -> delete the old one
 				//MODM_LOG_WARNING << "lost fragment" << modm::flush;
-				packet->receivedFragments = 0;
+				slot.receivedFragments = 0;
 			}
-			packet->receivedFragments |= currentFragment;
+			slot.receivedFragments |= currentFragment;
+			slot.lastFragment = modm::Clock::now();
 
-			std::memcpy(packet->payload.getPointer() + offset,
+			std::memcpy(slot.data + offset,
 					message.data + 2,
 					message.length - 2);
 
 			// test if this was the last segment, otherwise we have to wait
 			// for more messages
-			if (modm::bitCount(packet->receivedFragments) == numberOfFragments)
+			if (modm::bitCount(slot.receivedFragments) == numberOfFragments)
 			{
-				this->receivedMessages.append(*packet);
-				this->pendingMessages.remove(packet);
+				this->receivedMessages.append(ReceiveListItem(messageSize, header));
+				std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
+						slot.data, messageSize);
+				slot.receivedFragments = 0;
 			}
 		}
 
@@ -280,3 +364,56 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 		return false;
 	}
 }
+
+template<typename Driver, uint8_t ReassemblySlots>
+typename xpcc::CanConnector<Driver, ReassemblySlots>::ReassemblySlot&
+xpcc::CanConnector<Driver, ReassemblySlots>::getReassemblySlot(
+		const Header& header, uint8_t counter, uint8_t messageSize)
+{
+	ReassemblySlot* free = nullptr;
+	ReassemblySlot* oldest = &this->reassemblySlots[0];
+	for (ReassemblySlot& slot : this->reassemblySlots)
+	{
+		if (slot.receivedFragments == 0)
+		{
+			if (free == nullptr) {
+				free = &slot;
+			}
+			continue;
+		}
+		if (slot.header.source == header.source && slot.counter == counter)
+		{
+			if (slot.header == header && slot.size == messageSize) {
+				return slot;
+			}
+			// same counter reused for a different message, the old one
+			// can not be completed anymore
+			free = &slot;
+			break;
+		}
+		if (slot.lastFragment < oldest->lastFragment) {
+			oldest = &slot;
+		}
+	}
+
+	// if the table is full, replace the message with the oldest fragment
+	ReassemblySlot& slot = free ? *free : *oldest;
+	slot.header = header;
+	slot.counter = counter;
+	slot.size = messageSize;
+	slot.receivedFragments = 0;
+	return slot;
+}
+
+template<typename Driver, uint8_t ReassemblySlots>
+void
+xpcc::CanConnector<Driver, ReassemblySlots>::discardIncompleteMessages()
+{
+	const modm::Clock::time_point now = modm::Clock::now();
+	for (ReassemblySlot& slot : this->reassemblySlots)
+	{
+		if (slot.receivedFragments && (now - slot.lastFragment) > reassemblyTimeout) {
+			slot.receivedFragments = 0;
+		}
+	}
+}
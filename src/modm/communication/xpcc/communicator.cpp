@@ -32,7 +32,7 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier)
 			actionIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, std::move(payload));
 }
 
 void
@@ -44,7 +44,7 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier, Respo
 			actionIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload, responseCallback);
+	this->dispatcher.addMessage(header, std::move(payload), responseCallback);
 }
 
 // ----------------------------------------------------------------------------
@@ -57,7 +57,7 @@ xpcc::Communicator::publishEvent(uint8_t eventIdentifier)
 			eventIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, std::move(payload));
 }
 
 // ----------------------------------------------------------------------------
@@ -70,7 +70,7 @@ xpcc::Communicator::sendResponse(const ResponseHandle& handle)
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addResponse(header, payload);
+	this->dispatcher.addResponse(header, std::move(payload));
 }
 
 void
@@ -82,5 +82,5 @@ xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle)
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addResponse(header, payload);
+	this->dispatcher.addResponse(header, std::move(payload));
 }
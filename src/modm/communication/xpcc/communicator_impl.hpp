@@ -31,7 +31,7 @@ xpcc::Communicator::callAction(uint8_t receiver,
 
 	modm::SmartPointer payload(&data);
 
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, std::move(payload));
 }
 
 // ----------------------------------------------------------------------------
@@ -47,7 +47,7 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier,
 
 	modm::SmartPointer payload(&data);
 
-	this->dispatcher.addMessage(header, payload, responseCallback);
+	this->dispatcher.addMessage(header, std::move(payload), responseCallback);
 }
 
 // ----------------------------------------------------------------------------
@@ -61,7 +61,7 @@ xpcc::Communicator::publishEvent(uint8_t eventIdentifier, const T& data)
 			eventIdentifier);
 
 	modm::SmartPointer payload(&data);	// no metadata is sent with Events
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, std::move(payload));
 }
 
 // ----------------------------------------------------------------------------
@@ -75,7 +75,7 @@ xpcc::Communicator::sendResponse(const ResponseHandle& handle, const T& data)
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload(&data);
-	this->dispatcher.addResponse(header, payload);
+	this->dispatcher.addResponse(header, std::move(payload));
 }
 
 template<typename T>
@@ -88,5 +88,5 @@ xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle, const T&
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload(&data);
-	this->dispatcher.addResponse(header, payload);
+	this->dispatcher.addResponse(header, std::move(payload));
 }
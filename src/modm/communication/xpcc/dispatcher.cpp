@@ -5,6 +5,7 @@
  * Copyright (c) 2012-2013, 2015, 2017-2018, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  * Copyright (c) 2016, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -22,10 +23,31 @@
 #define MODM_LOG_LEVEL modm::log::INFO
 
 xpcc::Dispatcher::Dispatcher(BackendInterface *backend_, Postman* postman_) :
-	backend(backend_), postman(postman_)
+	backend(backend_), postman(postman_),
+	currentTick(getWheelTick(modm::Clock::now()))
 {
 }
 
+xpcc::Dispatcher::~Dispatcher()
+{
+	while (this->transmitQueue.front) {
+		this->release(this->transmitQueue.front);
+	}
+	for (EntryQueue &slot : this->timerWheel)
+	{
+		while (slot.front) {
+			this->release(slot.front);
+		}
+	}
+	// only entries waiting for a response are left
+	for (MatchList &bucket : this->matchIndex)
+	{
+		while (bucket.front) {
+			this->release(bucket.front);
+		}
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::update()
@@ -57,6 +79,9 @@ xpcc::Dispatcher::update()
 
 	// check if there are packets to send
 	this->handleWaitingMessages();
+
+	// check if there are packets to resend
+	this->handleExpiredMessages();
 }
 
 void
@@ -96,61 +121,122 @@ xpcc::Dispatcher::Entry::headerFits(const Header& inHeader) const
 			(inHeader.packetIdentifier == this->header.packetIdentifier));
 }
 
+xpcc::Dispatcher::Entry *
+xpcc::Dispatcher::findEntry(const Header& header)
+{
+	// the source of the acknowledge or response is the destination of
+	// the message which is waiting for it
+	MatchList &bucket = this->matchIndex[getMatchBucket(header.source, header.packetIdentifier)];
+	for (Entry *entry = bucket.front; entry; entry = entry->nextMatch)
+	{
+		if (entry->headerFits(header)) {
+			return entry;
+		}
+	}
+	return nullptr;
+}
+
+void
+xpcc::Dispatcher::enqueue(Entry *entry, bool prepend)
+{
+	if (prepend) {
+		this->transmitQueue.prepend(entry);
+	} else {
+		this->transmitQueue.append(entry);
+	}
+
+	// events are never acknowledged
+	if (entry->header.destination != 0)
+	{
+		this->matchIndex[getMatchBucket(entry->header.destination,
+				entry->header.packetIdentifier)].append(entry);
+	}
+}
+
+void
+xpcc::Dispatcher::arm(Entry *entry)
+{
+	entry->state = Entry::State::WaitForACK;
+	entry->expiry = modm::Clock::now() + acknowledgeTimeout;
+	this->timerWheel[getWheelTick(entry->expiry) & (wheelSlots - 1)].append(entry);
+}
+
+void
+xpcc::Dispatcher::detach(Entry *entry)
+{
+	switch (entry->state)
+	{
+		case Entry::State::TransmissionPending:
+			this->transmitQueue.remove(entry);
+			break;
+		case Entry::State::WaitForACK:
+			this->timerWheel[getWheelTick(entry->expiry) & (wheelSlots - 1)].remove(entry);
+			break;
+		case Entry::State::WaitForResponse:
+			break;
+	}
+}
+
+void
+xpcc::Dispatcher::release(Entry *entry)
+{
+	this->detach(entry);
+	if (entry->header.destination != 0)
+	{
+		this->matchIndex[getMatchBucket(entry->header.destination,
+				entry->header.packetIdentifier)].remove(entry);
+	}
+	delete entry;
+}
+
 bool
 xpcc::Dispatcher::handlePacket(const Header& header,
 		const modm::SmartPointer& payload)
 {
 	bool ack = false;
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	Entry *entry = this->findEntry(header);
+	if (entry == nullptr) {
+		return ack;
+	}
+
+	if (entry->type == Entry::Type::Default)
+	{
+		// waiting for ack, no response can be handled
+		this->release(entry);
+	}
+	else if (entry->type == Entry::Type::Callback)
 	{
-		if (entry->type == Entry::Type::Default)
+		// entry actual has to be marked acknowledged if acknowleded
+		// request
+		if (header.type == Header::Type::REQUEST)
 		{
-			// waiting for ack, no response can be handled
-			if (entry->headerFits(header))
+			// Must be an acknowledge otherwise there is an error in
+			// communication, cause no requests can be handled here
+			if (header.isAcknowledge)
 			{
-				entry = this->entries.remove(entry);
-				return ack;
+				// make sure no requests passed here
+				this->detach(entry);
+				entry->state = Entry::State::WaitForResponse;
 			}
 		}
-		else if (entry->type == Entry::Type::Callback)
+		else
 		{
-			if (entry->headerFits(header))
-			{
-				// entry actual has to be marked acknowledged if acknowleded
-				// request
-				if (header.type == Header::Type::REQUEST)
-				{
-					// Must be an acknowledge otherwise there is an error in
-					// communication, cause no requests can be handled here
-					if (header.isAcknowledge)
-					{
-						// make sure no requests passed here
-						entry->state = Entry::State::WaitForResponse;
-					}
-				}
-				else
-				{
-					// response or negative response
-					if (!header.isAcknowledge) {
-						entry->callbackResponse(header, payload);
-						ack = true;
-					} else {
-						// cannot happen, since responses with callbacks are
-						// not possible
-					}
-					entry = this->entries.remove(entry);
-				}
-				return ack;
+			// response or negative response
+			if (!header.isAcknowledge) {
+				entry->callbackResponse(header, payload);
+				ack = true;
+			} else {
+				// cannot happen, since responses with callbacks are
+				// not possible
 			}
+			this->release(entry);
 		}
-		++entry;
 	}
 	return ack;
 }
 
-xpcc::Dispatcher::EntryIterator
-xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
+xpcc::Dispatcher::Entry *
+xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry)
 {
 	// to one component on board inner component
 	// send message also out, so it is possible to log
@@ -162,16 +248,18 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		postman->deliverPacket(entry->header, entry->payload);
 		// TODO handle postman errors?
 
+		// the delivery may have appended new messages
+		Entry *next = entry->next;
 		if (entry->type == Entry::Type::Callback)
 		{
 			// TODO timer for RESPONSES not handeled yet
+			this->detach(entry);
 			entry->state = Entry::State::WaitForResponse;
-			entry->time.restart(responseTimeout);
-			return entry;
 		}
 		else {
-			return this->entries.remove(entry);
+			this->release(entry);
 		}
+		return next;
 	}
 	else
 	{
@@ -179,12 +267,9 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		//
 		// we need to find the coresponding REQUEST and delete it as well
 		// as the RESPONSE
-		//
-		// responses are inserted at front, requests at end,
-		// thus we only need to search after the RESPONSE
-
-		auto req = entry;
-		for (++req; req != this->entries.end(); ++req)
+		MatchList &bucket = this->matchIndex[getMatchBucket(
+				entry->header.source, entry->header.packetIdentifier)];
+		for (Entry *req = bucket.front; req; req = req->nextMatch)
 		{
 			if (req->header.type == Header::Type::REQUEST and
 			    // must be State::WaitForResponse
@@ -195,106 +280,120 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 				{
 					req->callbackResponse(entry->header, entry->payload);
 				}
-				this->entries.remove(req);
+				this->release(req);
 				break;
 			}
 		}
 
-		return this->entries.remove(entry);
+		Entry *next = entry->next;
+		this->release(entry);
+		return next;
 	}
-
-	return entry;
 }
 
 void
 xpcc::Dispatcher::handleWaitingMessages()
 {
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	Entry *entry = this->transmitQueue.front;
+	while (entry)
 	{
-		if (entry->state == Entry::State::TransmissionPending)
+		if (entry->header.destination == 0)
 		{
-			if (entry->header.destination == 0)
-			{
-				// event
-				postman->deliverPacket(entry->header, entry->payload);
-				backend->sendPacket(entry->header, entry->payload);
+			// event
+			postman->deliverPacket(entry->header, entry->payload);
+			backend->sendPacket(entry->header, entry->payload);
 
-				entry = this->entries.remove(entry);
-				continue;
+			Entry *next = entry->next;
+			this->release(entry);
+			entry = next;
+		}
+		else
+		{
+			// action or response
+			if (postman->isComponentAvailable(entry->header.destination))
+			{
+				entry = sendMessageToInnerComponent(entry);
 			}
 			else
 			{
-				// action or response
-				if (postman->isComponentAvailable(entry->header.destination))
-				{
-					entry = sendMessageToInnerComponent(entry);
-					continue;
-				}
-				else
-				{
-					// destination not on board, message has to be sent
-					// out to the backend
-					backend->sendPacket(entry->header, entry->payload);
-
-					entry->state = Entry::State::WaitForACK;
-					entry->time.restart(acknowledgeTimeout);
+				// destination not on board, message has to be sent
+				// out to the backend
+				backend->sendPacket(entry->header, entry->payload);
 
-					++entry;
-				}
+				Entry *next = entry->next;
+				this->transmitQueue.remove(entry);
+				this->arm(entry);
+				entry = next;
 			}
 		}
-		else if (entry->state == Entry::State::WaitForACK)
+	}
+}
+
+void
+xpcc::Dispatcher::handleExpiredMessages()
+{
+	const modm::Clock::time_point now = modm::Clock::now();
+	const uint32_t tick = getWheelTick(now);
+
+	// Visit every slot that passed since the last call, including the
+	// current one, which may still contain entries expiring later in this
+	// tick. After a long pause every slot is visited once.
+	uint32_t slots = tick - this->currentTick + 1;
+	if (slots > wheelSlots) {
+		slots = wheelSlots;
+	}
+	for (uint32_t ii = 0; ii < slots; ++ii)
+	{
+		EntryQueue &slot = this->timerWheel[(this->currentTick + ii) & (wheelSlots - 1)];
+		Entry *entry = slot.front;
+		while (entry)
 		{
-			if (entry->time.isExpired())
+			Entry *next = entry->next;
+			if (static_cast<int32_t>((now - entry->expiry).count()) >= 0)
 			{
 				if (entry->tries >= 2)
 				{
-                    Header header = entry->header;
-                    header.type = Header::Type::TIMEOUT;
-                    entry->callbackResponse(header, entry->payload);
-					entry = this->entries.remove(entry);
-					continue;
+					Header header = entry->header;
+					header.type = Header::Type::TIMEOUT;
+					entry->callbackResponse(header, entry->payload);
+					this->release(entry);
 				}
 				else
 				{
 					backend->sendPacket(entry->header, entry->payload);
 
 					entry->tries++;
-					entry->time.restart(acknowledgeTimeout);
+					slot.remove(entry);
+					this->arm(entry);
 				}
 			}
-
-			++entry;
-		}
-		else
-		{
 			// WAIT_FOR_RESPONSE
-			// Responses stay in the queue for ever if no response ever
-			// comes. This may have to be changed.
-			++entry;
+			// Responses are not in the timer wheel and stay in the index
+			// for ever if no response ever comes. This may have to be changed.
+			entry = next;
 		}
 	}
+	this->currentTick = tick;
 }
 
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::addMessage(const Header& header,
-		modm::SmartPointer& smartPayload)
+		modm::SmartPointer&& smartPayload)
 {
-	this->entries.append(Entry(header, smartPayload));
+	this->enqueue(new Entry(header, std::move(smartPayload)));
 }
 
 void
 xpcc::Dispatcher::addMessage(const Header& header,
-		modm::SmartPointer& smartPayload, ResponseCallback& responseCallback)
+		modm::SmartPointer&& smartPayload, ResponseCallback& responseCallback)
 {
-	this->entries.append(Entry(header, smartPayload, responseCallback));
+	this->enqueue(new Entry(header, std::move(smartPayload), responseCallback));
 }
 
 void
 xpcc::Dispatcher::addResponse(const Header& header,
-		modm::SmartPointer& smartPayload)
+		modm::SmartPointer&& smartPayload)
 {
 	// it makes response more important, than requests
 	// it prevents intern loops. Since it is possible to give a response while
@@ -305,5 +404,5 @@ xpcc::Dispatcher::addResponse(const Header& header,
 	// but now responses are handled in reverse order that's not good
 	// what to do? a separator between responses and requests possible?
 
-	this->entries.prepend(Entry(header, smartPayload));
+	this->enqueue(new Entry(header, std::move(smartPayload)), true);
 }
@@ -22,8 +22,10 @@
 #include "../backend/header.hpp"
 #include "../response_handle.hpp"
 
-#include <map>
-#include <functional>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 namespace xpcc
 {
@@ -36,6 +38,10 @@ namespace xpcc
  *
  * On hosted however, this class allows for much easier registering of callbacks.
  *
+ * Callbacks are stored in tables directly indexed by the packet identifier and
+ * destination component, so that dispatching a packet does not depend on the
+ * number of registered callbacks.
+ *
  * @ingroup	modm_communication_xpcc
  * @author	Niklas Hauser
  */
@@ -72,51 +78,93 @@ public:
 						  void (C::*memberFunction)(const ResponseHandle&, const P&));
 
 private:
-	typedef std::function<void (const Header&, const uint8_t&)> EventCallback;
-	typedef std::function<void (const Header&)> EventCallbackSimple;
-
-	typedef std::function<void (const ResponseHandle&, const uint8_t&)> ActionCallback;
-	typedef std::function<void (const ResponseHandle&)> ActionCallbackSimple;
-
-	class EventListener
+	/**
+	 * Non-allocating delegate to a member function of a component.
+	 *
+	 * The member function pointer is stored by value together with a
+	 * trampoline function, which restores its type before calling it.
+	 */
+	template< typename Argument >
+	class Delegate
 	{
-		EventCallback call;
-		EventCallbackSimple callSimple;
-		int8_t hasPayload;
+		typedef void (*Invoke)(void *object, const void *function,
+							   const Argument& argument, const uint8_t *payload);
 
 	public:
-		EventListener();
-		EventListener(EventCallback call);
-		EventListener(EventCallbackSimple call);
-
-		void operator()(const Header& header, const modm::SmartPointer& payload) const;
+		Delegate() :
+			object(nullptr), invoke(nullptr), function{}
+		{
+		}
+
+		template< class C, typename P >
+		Delegate(C *componentObject, void (C::*memberFunction)(const Argument&, const P&)) :
+			object(componentObject), invoke(&call<C, P>)
+		{
+			store(memberFunction);
+		}
+
+		template< class C >
+		Delegate(C *componentObject, void (C::*memberFunction)(const Argument&)) :
+			object(componentObject), invoke(&callSimple<C>)
+		{
+			store(memberFunction);
+		}
+
+		inline bool
+		isCallable() const
+		{
+			return invoke != nullptr;
+		}
+
+		inline void
+		operator()(const Argument& argument, const modm::SmartPointer& payload) const
+		{
+			invoke(object, function, argument, payload.getPointer());
+		}
+
+	private:
+		template< typename F >
+		void
+		store(F memberFunction)
+		{
+			static_assert(sizeof(F) <= sizeof(function), "Member function pointer too large!");
+			std::memcpy(function, &memberFunction, sizeof(F));
+		}
+
+		template< class C, typename P >
+		static void
+		call(void *object, const void *function, const Argument& argument, const uint8_t *payload)
+		{
+			void (C::*memberFunction)(const Argument&, const P&);
+			std::memcpy(&memberFunction, function, sizeof(memberFunction));
+			(static_cast<C *>(object)->*memberFunction)(argument, *reinterpret_cast<const P *>(payload));
+		}
+
+		template< class C >
+		static void
+		callSimple(void *object, const void *function, const Argument& argument, const uint8_t *)
+		{
+			void (C::*memberFunction)(const Argument&);
+			std::memcpy(&memberFunction, function, sizeof(memberFunction));
+			(static_cast<C *>(object)->*memberFunction)(argument);
+		}
+
+		void *object;
+		Invoke invoke;
+		alignas(void *) uint8_t function[2 * sizeof(void *)];
 	};
 
-	class ActionHandler
-	{
-		ActionCallback call;
-		ActionCallbackSimple callSimple;
-		int8_t hasPayload;
-
-	public:
-		ActionHandler();
-		ActionHandler(ActionCallback call);
-		ActionHandler(ActionCallbackSimple call);
-
-		void operator()(const ResponseHandle& response, const modm::SmartPointer& payload) const;
-	};
-
-	/// packetIdentifier -> callback
-	typedef std::multimap<uint8_t, EventListener> EventMap;
+	typedef Delegate<Header> EventListener;
+	typedef Delegate<ResponseHandle> ActionHandler;
 
 	/// packetIdentifier -> callback
-	typedef std::map<uint8_t, ActionHandler > CallbackMap;
-	///< destination -> callbackMap
-	typedef std::map<uint8_t, CallbackMap > ActionMap;
+	typedef std::array<ActionHandler, 256> ActionTable;
 
 private:
-	EventMap eventMap;
-	ActionMap actionMap;
+	/// packetIdentifier -> callbacks, a packet is dispatched with a single lookup
+	std::array<std::vector<EventListener>, 256> eventTable;
+	/// destination -> callbacks, only allocated for registered components
+	std::array<std::unique_ptr<ActionTable>, 256> actionTable;
 };
 
 }	// namespace xpcc
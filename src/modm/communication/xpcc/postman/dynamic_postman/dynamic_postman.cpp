@@ -28,38 +28,29 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 	if (header.destination == 0)
 	{
 		// EVENT
-		EventMap::const_iterator lowerBound(this->eventMap.lower_bound(header.packetIdentifier));
-		EventMap::const_iterator upperBound(this->eventMap.upper_bound(header.packetIdentifier));
-		if (lowerBound != upperBound) {
-			do {
-				lowerBound->second(header, payload);
-				lowerBound++;
-			}
-			while (lowerBound != upperBound);
-			return OK;
+		const std::vector<EventListener>& listeners = this->eventTable[header.packetIdentifier];
+		if (listeners.empty()) {
+			return NO_EVENT;
 		}
-		return NO_EVENT;
+		for (const EventListener& listener : listeners) {
+			listener(header, payload);
+		}
+		return OK;
 	}
 	else
 	{
 		// REQUEST
-		ActionMap::const_iterator iterDestination(this->actionMap.find(header.destination));
-		if (iterDestination != this->actionMap.end())
-		{
-			CallbackMap::const_iterator iterCallback(iterDestination->second.find(header.packetIdentifier));
-			if (iterCallback != iterDestination->second.end())
-			{
-				xpcc::ResponseHandle response(header);
-				iterCallback->second(response, payload);
-				return OK;
-			}
-			else {
-				return NO_ACTION;
-			}
-		}
-		else {
+		const ActionTable* actions = this->actionTable[header.destination].get();
+		if (actions == nullptr) {
 			return NO_COMPONENT;
 		}
+		const ActionHandler& handler = (*actions)[header.packetIdentifier];
+		if (not handler.isCallable()) {
+			return NO_ACTION;
+		}
+		xpcc::ResponseHandle response(header);
+		handler(response, payload);
+		return OK;
 	}
 }
 
@@ -67,61 +58,5 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 bool
 xpcc::DynamicPostman::isComponentAvailable(uint8_t component) const
 {
-	return (this->actionMap.find(component) != this->actionMap.end());
-}
-
-// ----------------------------------------------------------------------------
-xpcc::DynamicPostman::EventListener::EventListener() :
-		hasPayload(-1)
-{
-}
-
-xpcc::DynamicPostman::EventListener::EventListener(EventCallback call) :
-		call(call), hasPayload(1)
-{
-}
-
-xpcc::DynamicPostman::EventListener::EventListener(EventCallbackSimple call) :
-		callSimple(call), hasPayload(0)
-{
-}
-
-void
-xpcc::DynamicPostman::EventListener::operator()(
-		const Header& header,
-		const modm::SmartPointer& payload) const
-{
-	if (hasPayload > 0) {
-		call(header, *(payload.getPointer()));
-	} else if (hasPayload == 0) {
-		callSimple(header);
-	}
-}
-
-// ----------------------------------------------------------------------------
-xpcc::DynamicPostman::ActionHandler::ActionHandler() :
-		hasPayload(-1)
-{
-}
-
-xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallback call) :
-		call(call), hasPayload(1)
-{
-}
-
-xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallbackSimple call) :
-		callSimple(call), hasPayload(0)
-{
-}
-
-void
-xpcc::DynamicPostman::ActionHandler::operator()(
-		const ResponseHandle& response,
-		const modm::SmartPointer& payload) const
-{
-	if (hasPayload > 0) {
-		call(response, *(payload.getPointer()));
-	} else if (hasPayload == 0) {
-		callSimple(response);
-	}
+	return (this->actionTable[component] != nullptr);
 }
@@ -21,20 +21,7 @@ xpcc::DynamicPostman::registerEventListener(const uint8_t eventId,
 		C *componentObject,
 		void (C::*memberFunction)(const Header&))
 {
-	using namespace std::placeholders;
-
-	eventMap.insert(
-			std::pair<uint8_t, EventListener>(
-					eventId,
-					EventListener(static_cast<EventCallbackSimple>(
-							std::bind(
-									memberFunction,
-									componentObject,
-									_1)
-					))
-			)
-	);
-
+	eventTable[eventId].emplace_back(componentObject, memberFunction);
 	return true;
 }
 
@@ -44,21 +31,7 @@ xpcc::DynamicPostman::registerEventListener(const uint8_t eventId,
 		C *componentObject,
 		void (C::*memberFunction)(const Header&, const P&))
 {
-	using namespace std::placeholders;
-	typedef void (C::*Function)(const Header&, const uint8_t&);
-
-	eventMap.insert(
-			std::pair<uint8_t, EventListener>(
-					eventId,
-					EventListener(
-							std::bind(
-									reinterpret_cast<Function>(memberFunction),
-									componentObject,
-									_1, _2)
-					)
-			)
-	);
-
+	eventTable[eventId].emplace_back(componentObject, memberFunction);
 	return true;
 }
 
@@ -69,15 +42,10 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 		C *componentObject,
 		void (C::*memberFunction)(const ResponseHandle&))
 {
-	using namespace std::placeholders;
-
-	actionMap[componentId][actionId] = ActionHandler(static_cast<ActionCallbackSimple>(
-			std::bind(
-					memberFunction,
-					componentObject,
-					_1)
-	));
-
+	if (not actionTable[componentId]) {
+		actionTable[componentId] = std::make_unique<ActionTable>();
+	}
+	(*actionTable[componentId])[actionId] = ActionHandler(componentObject, memberFunction);
 	return true;
 }
 
@@ -88,15 +56,9 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 		C *componentObject,
 		void (C::*memberFunction)(const ResponseHandle&, const P&))
 {
-	using namespace std::placeholders;
-	typedef void (C::*Function)(const ResponseHandle&, const uint8_t&);
-
-	actionMap[componentId][actionId] = ActionHandler(
-			std::bind(
-					reinterpret_cast<Function>(memberFunction),
-					componentObject,
-					_1, _2)
-	);
-
+	if (not actionTable[componentId]) {
+		actionTable[componentId] = std::make_unique<ActionTable>();
+	}
+	(*actionTable[componentId])[actionId] = ActionHandler(componentObject, memberFunction);
 	return true;
 }
@@ -4,6 +4,7 @@
  * Copyright (c) 2009-2010, Martin Rosekeit
  * Copyright (c) 2012, 2015-2016, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -30,18 +31,30 @@ namespace modm
 	 * \brief 	Container which destroys itself when the last
 	 * 			copy is destroyed.
 	 *
-	 * This container saves a copy of the given data on the heap. It
+	 * This container saves a copy of the given data in a memory block. It
 	 * provides the functionality of a shared pointer => pointer object
 	 * records when it is copied - when the last copy is destroyed the
-	 * memory is released.
+	 * memory is released. Copies share the same block, the data itself is
+	 * only copied once on construction.
+	 *
+	 * The blocks are taken from two fixed size pools, whose block sizes and
+	 * counts are configured with the `modm:container:smart_pointer.*`
+	 * options. Only if the data does not fit or the pool is exhausted, the
+	 * block is allocated on the heap. An empty payload never allocates.
+	 *
+	 * \warning	Neither the reference count nor the pools are protected
+	 * 			against concurrent access from interrupts or threads.
 	 *
 	 * \ingroup modm_container
 	 */
 	class SmartPointer
 	{
 	public:
-		/// default constructor with empty payload
-		SmartPointer();
+		/// default constructor with empty payload, does not allocate
+		SmartPointer() :
+			ptr(emptyBlock)
+		{
+		}
 
 		/**
 		 * \brief	Allocates memory from the given size
@@ -55,16 +68,32 @@ namespace modm
 		// between constructor and copy constructor!
 		template<typename T>
 		explicit SmartPointer(const T *data)
-		: ptr(new uint8_t[sizeof(T) + 4])
+		: ptr(allocate(sizeof(T)))
 		{
-			ptr[0] = 1;
-			*reinterpret_cast<uint16_t*>(ptr + 2) = sizeof(T);
 			std::memcpy(ptr + 4, data, sizeof(T));
 		}
 
-		SmartPointer(const SmartPointer& other);
+		SmartPointer(const SmartPointer& other) :
+			ptr(other.ptr)
+		{
+			if (ptr[1] != Empty) {
+				ptr[0]++;
+			}
+		}
 
-		~SmartPointer();
+		/// Takes over the data of `other`, which is left empty.
+		SmartPointer(SmartPointer&& other) :
+			ptr(other.ptr)
+		{
+			other.ptr = emptyBlock;
+		}
+
+		~SmartPointer()
+		{
+			if (ptr[1] != Empty and --ptr[0] == 0) {
+				release(ptr);
+			}
+		}
 
 		inline const uint8_t *
 		getPointer() const
@@ -124,6 +153,29 @@ namespace modm
 		SmartPointer&
 		operator = (const SmartPointer& other);
 
+		SmartPointer&
+		operator = (SmartPointer&& other);
+
+	protected:
+		/// Memory block layout:
+		/// [0] reference count, [1] block type, [2..3] size, [4...] data
+		enum BlockType : uint8_t
+		{
+			Heap = 0,
+			Small = 1,
+			Large = 2,
+			Empty = 0xff,
+		};
+
+		static uint8_t *
+		allocate(uint16_t size);
+
+		static void
+		release(uint8_t *ptr);
+
+		/// Shared by all empty payloads, never reference counted
+		static uint8_t emptyBlock[5];
+
 	protected:
 		uint8_t * ptr;
 
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "deferred.hpp"
+
+#include <cstring>
+
+namespace
+{
+
+constexpr const char* levelNames[] =
+{
+	"Debug:   ",
+	"Info:    ",
+	"Warning: ",
+	"Error:   ",
+};
+
+struct Argument
+{
+	modm::log::DeferredType type;
+	int64_t integer;
+	double floating;
+	char string[modm::log::DeferredRecord::ArgumentSize];
+};
+
+/// Decodes the arguments of a record one after the other
+class ArgumentReader
+{
+public:
+	ArgumentReader(const modm::log::DeferredRecord& record) :
+		data(record.arguments), end(record.arguments + record.length)
+	{}
+
+	bool
+	next(Argument& argument)
+	{
+		using Type = modm::log::DeferredType;
+		if (data >= end) {
+			return false;
+		}
+		argument.type = Type(*data++);
+		switch (argument.type)
+		{
+			case Type::Signed:
+				return setInteger<int32_t>(argument);
+			case Type::Unsigned:
+				return setInteger<uint32_t>(argument);
+			case Type::Signed64:
+				return setInteger<int64_t>(argument);
+			case Type::Unsigned64:
+				return setInteger<uint64_t>(argument);
+			case Type::Float:
+				return setFloat<float>(argument);
+			case Type::Double:
+				return setFloat<double>(argument);
+			case Type::String:
+			{
+				if (data >= end) {
+					return false;
+				}
+				const std::size_t length = *data++;
+				if (data + length > end) {
+					return false;
+				}
+				std::memcpy(argument.string, data, length);
+				argument.string[length] = '\0';
+				data += length;
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+	template< typename T >
+	bool
+	read(T& value)
+	{
+		if (data + sizeof(T) > end) {
+			return false;
+		}
+		std::memcpy(&value, data, sizeof(T));
+		data += sizeof(T);
+		return true;
+	}
+
+	template< typename T >
+	bool
+	setInteger(Argument& argument)
+	{
+		T value;
+		if (not read(value)) {
+			return false;
+		}
+		argument.integer = int64_t(value);
+		argument.floating = double(value);
+		return true;
+	}
+
+	template< typename T >
+	bool
+	setFloat(Argument& argument)
+	{
+		T value;
+		if (not read(value)) {
+			return false;
+		}
+		argument.floating = value;
+		argument.integer = 0;
+		return true;
+	}
+
+	const uint8_t* data;
+	const uint8_t* const end;
+};
+
+/// Formats one argument with the flags, width and precision of `specification`
+void
+formatArgument(modm::IOStream& stream, char* specification, std::size_t length,
+			   char conversion, const Argument& argument)
+{
+	using Type = modm::log::DeferredType;
+	const bool isFloat = (argument.type == Type::Float or argument.type == Type::Double);
+	if ((argument.type == Type::String) != (conversion == 's') or
+		(isFloat and std::strchr("diuoxXcp", conversion)))
+	{
+		stream.write('?');
+		return;
+	}
+	const bool wide = (argument.type == Type::Signed64 or argument.type == Type::Unsigned64);
+	if (wide and std::strchr("diuoxX", conversion))
+	{
+		specification[length++] = 'l';
+		specification[length++] = 'l';
+	}
+	specification[length++] = conversion;
+	specification[length] = '\0';
+
+	switch (conversion)
+	{
+		case 'd':
+		case 'i':
+			if (wide) {
+				stream.printf(specification, static_cast<long long>(argument.integer));
+			} else {
+				stream.printf(specification, static_cast<int>(argument.integer));
+			}
+			break;
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+			if (wide) {
+				stream.printf(specification, static_cast<unsigned long long>(argument.integer));
+			} else {
+				stream.printf(specification, static_cast<unsigned int>(argument.integer));
+			}
+			break;
+		case 'c':
+			stream.printf(specification, static_cast<int>(argument.integer));
+			break;
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+			stream.printf(specification, argument.floating);
+			break;
+		case 's':
+			stream.printf(specification, argument.string);
+			break;
+		case 'p':
+			stream.printf(specification, reinterpret_cast<void*>(uintptr_t(argument.integer)));
+			break;
+		default:
+			stream.write('?');
+			break;
+	}
+}
+
+}	// namespace
+
+// ----------------------------------------------------------------------------
+void
+modm::log::detail::formatDeferred(IOStream& stream, const DeferredRecord& record)
+{
+	if (record.dropped)
+	{
+		stream.printf("[%10lu] %s%u log records dropped", static_cast<unsigned long>(record.timestamp),
+					  levelNames[WARNING], record.dropped);
+		stream << modm::endl;
+	}
+	stream.printf("[%10lu] %s", static_cast<unsigned long>(record.timestamp),
+				  (record.level < DISABLED) ? levelNames[record.level] : "");
+
+	ArgumentReader reader(record);
+	Argument argument;
+
+	for (const char* format = record.format; *format; )
+	{
+		if (*format != '%') {
+			stream.write(*format++);
+			continue;
+		}
+		// copy flags, width and precision, reserve space for the conversion
+		char specification[16];
+		std::size_t length = 0;
+		specification[length++] = *format++;
+		for (; *format and std::strchr("-+ #0123456789.", *format); format++)
+		{
+			if (length < sizeof(specification) - 4) {
+				specification[length++] = *format;
+			}
+		}
+		// the length modifier follows from the stored argument type
+		while (*format and std::strchr("hljztL", *format)) {
+			format++;
+		}
+		const char conversion = *format;
+		if (conversion == '\0') {
+			break;
+		}
+		format++;
+
+		if (conversion == '%') {
+			stream.write('%');
+		}
+		else if (not reader.next(argument)) {
+			stream.write('?');
+		}
+		else {
+			formatArgument(stream, specification, length, conversion, argument);
+		}
+	}
+	stream << modm::endl;
+}
+
+void
+modm::log::detail::writeDeferred(IODevice& device, const DeferredRecord& record)
+{
+	uint8_t header[1 + sizeof(uintptr_t) + sizeof(uint32_t) + 4];
+	const uintptr_t address = reinterpret_cast<uintptr_t>(record.format);
+	header[0] = DeferredSync;
+	std::memcpy(header + 1, &address, sizeof(address));
+	std::memcpy(header + 1 + sizeof(address), &record.timestamp, sizeof(record.timestamp));
+	header[sizeof(header) - 4] = record.level;
+	header[sizeof(header) - 3] = record.length;
+	std::memcpy(header + sizeof(header) - 2, &record.dropped, sizeof(record.dropped));
+
+	device.write(reinterpret_cast<const char*>(header), sizeof(header));
+	device.write(reinterpret_cast<const char*>(record.arguments), record.length);
+}
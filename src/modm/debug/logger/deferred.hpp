@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_LOG_DEFERRED_HPP
+#define MODM_LOG_DEFERRED_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <modm/architecture/driver/atomic/mpsc_queue.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/io/iostream.hpp>
+
+#include "level.hpp"
+
+namespace modm
+{
+	namespace log
+	{
+		/**
+		 * Type tag of an argument in a deferred log record.
+		 *
+		 * Every argument is stored as tag byte followed by its value in
+		 * native byte order. Strings are stored as length byte followed by
+		 * the characters without terminator.
+		 *
+		 * \ingroup modm_debug
+		 */
+		enum class
+		DeferredType : uint8_t
+		{
+			Signed = 0,		///< 32-bit signed integer
+			Unsigned = 1,	///< 32-bit unsigned integer
+			Signed64 = 2,	///< 64-bit signed integer
+			Unsigned64 = 3,	///< 64-bit unsigned integer
+			Float = 4,		///< 32-bit float
+			Double = 5,		///< 64-bit double
+			String = 6,		///< length byte and characters
+		};
+
+		/// Marker at the start of every binary record
+		/// \ingroup modm_debug
+		constexpr uint8_t DeferredSync = 0xA5;
+
+		/// Record of a deferred log call
+		/// \ingroup modm_debug
+		struct DeferredRecord
+		{
+			/// Maximum number of bytes of all encoded arguments
+			static constexpr std::size_t ArgumentSize = 24;
+
+			const char* format;		///< printf-style format string
+			uint32_t timestamp;
+			uint8_t level;
+			uint8_t length;			///< Number of used argument bytes
+			uint16_t dropped;		///< Number of records dropped before this one
+			uint8_t arguments[ArgumentSize];
+		};
+
+		/// @cond
+		namespace detail
+		{
+			template< typename T >
+			constexpr std::size_t
+			deferredSize()
+			{
+				if constexpr (std::is_convertible_v<T, const char*>) {
+					return 2;	// tag and length of an empty string
+				}
+				else if constexpr (std::is_floating_point_v<T>) {
+					return 1 + ((sizeof(T) <= 4) ? 4 : 8);
+				}
+				else if constexpr (std::is_pointer_v<T>) {
+					return 1 + ((sizeof(T) <= 4) ? 4 : 8);
+				}
+				else {
+					static_assert(std::is_integral_v<T> or std::is_enum_v<T>,
+								  "Only integers, floats, pointers and strings can be logged deferred!");
+					return 1 + ((sizeof(T) <= 4) ? 4 : 8);
+				}
+			}
+
+			/// Writes the text of a record as one line, preceded by a line
+			/// with the number of dropped records.
+			void
+			formatDeferred(IOStream& stream, const DeferredRecord& record);
+
+			/// Writes the binary representation of a record.
+			void
+			writeDeferred(IODevice& device, const DeferredRecord& record);
+		}
+		/// @endcond
+
+		/**
+		 * Deferred logger with binary records.
+		 *
+		 * Instead of formatting a message on every call, only the address of
+		 * the format string, a timestamp and the raw arguments are stored as
+		 * a fixed size record in a lock-free ring buffer, which may be written
+		 * from any number of threads or interrupts. The expensive formatting
+		 * is deferred to a background task calling `process()`, or to the
+		 * host by sending the records with `transmit()` and decoding them with
+		 * `modm_tools/deferred_log.py` and the ELF file of the firmware.
+		 *
+		 * The format string is a printf-style string literal, it is only
+		 * referenced, not copied. Supported are the conversions `%d`, `%i`,
+		 * `%u`, `%o`, `%x`, `%X`, `%c`, `%f`, `%F`, `%e`, `%E`, `%g`, `%G`,
+		 * `%s` and `%p` with flags, width and precision, but not `*`. Length
+		 * modifiers are ignored, the type of the argument is stored instead.
+		 * String arguments are copied and truncated to the free space of the
+		 * record.
+		 *
+		 * If the buffer is full, the record is dropped and counted. The
+		 * number of dropped records is stored in and reported before the next
+		 * record.
+		 *
+		 * \code
+		 * modm::log::DeferredLogger<64> logger;
+		 *
+		 * // in the control loop
+		 * MODM_LOG_DEFERRED_INFO(logger, "x=%d y=%.3f", x, y);
+		 *
+		 * // in the idle loop
+		 * while (logger.process(modm::log::info)) ;
+		 * \endcode
+		 *
+		 * @tparam	Size	number of records, must be a power of two
+		 * @tparam	Clock	clock for the timestamp, truncated to 32-bit
+		 *
+		 * \ingroup modm_debug
+		 * \author	Thomas Sommer
+		 */
+		template< std::size_t Size, class Clock = modm::chrono::micro_clock >
+		class DeferredLogger
+		{
+		public:
+			/// Stores a record, which is formatted later.
+			/// @return	`false` if the buffer was full and the record was dropped
+			template< typename... Args >
+			bool
+			log(Level level, const char* format, const Args&... args)
+			{
+				static_assert((0 + ... + detail::deferredSize<Args>()) <= DeferredRecord::ArgumentSize,
+							  "Too many arguments for a deferred log record!");
+				DeferredRecord record;
+				record.format = format;
+				record.timestamp = Clock::now().time_since_epoch().count();
+				record.level = level;
+				record.length = 0;
+				(encode(record, args), ...);
+
+				const uint32_t count = dropped.exchange(0, std::memory_order_relaxed);
+				record.dropped = (count < 0xffff) ? count : 0xffff;
+				if (records.push(record)) {
+					return true;
+				}
+				dropped.fetch_add(count + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			/// Formats the oldest record as a line into `stream`.
+			/// Must only be called from one context.
+			/// @return	`false` if no record was available
+			bool
+			process(IOStream& stream)
+			{
+				DeferredRecord record;
+				if (not records.pop(record)) {
+					return false;
+				}
+				detail::formatDeferred(stream, record);
+				return true;
+			}
+
+			/// Writes the oldest record in binary form to `device`: sync byte,
+			/// format string address, 32-bit timestamp, level, argument length,
+			/// 16-bit dropped count and the arguments, in native byte order.
+			/// Must only be called from one context.
+			/// @return	`false` if no record was available
+			bool
+			transmit(IODevice& device)
+			{
+				DeferredRecord record;
+				if (not records.pop(record)) {
+					return false;
+				}
+				detail::writeDeferred(device, record);
+				return true;
+			}
+
+			/// Must only be called from the context of process() or transmit().
+			bool
+			isEmpty() const
+			{ return records.isEmpty(); }
+
+		private:
+
+			static void
+			put(DeferredRecord& record, DeferredType type, const void* value, std::size_t size)
+			{
+				if (record.length + 1 + size <= DeferredRecord::ArgumentSize)
+				{
+					record.arguments[record.length] = uint8_t(type);
+					std::memcpy(record.arguments + record.length + 1, value, size);
+					record.length += 1 + size;
+				}
+			}
+
+			template< typename T >
+			static void
+			encode(DeferredRecord& record, const T& value)
+			{
+				if constexpr (std::is_convertible_v<T, const char*>)
+				{
+					const char* string = value;
+					if (record.length + 2u > DeferredRecord::ArgumentSize) {
+						return;
+					}
+					const std::size_t free = DeferredRecord::ArgumentSize - record.length - 2;
+					std::size_t length = 0;
+					while (string and length < free and string[length]) {
+						length++;
+					}
+					record.arguments[record.length] = uint8_t(DeferredType::String);
+					record.arguments[record.length + 1] = length;
+					if (length) {
+						std::memcpy(record.arguments + record.length + 2, string, length);
+					}
+					record.length += 2 + length;
+				}
+				else if constexpr (std::is_floating_point_v<T>)
+				{
+					if constexpr (sizeof(T) <= 4) {
+						const float v = value;
+						put(record, DeferredType::Float, &v, sizeof(v));
+					} else {
+						const double v = value;
+						put(record, DeferredType::Double, &v, sizeof(v));
+					}
+				}
+				else if constexpr (std::is_pointer_v<T>) {
+					encode(record, reinterpret_cast<uintptr_t>(value));
+				}
+				else if constexpr (std::is_enum_v<T>) {
+					encode(record, static_cast<std::underlying_type_t<T>>(value));
+				}
+				else if constexpr (std::is_signed_v<T>)
+				{
+					if constexpr (sizeof(T) <= 4) {
+						const int32_t v = value;
+						put(record, DeferredType::Signed, &v, sizeof(v));
+					} else {
+						const int64_t v = value;
+						put(record, DeferredType::Signed64, &v, sizeof(v));
+					}
+				}
+				else
+				{
+					if constexpr (sizeof(T) <= 4) {
+						const uint32_t v = value;
+						put(record, DeferredType::Unsigned, &v, sizeof(v));
+					} else {
+						const uint64_t v = value;
+						put(record, DeferredType::Unsigned64, &v, sizeof(v));
+					}
+				}
+			}
+
+			modm::atomic::MpscQueue<DeferredRecord, Size> records;
+			std::atomic<uint32_t> dropped{0};
+		};
+	}
+}
+
+/**
+ * \name	Deferred log calls
+ *
+ * Like the stream macros, the calls are removed below the MODM_LOG_LEVEL.
+ *
+ * \ingroup modm_debug
+ */
+//\{
+#define MODM_LOG_DEFERRED_DEBUG(logger, ...) \
+	do { if (MODM_LOG_LEVEL <= modm::log::DEBUG) (logger).log(modm::log::DEBUG, __VA_ARGS__); } while (0)
+
+#define MODM_LOG_DEFERRED_INFO(logger, ...) \
+	do { if (MODM_LOG_LEVEL <= modm::log::INFO) (logger).log(modm::log::INFO, __VA_ARGS__); } while (0)
+
+#define MODM_LOG_DEFERRED_WARNING(logger, ...) \
+	do { if (MODM_LOG_LEVEL <= modm::log::WARNING) (logger).log(modm::log::WARNING, __VA_ARGS__); } while (0)
+
+#define MODM_LOG_DEFERRED_ERROR(logger, ...) \
+	do { if (MODM_LOG_LEVEL <= modm::log::ERROR) (logger).log(modm::log::ERROR, __VA_ARGS__); } while (0)
+//\}
+
+#endif // MODM_LOG_DEFERRED_HPP
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2010, Georgi Grinshpun
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -37,6 +38,8 @@ namespace modm
 			virtual
 			~StyleWrapper();
 
+			using IODevice::write;
+
 			virtual void
 			write(char c);
 
@@ -4,6 +4,7 @@
  * Copyright (c) 2012, 2014, Sascha Schade
  * Copyright (c) 2012-2015, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -25,7 +26,13 @@ modm::CanLawicelFormatter::convertToCanMessage(const char* in, can::Message& out
 	bool error = false;
 	uint8_t dlc_pos;
 
-	if (in[0] == 'R' || in[0] == 'T') {
+	// CAN FD frames use 'd' and with bit rate switching 'b', the upper case
+	// letters denote extended identifiers like 't' and 'T'.
+	const bool fd = (in[0] == 'd' || in[0] == 'D' || in[0] == 'b' || in[0] == 'B');
+	out.setFlexibleData(fd);
+	out.setBitRateSwitching(in[0] == 'b' || in[0] == 'B');
+
+	if (in[0] == 'R' || in[0] == 'T' || in[0] == 'D' || in[0] == 'B') {
 		out.flags.extended = true;
 		dlc_pos = 9;
 	}
@@ -38,9 +45,20 @@ modm::CanLawicelFormatter::convertToCanMessage(const char* in, can::Message& out
 		return false;
 
 	// get the number of data-bytes for this message
-	out.length = in[dlc_pos] - '0';
-	if (out.length > 8)
-		return false;		// too many data-bytes
+	if (fd)
+	{
+		// CAN FD length codes 0-F for up to 64 data-bytes
+		const uint8_t dlc = charToByte(in[dlc_pos], error);
+		if (error or can::Message::dlcToLength(dlc) > can::Message::capacity)
+			return false;
+		out.length = can::Message::dlcToLength(dlc);
+	}
+	else
+	{
+		out.length = in[dlc_pos] - '0';
+		if (out.length > 8)
+			return false;		// too many data-bytes
+	}
 
 	if (in[0] == 'r' || in[0] == 'R') {
 		out.flags.rtr = true;
@@ -103,7 +121,15 @@ modm::CanLawicelFormatter::convertToCanMessage(const char* in, can::Message& out
 bool
 modm::CanLawicelFormatter::convertToString(const can::Message& in, char* out)
 {
-	if(in.flags.extended){
+	if(in.isFlexibleData()){
+		if(in.isBitRateSwitching()){
+			out[0] = in.flags.extended ? 'B' : 'b';
+		}
+		else{
+			out[0] = in.flags.extended ? 'D' : 'd';
+		}
+	}
+	else if(in.flags.extended){
 		if(in.flags.rtr){
 			out[0]='R';
 		}
@@ -120,6 +146,8 @@ modm::CanLawicelFormatter::convertToString(const can::Message& in, char* out)
 		}
 	}
 
+	// CAN FD lengths above 8 bytes are encoded as length code 9-F
+	const uint8_t dlc = in.isFlexibleData() ? in.getDataLengthCode() : in.length;
 	const uint8_t* ptr=reinterpret_cast<const uint8_t*>(&in.identifier);
 	uint8_t dataBegin;
 	if(in.flags.extended)
@@ -129,7 +157,7 @@ modm::CanLawicelFormatter::convertToString(const can::Message& in, char* out)
 			out[2*i+2] = byteToHex(*ptr);
 			++ptr;
 		}
-		out[9] = byteToHex(in.length);
+		out[9] = byteToHex(dlc);
 		out[10] = '\0';
 		dataBegin=10;
 	}
@@ -138,13 +166,13 @@ modm::CanLawicelFormatter::convertToString(const can::Message& in, char* out)
 		out[1] = byteToHex(*(ptr+1));
 		out[2] = byteToHex((*(ptr))>>4);
 		out[3] = byteToHex((*(ptr)));
-		out[4] = byteToHex(in.length);
+		out[4] = byteToHex(dlc);
 		out[5] = '\0';	// terminate if no data is appended.
 		dataBegin=5;
 
 	}
 
-	if (!in.flags.rtr)
+	if (!in.flags.rtr || in.isFlexibleData())
 	{
 		uint_fast8_t i = 0;
 		for( ; i < in.length ; i++)
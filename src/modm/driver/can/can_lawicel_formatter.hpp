@@ -4,6 +4,7 @@
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012-2015, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -16,6 +17,7 @@
 #ifndef MODM_CAN_LAWICEL_FORMATTER_HPP
 #define MODM_CAN_LAWICEL_FORMATTER_HPP
 
+#include <cstddef>
 #include <modm/architecture/interface/can_message.hpp>
 
 namespace modm
@@ -25,6 +27,10 @@ namespace modm
 class CanLawicelFormatter
 {
 public:
+	/// Size of a string buffer for any message including the terminating
+	/// zero: type, 8 identifier digits, length code and the payload in hex.
+	static constexpr std::size_t MaxStringLength = 1 + 8 + 1 + 2 * can::Message::capacity + 1;
+
 	static bool
 	convertToCanMessage(const char* in, can::Message& out);
 
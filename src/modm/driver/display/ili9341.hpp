@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019, Mike Wolfram
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -292,6 +293,12 @@ protected:
 	inline void
 	drawVerticalLine(glcd::Point start, int16_t length) final;
 
+	inline void
+	fillRectangleFast(glcd::Point start, int16_t width, int16_t height) final
+	{
+		fillRectangle(start, width, height);
+	}
+
 	void
 	setClipping(glcd::Point start, glcd::Point end) final;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -23,6 +23,8 @@ namespace modm
  * Page-address and sending page-data instead of sending the whole buffer at
  * once like is for SSD1306 in MemoryMode::HORIZONTAL / MemoryMode::VERTICAL
  *
+ * Only the modified columns of every page are transferred.
+ *
  * @ingroup modm_driver_sh1106
  */
 template<class I2cMaster, uint8_t Height = 64>
@@ -39,22 +41,32 @@ protected:
 
 		this->transaction_success = true;
 
-		this->commandBuffer[0] = ssd1306::AdressingCommands::HigherColumnStartAddress;
-		this->commandBuffer[1] = 0x02;
-
-		for (page = 0; page < Height / 8; page++)
+		for (this->page = 0; this->page < Height / 8; this->page++)
 		{
-			this->commandBuffer[2] = 0xB0 | page;
-			this->transaction_success &= RF_CALL(this->writeCommands(3));
+			this->range = this->takeDirty(this->page);
+			if (this->range.isEmpty()) continue;
 
-			RF_WAIT_UNTIL(
-				this->transaction.configureDisplayWrite((uint8_t*)&this->buffer[page], 128));
-			RF_WAIT_UNTIL(this->startTransaction());
-			RF_WAIT_WHILE(this->isTransactionRunning());
-			this->transaction_success &= this->wasTransactionSuccessful();
+			// The SH1106 has 132 columns, the visible ones start at column 2
+			this->commandBuffer[0] = ssd1306::AdressingCommands::HigherColumnStartAddress |
+									 ((this->range.begin + 2) >> 4);
+			this->commandBuffer[1] = ssd1306::AdressingCommands::LowerColumnStartAddress |
+									 ((this->range.begin + 2) & 0x0F);
+			this->commandBuffer[2] = ssd1306::AdressingCommands::PageStartAddress | this->page;
+			if (RF_CALL(this->writeCommands(3)))
+			{
+				RF_WAIT_UNTIL(
+					this->transaction.configureDisplayWrite(&this->buffer[this->page][this->range.begin],
+															this->range.size()));
+				RF_WAIT_UNTIL(this->startTransaction());
+				RF_WAIT_WHILE(this->isTransactionRunning());
+				if (this->wasTransactionSuccessful()) continue;
+			}
+			// send the page again with the next update
+			this->markDirty(this->page, this->range.begin, this->range.end);
+			this->transaction_success = false;
 		};
 
-		RF_END_RETURN(this->transaction_success);
+		RF_END();
 	}
 
 	modm::ResumableResult<void>
@@ -67,9 +79,6 @@ protected:
 		this->transaction_success &= RF_CALL(this->writeCommands(2));
 		RF_END();
 	}
-
-private:
-	size_t page;
 };
 
 }  // namespace modm
@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2014, 2016-2017, Sascha Schade
  * Copyright (c) 2014-2016, 2018, Niklas Hauser
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -90,6 +90,10 @@ public:
  * This display is only rated to be driven with 400kHz, which limits
  * the frame rate to about 40Hz.
  *
+ * Only the modified columns of every page are transferred, so small
+ * changes can be written much faster. The whole buffer is sent at once
+ * when that is cheaper than addressing the pages one by one.
+ *
  * @author	Niklas Hauser
  * @author	Thomas Sommer
  * @ingroup	modm_driver_ssd1306
@@ -112,7 +116,7 @@ public:
 	bool inline initializeBlocking()
 	{ return RF_CALL_BLOCKING(initialize()); }
 
-	/// Update the display with the content of the RAM buffer.
+	/// Update the display with the modified content of the RAM buffer.
 	void
 	update() override
 	{ RF_CALL_BLOCKING(startWriteDisplay()); }
@@ -183,8 +187,12 @@ protected:
 	virtual modm::ResumableResult<void>
 	startWriteDisplay();
 
+	using DirtyRange = typename MonochromeGraphicDisplayVertical<128, Height>::DirtyRange;
+
 	uint8_t commandBuffer[7];
 	bool transaction_success;
+	uint8_t page;
+	DirtyRange range;
 };
 
 }  // namespace modm
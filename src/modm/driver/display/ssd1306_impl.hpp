@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2014-2015, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -112,9 +113,60 @@ modm::Ssd1306<I2cMaster, Height>::startWriteDisplay()
 {
 	RF_BEGIN();
 
-	RF_WAIT_UNTIL(
-		this->transaction.configureDisplayWrite((uint8_t*)(&this->buffer), sizeof(this->buffer)) and
-		this->startTransaction());
+	transaction_success = true;
+
+	// Every page costs a command and a data transfer with about 12 bytes overhead
+	if (this->getDirtySize() + (Height / 8) * 12 >= sizeof(this->buffer))
+	{
+		commandBuffer[0] = AdressingCommands::ColumnAddress;
+		commandBuffer[1] = 0;
+		commandBuffer[2] = 127;
+		commandBuffer[3] = AdressingCommands::PageAddress;
+		commandBuffer[4] = 0;
+		commandBuffer[5] = Height / 8 - 1;
+		// the buffer stays dirty if the display does not respond
+		if (not RF_CALL(writeCommands(6))) {
+			transaction_success = false;
+			RF_RETURN();
+		}
+
+		for (page = 0; page < Height / 8; page++) this->takeDirty(page);
+
+		RF_WAIT_UNTIL(
+			this->transaction.configureDisplayWrite((uint8_t*)(&this->buffer), sizeof(this->buffer)) and
+			this->startTransaction());
+		RF_WAIT_WHILE(this->isTransactionRunning());
+		if (not this->wasTransactionSuccessful()) {
+			this->markDirty();
+			transaction_success = false;
+		}
+	}
+	else
+	{
+		for (page = 0; page < Height / 8; page++)
+		{
+			range = this->takeDirty(page);
+			if (range.isEmpty()) continue;
+
+			commandBuffer[0] = AdressingCommands::ColumnAddress;
+			commandBuffer[1] = range.begin;
+			commandBuffer[2] = range.end - 1;
+			commandBuffer[3] = AdressingCommands::PageAddress;
+			commandBuffer[4] = page;
+			commandBuffer[5] = page;
+			if (RF_CALL(writeCommands(6)))
+			{
+				RF_WAIT_UNTIL(
+					this->transaction.configureDisplayWrite(&this->buffer[page][range.begin], range.size()) and
+					this->startTransaction());
+				RF_WAIT_WHILE(this->isTransactionRunning());
+				if (this->wasTransactionSuccessful()) continue;
+			}
+			// send the page again with the next update
+			this->markDirty(page, range.begin, range.end);
+			transaction_success = false;
+		}
+	}
 
 	RF_END();
 }
@@ -127,9 +179,7 @@ modm::Ssd1306<I2cMaster, Height>::writeDisplay()
 
 	RF_CALL(startWriteDisplay());
 
-	RF_WAIT_WHILE(this->isTransactionRunning());
-
-	RF_END_RETURN(this->wasTransactionSuccessful());
+	RF_END_RETURN(transaction_success);
 }
 
 template<class I2cMaster, uint8_t Height>
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Thorsten Lajewski
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2012-2014, 2016, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -37,7 +38,9 @@ namespace modm
 		}
 
 		/**
-		 * \brief	Update the display with the content of the RAM buffer
+		 * \brief	Update the display with the modified content of the RAM buffer
+		 *
+		 * Only the modified columns of every page are transferred.
 		 */
 		virtual void
 		update();
@@ -50,6 +53,12 @@ namespace modm
 		modm_always_inline void
 		initialize(modm::accessor::Flash<uint8_t> configuration, uint8_t size);
 
+		/// Does nothing, all drawing happens in the RAM buffer and update()
+		/// addresses the modified columns itself.
+		void
+		setClipping(glcd::Point, glcd::Point) final
+		{}
+
 		SPI spi;
 		CS cs;
 		A0 a0;
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2012, Fabian Greif
  * Copyright (c) 2012-2014, Niklas Hauser
  * Copyright (c) 2012, 2014, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -23,25 +24,30 @@ template <typename SPI, typename CS, typename A0, typename Reset, unsigned int W
 void
 modm::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::update()
 {
+	if (not this->isDirty()) {
+		return;
+	}
+
 	cs.reset();
 	for(uint8_t y = 0; y < (Height / 8); ++y)
 	{
+		// only transfer the modified columns of the page
+		const auto range = this->takeDirty(y);
+		if (range.isEmpty()) {
+			continue;
+		}
+		const uint8_t column = range.begin + (TopView ? 4 : 0);
+
 		// command mode
 		a0.reset();
 		spi.transferBlocking(ST7565_PAGE_ADDRESS | y);		// Row select
-		spi.transferBlocking(ST7565_COL_ADDRESS_MSB);		// Column select high
-
-		if (TopView) {
-			spi.transferBlocking(ST7565_COL_ADDRESS_LSB | 4);	// Column select low
-		}
-		else {
-			spi.transferBlocking(ST7565_COL_ADDRESS_LSB);	// Column select low
-		}
+		spi.transferBlocking(ST7565_COL_ADDRESS_MSB | (column >> 4));	// Column select high
+		spi.transferBlocking(ST7565_COL_ADDRESS_LSB | (column & 0x0F));	// Column select low
 
 		// switch to data mode
 		a0.set();
-		for(uint8_t x = 0; x < Width; ++x) {
-			spi.transferBlocking(this->buffer[x][y]);
+		for(uint8_t x = range.begin; x < range.end; ++x) {
+			spi.transferBlocking(this->buffer[y][x]);
 		}
 	}
 	cs.set();
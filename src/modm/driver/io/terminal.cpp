@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2012, 2014, Niklas Hauser
  * Copyright (c) 2014, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -29,6 +30,12 @@ modm::Terminal::write(const char* s)
 	std::cout << s;
 }
 
+void
+modm::Terminal::write(const char* data, std::size_t length)
+{
+	std::cout.write(data, length);
+}
+
 void
 modm::Terminal::flush()
 {
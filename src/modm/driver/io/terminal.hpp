@@ -2,6 +2,7 @@
  * Copyright (c) 2009-2010, Martin Rosekeit
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2012, 2014, 2019, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -33,6 +34,9 @@ public :
 	virtual void
 	write(const char* s);
 
+	virtual void
+	write(const char* data, std::size_t length);
+
 	virtual void
 	flush();
 
@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012, 2016, 2020, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -15,6 +16,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include <modm/architecture/utils.hpp>
@@ -26,8 +28,15 @@ namespace modm
 /**
  * Memory allocator.
  *
+ * The heap is divided into blocks of a fixed size. Every allocation
+ * occupies a number of consecutive blocks, whose count is stored in the
+ * first and last word. Free areas are marked with a negative count and are
+ * additionally linked into one free-list per size class, so that small
+ * allocations take O(1) and larger ones only need to look at the free areas
+ * instead of all allocations.
+ *
  * @tparam	BLOCK_SIZE
- * 		Size of one allocatable block in words (sizeof(T) bytes)
+ * 		Size of one allocatable block in words (sizeof(T) bytes), at least 4
  *		(BLOCKSIZE * sizeof(T) * n) - 4 has to be dividable by 4 for every n
  *
  * @author	Fabian Greif
@@ -36,8 +45,13 @@ namespace modm
 template <typename T, unsigned int BLOCK_SIZE >
 class BlockAllocator
 {
+	static_assert(BLOCK_SIZE >= 4, "A free block must fit the size markers and the free-list links!");
 	using SignedType = std::make_signed_t<T>;
 public:
+	/// Allocations of up to this many blocks each have their own free-list.
+	/// Larger free areas share one list, which is searched first-fit.
+	static constexpr std::size_t SizeClasses = 8;
+
 	/**
 	 * Initialize the raw memory.
 	 *
@@ -58,7 +72,23 @@ public:
 	allocate(std::size_t requestedSize);
 
 	/**
-	 * Free memory in O(1)
+	 * Resize previously allocated memory.
+	 *
+	 * Shrinks in place and grows in place if the following blocks are free.
+	 * Otherwise new memory is allocated, the content copied and the old
+	 * memory freed.
+	 *
+	 * @param	ptr
+	 * 		Previously acquired by allocate() or reallocate(), may be
+	 * 		`nullptr` to allocate new memory.
+	 * @return	`nullptr` if there is not enough memory, then `ptr` remains
+	 * 		valid and unchanged.
+	 */
+	void *
+	reallocate(void *ptr, std::size_t requestedSize);
+
+	/**
+	 * Free memory in O(1), merging it with adjacent free memory
 	 *
 	 * @param	ptr
 	 * 		Must be the same pointer previously acquired by
@@ -68,19 +98,79 @@ public:
 	free(void *ptr);
 
 public:
+	/// Sum of all free memory, iterates over the whole heap
 	std::size_t
 	getAvailableSize() const;
 
+	/// Size of the managed memory in bytes
+	std::size_t
+	getTotalSize() const
+	{ return (end - start) * sizeof(T); }
+
+	/// Usable size of an allocation, which may be larger than requested
+	static std::size_t
+	getBlockSize(const void *ptr)
+	{ return ptr ? getUsableSize(*((const T *) ptr - 1)) : 0; }
+
+	/// Size of the largest possible allocation, only walks the free-list of
+	/// the large areas
+	std::size_t
+	getLargestFreeSize() const;
+
 private:
 	// Align the pointer to a multiple of MODM_ALIGNMENT
 	T *
 	alignPointer(void * ptr) const;
 
-	//static const int MAX_BLOCK_PARTS = 2048;
+	/// Number of blocks needed for the payload and the markers
+	static std::size_t
+	getNeededSlots(std::size_t requestedSize);
+
+	/// Payload size of an area of `slots` blocks
+	static std::size_t
+	getUsableSize(std::size_t slots)
+	{ return (slots * BLOCK_SIZE - 2) * sizeof(T); }
+
+	static std::size_t
+	getSizeClass(std::size_t slots)
+	{ return std::min(slots, SizeClasses + 1) - 1; }
+
+	/// Write the size markers of an allocated area
+	void
+	markUsed(T *p, std::size_t slots);
+
+	/// Mark the area as free and insert it into the free-list of its size class
+	void
+	insertFree(T *p, std::size_t slots);
+
+	/// Remove the free area from its free-list
+	void
+	removeFree(T *p);
+
+	/// Allocate `slots` blocks of the free area and return the rest to the free-lists
+	void *
+	split(T *p, std::size_t slots);
+
+	/// Merge the free area with the following free area and insert it
+	void
+	releaseSlots(T *p, std::size_t slots);
+
+	// the free-list links are stored as block index in the second and
+	// third word of a free area
+	static constexpr T None = T(-1);
+
+	T *
+	getBlock(T index) const
+	{ return start + index * BLOCK_SIZE; }
+
+	T
+	getIndex(const T *p) const
+	{ return (p - start) / BLOCK_SIZE; }
 
 	T* start;
 	T* end;
-	T* freeHint;
+	/// first free area of every size class
+	T freeLists[SizeClasses + 1];
 };
 
 } // namespace modm
@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012, 2016, 2020, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -15,6 +16,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
 
 // ----------------------------------------------------------------------------
 /*
@@ -56,6 +60,14 @@
  *    2  MMmm pppp pppp pppp mm
  *                             ^
  *                             \-- end
+ *
+ * Free areas store the block index of the next and previous free area of
+ * the same size class in the two words following the first marker:
+ *
+ *    0  UUmm nnpp pppp pppp mm
+ *
+ * 'n' = Index of the next free area
+ * 'p' = Index of the previous free area
  */
 template <typename T, unsigned int BLOCK_SIZE >
 void
@@ -68,64 +80,171 @@ modm::BlockAllocator<T, BLOCK_SIZE>::initialize(void * heapStart, void * heapEnd
 
 	// integer division which will automatically round down
 	std::size_t size = memory / (BLOCK_SIZE * sizeof(T));
+	// the markers are signed and the largest index is reserved
+	size = std::min<std::size_t>(size, std::numeric_limits<SignedType>::max());
 
-	end = (uint16_t *)((uintptr_t) start + (size * BLOCK_SIZE * sizeof(T)));
+	end = (T *)((uintptr_t) start + (size * BLOCK_SIZE * sizeof(T)));
 
-	*start = -size;
-	*(end - 1) = -size;
+	std::fill(std::begin(freeLists), std::end(freeLists), None);
+	insertFree(start, size);
+}
 
-	freeHint = start;
+// ----------------------------------------------------------------------------
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getNeededSlots(std::size_t requestedSize)
+{
+	// words needed for the markers at the start and the end
+	requestedSize += 2 * sizeof(T);
+	return (requestedSize + (BLOCK_SIZE * sizeof(T) - 1)) / (BLOCK_SIZE * sizeof(T));
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::markUsed(T *p, std::size_t slots)
+{
+	*p = slots;
+	*(p + slots * BLOCK_SIZE - 1) = slots;
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::insertFree(T *p, std::size_t slots)
+{
+	*p = -slots;
+	*(p + slots * BLOCK_SIZE - 1) = -slots;
+
+	T &head = freeLists[getSizeClass(slots)];
+	p[1] = head;
+	p[2] = None;
+	if (head != None) {
+		getBlock(head)[2] = getIndex(p);
+	}
+	head = getIndex(p);
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::removeFree(T *p)
+{
+	const std::size_t slots = -SignedType(*p);
+	if (p[2] != None) {
+		getBlock(p[2])[1] = p[1];
+	} else {
+		freeLists[getSizeClass(slots)] = p[1];
+	}
+	if (p[1] != None) {
+		getBlock(p[1])[2] = p[2];
+	}
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void *
+modm::BlockAllocator<T, BLOCK_SIZE>::split(T *p, std::size_t slots)
+{
+	const std::size_t freeSlots = -SignedType(*p);
+	removeFree(p);
+	markUsed(p, slots);
+
+	if (freeSlots > slots)
+	{
+		// the rest of the area is a new slice of free slots, which cannot
+		// have any free neighbours
+		insertFree(p + slots * BLOCK_SIZE, freeSlots - slots);
+	}
+	return (void *) (p + 1);
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::releaseSlots(T *p, std::size_t slots)
+{
+	// check whether the slots above are free
+	T *next = p + slots * BLOCK_SIZE;
+	if (next < end and SignedType(*next) < 0)
+	{
+		slots += -SignedType(*next);
+		removeFree(next);
+	}
+	insertFree(p, slots);
 }
 
 // ----------------------------------------------------------------------------
-/*
- *
- *
- */
 template <typename T, unsigned int BLOCK_SIZE >
 void *
 modm::BlockAllocator<T, BLOCK_SIZE>::allocate(std::size_t requestedSize)
 {
-	requestedSize += 4;	// bytes needed for the management
+	const std::size_t neededSlots = getNeededSlots(requestedSize);
 
-	std::size_t neededSlots = (requestedSize + (BLOCK_SIZE * sizeof(T) - 1)) /
-			(BLOCK_SIZE * sizeof(T));
+	// an exactly fitting or larger area of the small size classes
+	for (std::size_t sizeClass = getSizeClass(neededSlots);
+		 sizeClass < SizeClasses; ++sizeClass)
+	{
+		if (freeLists[sizeClass] != None) {
+			return split(getBlock(freeLists[sizeClass]), neededSlots);
+		}
+	}
 
-	T *p = freeHint;
-	do
+	// first fit among the large free areas
+	for (T index = freeLists[SizeClasses]; index != None; index = getBlock(index)[1])
 	{
-		SignedType slots = *p;
+		T *p = getBlock(index);
+		if (std::size_t(-SignedType(*p)) >= neededSlots) {
+			return split(p, neededSlots);
+		}
+	}
 
-		if (slots < 0)
-		{
-			// slots < 0 => free slots
-			slots = -slots;
+	return 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, unsigned int BLOCK_SIZE >
+void *
+modm::BlockAllocator<T, BLOCK_SIZE>::reallocate(void *ptr, std::size_t requestedSize)
+{
+	if (ptr == 0) {
+		return allocate(requestedSize);
+	}
+
+	T *p = (T *) ptr;
+	p -= 1;
+
+	const std::size_t slots = *p;
+	const std::size_t neededSlots = getNeededSlots(requestedSize);
 
-			T freeSlots = slots;
-			if (freeSlots >= neededSlots)
-			{
-				// write the marker on the first an last slot of the field of
-				// new allocated slots
-				*p = neededSlots;
-				*(p + neededSlots * BLOCK_SIZE - 1) = neededSlots;
-
-				if (freeSlots > neededSlots)
-				{
-					// if the allocated space are smaller than original one,
-					// than we get a new slice of free slots and need set the
-					// new marker for this field
-					*(p + neededSlots * BLOCK_SIZE) = -(freeSlots - neededSlots);
-					*(p + freeSlots  * BLOCK_SIZE - 1) = -(freeSlots - neededSlots);
-				}
-				return (void *) (p + 1);
-			}
+	if (neededSlots <= slots)
+	{
+		// shrink in place
+		if (neededSlots < slots)
+		{
+			markUsed(p, neededSlots);
+			releaseSlots(p + neededSlots * BLOCK_SIZE, slots - neededSlots);
 		}
+		return ptr;
+	}
 
-		p += slots * BLOCK_SIZE;
+	// grow in place into the following free slots
+	T *next = p + slots * BLOCK_SIZE;
+	if (next < end and SignedType(*next) < 0 and
+		slots + std::size_t(-SignedType(*next)) >= neededSlots)
+	{
+		const std::size_t freeSlots = slots + std::size_t(-SignedType(*next));
+		removeFree(next);
+		markUsed(p, neededSlots);
+		if (freeSlots > neededSlots) {
+			releaseSlots(p + neededSlots * BLOCK_SIZE, freeSlots - neededSlots);
+		}
+		return ptr;
 	}
-	while (p < end);
 
-	return 0;
+	// move to a new location
+	void *newPtr = allocate(requestedSize);
+	if (newPtr)
+	{
+		std::memcpy(newPtr, ptr, getUsableSize(slots));
+		free(ptr);
+	}
+	return newPtr;
 }
 
 // ----------------------------------------------------------------------------
@@ -140,45 +259,22 @@ modm::BlockAllocator<T, BLOCK_SIZE>::free(void *ptr)
 	T *p = (T *) ptr;
 	p -= 1;
 
-	SignedType slots = *p;
-	T freeSlots = slots;
-
-	// check whether the slots above are free
-	if (p + slots * BLOCK_SIZE < end) {
-		slots = *(p + slots * BLOCK_SIZE);
-		if (slots < 0) {
-			freeSlots += -slots;
-		}
-	}
+	std::size_t slots = *p;
 
 	// check the slots below
-	if (p - 1 >= start) {
-		slots = *(p - 1);
-		if (slots < 0) {
-			p += slots * BLOCK_SIZE;
-			freeSlots += -slots;
+	if (p > start)
+	{
+		const SignedType below = *(p - 1);
+		if (below < 0)
+		{
+			p += below * SignedType(BLOCK_SIZE);
+			slots += -below;
+			removeFree(p);
 		}
 	}
 
-	// write the markers
-//	if (freeSlots > MAX_BLOCK_PARTS)
-//	{
-//		// memory area is to big, split it in two parts
-//		*p = -MAX_BLOCK_PARTS;
-//		*(p + MAX_BLOCK_PARTS * BLOCK_SIZE - 1) = -MAX_BLOCK_PARTS;
-//
-//		*(p + MAX_BLOCK_PARTS * BLOCK_SIZE) = -(freeSlots - MAX_BLOCK_PARTS);
-//		*(p + freeSlots * BLOCK_SIZE - 1) = -(freeSlots - MAX_BLOCK_PARTS);
-//	}
-//	else
-//	{
-		*p = -freeSlots;
-		*(p + freeSlots * BLOCK_SIZE - 1) = -freeSlots;
-//	}
-
-	if (p < freeHint) {
-		freeHint = p;
-	}
+	// merges with the slots above
+	releaseSlots(p, slots);
 }
 
 // ----------------------------------------------------------------------------
@@ -206,6 +302,25 @@ modm::BlockAllocator<T, BLOCK_SIZE>::getAvailableSize() const
 	return size;
 }
 
+// ----------------------------------------------------------------------------
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getLargestFreeSize() const
+{
+	std::size_t slots = 0;
+	for (T index = freeLists[SizeClasses]; index != None; index = getBlock(index)[1]) {
+		slots = std::max(slots, std::size_t(-SignedType(*getBlock(index))));
+	}
+	// the size classes below contain exactly one size each
+	for (std::size_t sizeClass = SizeClasses; slots == 0 and sizeClass > 0; --sizeClass)
+	{
+		if (freeLists[sizeClass - 1] != None) {
+			slots = sizeClass;
+		}
+	}
+	return slots ? getUsableSize(slots) : 0;
+}
+
 // ----------------------------------------------------------------------------
 template<typename T, unsigned int BLOCK_SIZE >
 T *
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, 2017-2018, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,3 +15,4 @@
 #include "io/iostream.hpp"
 #include "io/iodevice.hpp"
 #include "io/iodevice_wrapper.hpp"
+#include "io/iostream_format.hpp"
@@ -2,6 +2,7 @@
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2009-2010, Martin Rosekeit
  * Copyright (c) 2012, 2014, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,9 @@
 #ifndef MODM_IODEVICE_HPP
 #define MODM_IODEVICE_HPP
 
+#include <cstddef>
+#include <cstring>
+
 namespace modm
 {
 
@@ -37,8 +41,19 @@ public:
 	virtual inline void
 	write(const char* str)
 	{
-		char c;
-		while ( (c = *str++) ) write(c);
+		write(str, std::strlen(str));
+	}
+
+	/**
+	 * Write a block of characters.
+	 *
+	 * The default implementation calls `write(char)` for every character,
+	 * devices with a buffer or a bulk transfer should override it.
+	 */
+	virtual inline void
+	write(const char* data, std::size_t length)
+	{
+		while (length--) write(*data++);
 	}
 
 	virtual void
@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012, Georgi Grinshpun
  * Copyright (c) 2012-2014, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -16,6 +17,7 @@
 #define MODM_IODEVICE_WRAPPER_HPP
 
 #include <stdint.h>
+#include <cstddef>
 
 #include "iodevice.hpp"
 
@@ -54,6 +56,27 @@ public:
 		while(behavior == IOBuffer::BlockIfFull and not written);
 	}
 
+	/// Uses the bulk write of the device if available
+	void
+	write(const char* data, std::size_t length) override
+	{
+		const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+		if constexpr (requires { std::size_t{Device::write(bytes, length)}; })
+		{
+			do
+			{
+				const std::size_t written = Device::write(bytes, length);
+				bytes += written;
+				length -= written;
+			}
+			while(behavior == IOBuffer::BlockIfFull and length);
+		}
+		else
+		{
+			while (length--) write(char(*bytes++));
+		}
+	}
+
 	void
 	flush() override
 	{
@@ -87,6 +110,27 @@ public:
 		while(behavior == IOBuffer::BlockIfFull and not written);
 	}
 
+	/// Uses the bulk write of the device if available
+	void
+	write(const char* data, std::size_t length) override
+	{
+		const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+		if constexpr (requires { std::size_t{device.write(bytes, length)}; })
+		{
+			do
+			{
+				const std::size_t written = device.write(bytes, length);
+				bytes += written;
+				length -= written;
+			}
+			while(behavior == IOBuffer::BlockIfFull and length);
+		}
+		else
+		{
+			while (length--) write(char(*bytes++));
+		}
+	}
+
 	void
 	flush() override
 	{
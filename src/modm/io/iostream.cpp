@@ -4,6 +4,7 @@
  * Copyright (c) 2011, Georgi Grinshpun
  * Copyright (c) 2012-2014, 2019 Niklas Hauser
  * Copyright (c) 2016, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -59,51 +60,51 @@ IOStream::operator << (const bool& v)
 
 // ----------------------------------------------------------------------------
 void
-IOStream::writeHex(uint8_t value)
+IOStream::writeHex(const uint8_t* bytes, uint8_t count)
 {
-	const auto fn_nibble = [this](uint8_t nibble)
+	const auto fn_nibble = [](uint8_t nibble) -> char
 	{
-		device->write( nibble + (nibble > 9 ? 'A' - 10 : '0') );
+		return nibble + (nibble > 9 ? 'A' - 10 : '0');
 	};
-	fn_nibble(value >> 4);
-	fn_nibble(value & 0xF);
+	char buffer[2 * 8];
+	uint8_t length = 0;
+	for (; count and length < sizeof(buffer); count--, bytes++)
+	{
+		buffer[length++] = fn_nibble(*bytes >> 4);
+		buffer[length++] = fn_nibble(*bytes & 0xF);
+	}
+	device->write(buffer, length);
 }
 
 // ----------------------------------------------------------------------------
 void
-IOStream::writeBin(uint8_t value)
+IOStream::writeBin(const uint8_t* bytes, uint8_t count)
 {
-	for (uint_fast8_t ii = 0; ii < 8; ii++)
+	char buffer[8 * 8];
+	uint8_t length = 0;
+	for (; count and length < sizeof(buffer); count--, bytes++)
 	{
-		device->write(value & 0x80 ? '1' : '0');
-		value <<= 1;
+		uint8_t value = *bytes;
+		for (uint_fast8_t ii = 0; ii < 8; ii++)
+		{
+			buffer[length++] = (value & 0x80 ? '1' : '0');
+			value <<= 1;
+		}
 	}
+	device->write(buffer, length);
 }
 
 // ----------------------------------------------------------------------------
 void
 IOStream::writePointer(const void* p)
 {
-	device->write('0');
-	device->write('x');
+	device->write("0x", 2);
 	const uintptr_t value = reinterpret_cast<uintptr_t>(p);
 
-#if MODM_SIZEOF_POINTER == 2
-
-	writeHex(value >> 8);
-	writeHex(value);
-
-#elif MODM_SIZEOF_POINTER == 4
-
-	for (uint8_t ii=24; ii < 32; ii -= 8)
-		writeHex(value >> ii);
-
-#elif MODM_SIZEOF_POINTER == 8
-
-	for (uint8_t ii=56; ii < 64; ii -= 8)
-		writeHex(value >> ii);
-
-#endif
+	uint8_t bytes[sizeof(uintptr_t)];
+	for (uint8_t ii = 0; ii < sizeof(uintptr_t); ii++)
+		bytes[ii] = value >> ((sizeof(uintptr_t) - 1 - ii) * 8);
+	writeHex(bytes, sizeof(uintptr_t));
 }
 
 IOStream&
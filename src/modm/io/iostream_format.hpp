@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "iostream.hpp"
+
+namespace modm
+{
+
+/// @cond
+namespace detail
+{
+
+/// String literal as template argument
+template< std::size_t N >
+struct FormatString
+{
+	consteval
+	FormatString(const char (&string)[N])
+	{
+		for (std::size_t ii = 0; ii < N; ii++) data[ii] = string[ii];
+	}
+
+	static constexpr std::size_t size = N - 1;
+	char data[N];
+};
+
+enum class
+FormatError : uint8_t
+{
+	None,
+	UnmatchedBrace,
+	InvalidSpecification,
+};
+
+/// Parsed `{:[[fill]align][0][width][.precision][type]}`
+struct FormatSpec
+{
+	char type = 0;			///< zero for the default of the argument type
+	char fill = ' ';
+	char align = 0;			///< '<', '>' or zero for the default of the argument type
+	bool zero = false;		///< pad numbers with zeros after the sign
+	uint8_t width = 0;
+	int8_t precision = -1;
+};
+
+/// Literal text or one argument of the format string
+struct FormatSegment
+{
+	uint16_t offset = 0;
+	uint16_t length = 0;
+	int16_t argument = -1;	///< index of the argument, -1 for literal text
+	FormatSpec spec = {};
+};
+
+struct FormatResult
+{
+	std::size_t segments = 0;
+	std::size_t arguments = 0;
+	FormatError error = FormatError::None;
+};
+
+/// Splits the format string into segments, stores at most `capacity` of them.
+consteval FormatResult
+parseFormat(const char* data, std::size_t size, FormatSegment* segments, std::size_t capacity)
+{
+	FormatResult result;
+	const auto literal = [&](std::size_t begin, std::size_t end)
+	{
+		if (end <= begin) return;
+		if (result.segments < capacity) segments[result.segments] = FormatSegment{uint16_t(begin), uint16_t(end - begin)};
+		result.segments++;
+	};
+	const auto number = [&](std::size_t& ii) -> unsigned
+	{
+		unsigned value = 0;
+		for (; ii < size and data[ii] >= '0' and data[ii] <= '9'; ii++)
+			value = value * 10 + (data[ii] - '0');
+		return value;
+	};
+
+	std::size_t start = 0;
+	for (std::size_t ii = 0; ii < size; )
+	{
+		const char c = data[ii];
+		if (c != '{' and c != '}') { ii++; continue; }
+		if (ii + 1 < size and data[ii + 1] == c)
+		{
+			// escaped brace, keep the first one as text
+			literal(start, ii + 1);
+			ii += 2;
+			start = ii;
+			continue;
+		}
+		if (c == '}') {
+			result.error = FormatError::UnmatchedBrace;
+			return result;
+		}
+		literal(start, ii);
+		ii++;
+
+		FormatSpec spec;
+		if (ii < size and data[ii] == ':')
+		{
+			ii++;
+			if (ii + 1 < size and (data[ii + 1] == '<' or data[ii + 1] == '>') and data[ii] != '}') {
+				spec.fill = data[ii];
+				spec.align = data[ii + 1];
+				ii += 2;
+			}
+			else if (ii < size and (data[ii] == '<' or data[ii] == '>')) {
+				spec.align = data[ii++];
+			}
+			if (ii < size and data[ii] == '0') {
+				spec.zero = true;
+				ii++;
+			}
+			const unsigned width = number(ii);
+			if (width > 255) {
+				result.error = FormatError::InvalidSpecification;
+				return result;
+			}
+			spec.width = width;
+			if (ii < size and data[ii] == '.')
+			{
+				ii++;
+				const std::size_t digits = ii;
+				const unsigned precision = number(ii);
+				if (ii == digits or precision > 127) {
+					result.error = FormatError::InvalidSpecification;
+					return result;
+				}
+				spec.precision = precision;
+			}
+			if (ii < size and data[ii] != '}')
+			{
+				constexpr const char types[] = "dxXbocfesp";
+				bool valid = false;
+				for (const char type : types) valid |= (type and type == data[ii]);
+				if (not valid) {
+					result.error = FormatError::InvalidSpecification;
+					return result;
+				}
+				spec.type = data[ii++];
+			}
+		}
+		if (ii >= size or data[ii] != '}') {
+			result.error = (ii >= size) ? FormatError::UnmatchedBrace : FormatError::InvalidSpecification;
+			return result;
+		}
+		ii++;
+		start = ii;
+
+		if (result.segments < capacity) segments[result.segments] = FormatSegment{0, 0, int16_t(result.arguments), spec};
+		result.segments++;
+		result.arguments++;
+	}
+	literal(start, size);
+	return result;
+}
+
+template< FormatString Format >
+struct ParsedFormat
+{
+	static constexpr FormatResult result = parseFormat(Format.data, Format.size, nullptr, 0);
+	static constexpr std::size_t size = (result.error == FormatError::None) ? result.segments : 0;
+
+	consteval
+	ParsedFormat()
+	{
+		parseFormat(Format.data, Format.size, segments, size);
+	}
+
+	FormatSegment segments[size ? size : 1] = {};
+};
+
+template< FormatString Format >
+inline constexpr ParsedFormat<Format> parsedFormat{};
+
+// ----------------------------------------------------------------------------
+template< typename T >
+constexpr bool isFormatString = std::is_convertible_v<const T&, const char*>;
+
+template< typename T >
+constexpr bool isFormatInteger = std::is_integral_v<T> and not std::is_same_v<T, bool>;
+
+/// @return `true` if the argument type supports the specification
+template< typename T >
+constexpr bool
+isFormatValid(const FormatSpec& spec)
+{
+	const bool layout = spec.width or spec.align or spec.zero;
+	const bool precision = spec.precision >= 0;
+	if constexpr (isFormatString<T>) {
+		return (spec.type == 0 or spec.type == 's') and not spec.zero;
+	}
+	else if constexpr (isFormatInteger<T>) {
+		return not precision and spec.type != 'f' and spec.type != 'e' and
+			   spec.type != 's' and spec.type != 'p';
+	}
+	else if constexpr (std::is_floating_point_v<T>) {
+		return (spec.type == 'f') or (spec.type == 0 and not precision and not layout) or
+			   (spec.type == 'e' and not precision and not layout);
+	}
+	else if constexpr (std::is_pointer_v<T>) {
+		return (spec.type == 0 or spec.type == 'p') and not precision and not layout;
+	}
+	else {
+		return spec.type == 0 and not precision and not layout;
+	}
+}
+
+/// Writes the fill characters in blocks
+inline void
+formatPadding(IOStream& stream, char fill, std::size_t count)
+{
+	char buffer[16];
+	for (char& c : buffer) c = fill;
+	while (count)
+	{
+		const std::size_t length = (count < sizeof(buffer)) ? count : sizeof(buffer);
+		stream.write(buffer, length);
+		count -= length;
+	}
+}
+
+inline void
+formatAligned(IOStream& stream, const char* data, std::size_t length, const FormatSpec& spec, bool right)
+{
+	const std::size_t padding = (spec.width > length) ? spec.width - length : 0;
+	if (spec.align == '>' or (right and spec.align != '<'))
+	{
+		formatPadding(stream, spec.fill, padding);
+		stream.write(data, length);
+	}
+	else
+	{
+		stream.write(data, length);
+		formatPadding(stream, spec.fill, padding);
+	}
+}
+
+/// Adds the sign left of `begin` and writes the number zero padded or aligned
+inline void
+formatNumber(IOStream& stream, char* begin, char* end, bool negative, const FormatSpec& spec)
+{
+	if (negative) *--begin = '-';
+	const std::size_t length = end - begin;
+	if (spec.zero and spec.width > length)
+	{
+		// the zeros go between the sign and the digits
+		if (negative) stream.write(*begin++);
+		formatPadding(stream, '0', spec.width - length);
+		stream.write(begin, end - begin);
+		return;
+	}
+	formatAligned(stream, begin, length, spec, true);
+}
+
+/// Converts the value right-aligned into the buffer
+template< typename U >
+inline char*
+formatDigits(char* end, U value, uint8_t base, char hex)
+{
+	do
+	{
+		const uint8_t digit = value % base;
+		*--end = (digit < 10) ? ('0' + digit) : (hex + digit - 10);
+		value /= base;
+	}
+	while(value);
+	return end;
+}
+
+template< typename T >
+void
+formatInteger(IOStream& stream, T value, const FormatSpec& spec)
+{
+	if (spec.type == 'c')
+	{
+		const char c = value;
+		formatAligned(stream, &c, 1, spec, false);
+		return;
+	}
+	using U = std::conditional_t<(sizeof(T) <= 4), uint32_t, uint64_t>;
+	bool negative = false;
+	if constexpr (std::is_signed_v<T>) negative = (value < 0);
+	// base 10 and 16 print the magnitude with a sign, base 2 and 8 the bits
+	const uint8_t base = (spec.type == 'x' or spec.type == 'X') ? 16 :
+						 (spec.type == 'b') ? 2 : (spec.type == 'o') ? 8 : 10;
+	const U magnitude = (negative and (base == 10 or base == 16)) ? U(0) - U(value) : U(std::make_unsigned_t<T>(value));
+
+	char buffer[sizeof(T) * 8 + 2];
+	char* const end = buffer + sizeof(buffer);
+	char* begin = formatDigits(end, magnitude, base, (spec.type == 'X') ? 'A' : 'a');
+	formatNumber(stream, begin, end, negative and (base == 10 or base == 16), spec);
+}
+
+/// Fixed point like printf `%f`, larger values than 2^32 in scientific notation
+template< typename F >
+void
+formatFixed(IOStream& stream, F value, const FormatSpec& spec)
+{
+	if (std::isnan(value)) {
+		formatAligned(stream, "nan", 3, spec, true);
+		return;
+	}
+	const bool negative = std::signbit(value);
+	if (negative) value = -value;
+	if (std::isinf(value)) {
+		formatAligned(stream, negative ? "-inf" : "inf", 3 + negative, spec, true);
+		return;
+	}
+	if (value >= F(4294967295.0)) {
+		stream << (negative ? -value : value);
+		return;
+	}
+	constexpr uint32_t pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+	const uint8_t precision = (spec.precision < 0) ? 6 : (spec.precision > 9) ? 9 : spec.precision;
+
+	uint32_t whole = value;
+	const F scaled = (value - F(whole)) * F(pow10[precision]);
+	uint32_t fraction = scaled;
+	const F rest = scaled - F(fraction);
+	// round half to even, like printf
+	if (rest > F(0.5) or (rest == F(0.5) and (precision ? (fraction & 1) : (whole & 1))))
+	{
+		if (precision == 0) {
+			whole++;
+		}
+		else if (++fraction >= pow10[precision]) {
+			fraction = 0;
+			whole++;
+		}
+	}
+
+	char buffer[2 + 10 + 1 + 9 + 8];
+	char* const end = buffer + sizeof(buffer);
+	char* begin = end;
+	if (precision)
+	{
+		begin = formatDigits(end, fraction, 10, 'a');
+		while (end - begin < precision) *--begin = '0';
+		*--begin = '.';
+	}
+	begin = formatDigits(begin, whole, 10, 'a');
+	formatNumber(stream, begin, end, negative, spec);
+}
+
+template< typename T >
+void
+formatArgument(IOStream& stream, const T& value, const FormatSpec& spec)
+{
+	if constexpr (isFormatString<T>)
+	{
+		const char* string = value;
+		std::size_t length = 0;
+		const std::size_t limit = (spec.precision < 0) ? std::size_t(-1) : spec.precision;
+		while (length < limit and string[length]) length++;
+		formatAligned(stream, string, length, spec, false);
+	}
+	else if constexpr (std::is_same_v<T, char>)
+	{
+		if (spec.type == 0) formatAligned(stream, &value, 1, spec, false);
+		else formatInteger(stream, value, spec);
+	}
+	else if constexpr (isFormatInteger<T>) {
+		formatInteger(stream, value, spec);
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		// float arithmetic for float values, long double is not supported
+		using F = std::conditional_t<std::is_same_v<T, float>, float, double>;
+		if (spec.type == 'f') formatFixed(stream, F(value), spec);
+		else stream << value;
+	}
+	else {
+		stream << value;
+	}
+}
+
+/// Arguments and the compile-time parsed format string
+template< FormatString Format, typename... Args >
+class Formatted
+{
+	static constexpr const auto& parsed = parsedFormat<Format>;
+	static_assert(parsed.result.error != FormatError::UnmatchedBrace,
+				  "Unmatched '{' or '}' in the format string, use '{{' and '}}' for braces!");
+	static_assert(parsed.result.error != FormatError::InvalidSpecification,
+				  "Invalid format specification, use '{:[[fill]align][0][width][.precision][type]}'!");
+	static_assert(parsed.result.error != FormatError::None or parsed.result.arguments == sizeof...(Args),
+				  "The number of arguments does not match the format string!");
+
+public:
+	constexpr
+	Formatted(const Args&... args) :
+		arguments(args...)
+	{}
+
+	void
+	write(IOStream& stream) const
+	{
+		write(stream, std::make_index_sequence<parsed.size>{});
+	}
+
+private:
+	template< std::size_t... Segments >
+	void
+	write(IOStream& stream, std::index_sequence<Segments...>) const
+	{
+		(writeSegment<Segments>(stream), ...);
+	}
+
+	template< std::size_t Segment >
+	void
+	writeSegment(IOStream& stream) const
+	{
+		constexpr FormatSegment segment = parsed.segments[Segment];
+		if constexpr (segment.argument < 0) {
+			stream.write(Format.data + segment.offset, segment.length);
+		}
+		else
+		{
+			using T = std::remove_cvref_t<std::tuple_element_t<segment.argument, std::tuple<Args...>>>;
+			static_assert(isFormatValid<T>(segment.spec),
+						  "The format specification is not supported by the argument type!");
+			formatArgument(stream, std::get<segment.argument>(arguments), segment.spec);
+		}
+	}
+
+	std::tuple<const Args&...> arguments;
+};
+
+}	// namespace detail
+/// @endcond
+
+/**
+ * Formats the arguments with a format string parsed at compile time.
+ *
+ * The format string is split into literal text and typed write operations
+ * when compiling, so nothing is parsed at runtime and only the formatting
+ * code of the used types is linked. The number of arguments and their types
+ * are checked against the format string with `static_assert`.
+ *
+ * Every `{}` is replaced by the next argument, `{{` and `}}` are written as
+ * braces. The optional specification `{:[[fill]align][0][width][.precision][type]}`
+ * supports:
+ *
+ * - align: `<` left, `>` right, the default is right for numbers.
+ * - `0`: pads numbers with zeros after the sign.
+ * - type for integers: `d` decimal, `x` and `X` hexadecimal, `b` binary,
+ *   `o` octal and `c` character.
+ * - type for floats: `f` fixed point, 6 digits after the decimal point by
+ *   default and at most 9, the default and `e` are scientific like the stream.
+ * - type for strings: `s`, the precision limits the number of characters.
+ *
+ * Any other type with a stream operator is supported without specification.
+ * The result holds references to the arguments and must be written to the
+ * stream in the same expression:
+ *
+ * @code
+ * MODM_LOG_INFO << modm::format<"x={:>6} y={:.3f} state={}\n">(x, y, "running");
+ * @endcode
+ *
+ * @ingroup modm_io
+ * @author	Thomas Sommer
+ */
+template< detail::FormatString Format, typename... Args >
+constexpr detail::Formatted<Format, Args...>
+format(const Args&... args)
+{
+	return {args...};
+}
+
+/// @ingroup modm_io
+template< detail::FormatString Format, typename... Args >
+inline IOStream&
+operator << (IOStream& stream, const detail::Formatted<Format, Args...>& formatted)
+{
+	formatted.write(stream);
+	return stream;
+}
+
+}	// namespace modm
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_CHOLESKY_DECOMPOSITION_HPP
+#define MODM_CHOLESKY_DECOMPOSITION_HPP
+
+#include <cmath>
+#include "matrix.hpp"
+
+namespace modm
+{
+	/**
+	 * \brief	Class for decomposing symmetric positive-definite matrices
+	 *
+	 * Factorise a matrix A into a lower triangular matrix L such that
+	 * A = L*L^T. This needs half the operations of a LU decomposition and no
+	 * pivoting, which makes it the preferred way to solve the systems with
+	 * covariance matrices of a Kalman filter.
+	 *
+	 * Only the lower triangle of A is read.
+	 *
+	 * \ingroup	modm_math_matrix
+	 * \author	Thomas Sommer
+	 */
+	class CholeskyDecomposition
+	{
+	public:
+		/**
+		 * \brief	Factorise the matrix into L
+		 *
+		 * \return	`false` if the matrix is not positive-definite
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decompose(const Matrix<T, N, N> &matrix,
+				Matrix<T, N, N> *l);
+
+		/**
+		 * \brief	Factorise the matrix in place
+		 *
+		 * Afterwards the lower triangle and diagonal contain L, the upper
+		 * triangle is not changed.
+		 *
+		 * \return	`false` if the matrix is not positive-definite
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decomposeInPlace(Matrix<T, N, N> *matrix);
+
+		/**
+		 * \brief	Solve A*X = B with L and overwrite B with X
+		 *
+		 * Only the lower triangle and diagonal of L are read, so the result
+		 * of decomposeInPlace() can be used directly.
+		 */
+		template <typename T, uint8_t N, uint8_t BXWIDTH>
+		static void
+		solve(const Matrix<T, N, N> &l,
+				Matrix<T, N, BXWIDTH> *xb);
+	};
+}
+
+#include "cholesky_decomposition_impl.hpp"
+
+#endif // MODM_CHOLESKY_DECOMPOSITION_HPP
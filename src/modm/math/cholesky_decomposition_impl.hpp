@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_CHOLESKY_DECOMPOSITION_HPP
+	#error	"Don't include this file directly, use 'cholesky_decomposition.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+modm::CholeskyDecomposition::decompose(
+		const modm::Matrix<T, SIZE, SIZE> &matrix,
+		modm::Matrix<T, SIZE, SIZE> *l)
+{
+	*l = matrix;
+	if (not decomposeInPlace(l)) {
+		return false;
+	}
+	for (uint_fast8_t j = 0; j < SIZE; ++j) {
+		for (uint_fast8_t i = j+1; i < SIZE; ++i) {
+			(*l)[j][i] = 0;
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+modm::CholeskyDecomposition::decomposeInPlace(modm::Matrix<T, SIZE, SIZE> *matrix)
+{
+	modm::Matrix<T, SIZE, SIZE> &a = *matrix;
+	for (uint_fast8_t j = 0; j < SIZE; ++j)
+	{
+		T diagonal = a[j][j];
+		for (uint_fast8_t k = 0; k < j; ++k) {
+			diagonal -= a[j][k] * a[j][k];
+		}
+		if (not (diagonal > T(0))) {
+			return false;
+		}
+		diagonal = std::sqrt(diagonal);
+		a[j][j] = diagonal;
+
+		const T inverse = T(1) / diagonal;
+		for (uint_fast8_t i = j+1; i < SIZE; ++i)
+		{
+			T value = a[i][j];
+			for (uint_fast8_t k = 0; k < j; ++k) {
+				value -= a[i][k] * a[j][k];
+			}
+			a[i][j] = value * inverse;
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t BXWIDTH>
+void
+modm::CholeskyDecomposition::solve(
+		const modm::Matrix<T, SIZE, SIZE> &l,
+		modm::Matrix<T, SIZE, BXWIDTH> *xb)
+{
+	modm::Matrix<T, SIZE, BXWIDTH> &x = *xb;
+
+	// forward substitution with L
+	for (uint_fast8_t j = 0; j < SIZE; ++j)
+	{
+		for (uint_fast8_t k = 0; k < j; ++k) {
+			for (uint_fast8_t i = 0; i < BXWIDTH; ++i) {
+				x[j][i] -= l[j][k] * x[k][i];
+			}
+		}
+		const T inverse = T(1) / l[j][j];
+		for (uint_fast8_t i = 0; i < BXWIDTH; ++i) {
+			x[j][i] *= inverse;
+		}
+	}
+
+	// backward substitution with L^T
+	for (uint_fast8_t j = SIZE; j-- > 0;)
+	{
+		for (uint_fast8_t k = j+1; k < SIZE; ++k) {
+			for (uint_fast8_t i = 0; i < BXWIDTH; ++i) {
+				x[j][i] -= l[k][j] * x[k][i];
+			}
+		}
+		const T inverse = T(1) / l[j][j];
+		for (uint_fast8_t i = 0; i < BXWIDTH; ++i) {
+			x[j][i] *= inverse;
+		}
+	}
+}
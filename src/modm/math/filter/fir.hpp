@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Kevin Läufer
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -16,6 +17,9 @@
 #define MODM_FIR_HPP
 
 #include <stdint.h>
+#include <cstddef>
+#include <type_traits>
+#include <modm/math/utils/arithmetic_traits.hpp>
 
 namespace modm
 {
@@ -24,7 +28,19 @@ namespace modm
 	 *
 	 * g[n] = SUM(h[k]x[n-k])
 	 *
-	 * \todo
+	 * The samples are kept in chronological order in a linear delay line of
+	 * N + BLOCK_SIZE samples, which is only moved back to the start after
+	 * BLOCK_SIZE samples, so that the convolution never has to wrap around.
+	 * A BLOCK_SIZE of N therefore makes this a double-length delay line.
+	 *
+	 * Samples can be filtered one at a time with append() and update(), or
+	 * a whole block at once with process(), which computes several outputs
+	 * per pass over the coefficients. This saves most of the memory accesses
+	 * and lets the compiler vectorize the inner loop for SSE or NEON.
+	 *
+	 * Integer types are accumulated in the next wider type, so fixed-point
+	 * formats are supported by choosing `ScaleFactor` accordingly, e.g. Q15
+	 * with `Fir<int16_t, N, B, 32768>`.
 	 *
 	 * \author	Kevin Laeufer
 	 * \ingroup modm_math_filter
@@ -68,6 +84,19 @@ namespace modm
 			void
 			update();
 
+			/**
+			 * \brief	Filters a block of samples
+			 *
+			 * Equivalent to calling append() and update() for every input
+			 * sample, afterwards getValue() returns the last output.
+			 *
+			 * \param	input	samples to filter
+			 * \param	out		filtered samples, may be the same as \p input
+			 * \param	length	number of samples in \p input and \p out
+			 */
+			void
+			process(const T *input, T *out, std::size_t length);
+
 			/**
 			 * \brief	Returns g[0].
 			 */
@@ -78,9 +107,22 @@ namespace modm
 			}
 
 		private:
+			using Accumulator = std::conditional_t<std::is_floating_point_v<T>,
+												   T, modm::WideType<T> >;
+
+			/// Computes out[k] from window[k] to window[k + N - 1]
+			void
+			convolve(const T *window, T *out, std::size_t count) const;
+
+			/// Moves the last N - 1 samples to the start of the delay line
+			void
+			rewind();
+
 			T output;
 			T taps[N+BLOCK_SIZE];
+			/// in reverse order, so that they match the chronological taps
 			T coefficients[N];
+			/// one past the newest sample
 			int taps_index;
 		};
 	}
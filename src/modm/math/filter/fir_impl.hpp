@@ -2,6 +2,7 @@
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012-2013, Kevin Läufer
  * Copyright (c) 2012, 2015-2016, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,27 +15,9 @@
 #ifndef MODM_FIR_IMPL_HPP
 #define MODM_FIR_IMPL_HPP
 
+#include <algorithm>
 #include <modm/architecture/utils.hpp>
 
-//#define FIR_DEBUG
-
-#ifdef FIR_DEBUG
-	#include <stdio.h>
-
-	//#define FIR_DEBUG_APPEND
-	#define FIR_DEBUG_UPDATE
-
-	#ifdef FIR_DEBUG_UPDATE
-	#define FIR_DEBUG_SUM(tap, coeff) printf("sum += %.3f * %.3f;\n", tap, coeff)
-	#else
-	#define FIR_DEBUG_SUM(tap, coeff)
-	#endif /*FIR_DEBUG_UPDATE*/
-#else
-	#define FIR_DEBUG_SUM(tap, coeff)
-#endif /*FIR_DEBUG*/
-
-
-
 template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::Fir(const float (&coeff)[N])
 {
@@ -48,7 +31,7 @@ void
 modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::setCoefficients(const float (&coeff)[N])
 {
 	for(int i = 0; i < N; i++){
-		coefficients[i] = static_cast<T>(coeff[i] * ScaleFactor);
+		coefficients[N - 1 - i] = static_cast<T>(coeff[i] * ScaleFactor);
 	}
 }
 
@@ -57,11 +40,21 @@ template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 void
 modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::reset()
 {
-	// reset all to make debugging easier
 	for(int i = 0; i < N + BLOCK_SIZE; i++){
 		taps[i] = (T)0;
 	}
-	taps_index = BLOCK_SIZE;
+	// the window of the first update() consists of N zero samples
+	taps_index = N;
+	output = (T)0;
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::rewind()
+{
+	std::copy(taps + taps_index - (N - 1), taps + taps_index, taps);
+	taps_index = N - 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -69,31 +62,10 @@ template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 void
 modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::append(const T& input)
 {
-#ifdef FIR_DEBUG_APPEND
-	printf("append(%f);\ttaps_index=%d\n", input, taps_index);
-	printf("BEFORE: ");
-	for(int i = 0; i < N + BLOCK_SIZE; i++)
-		if(i >= taps_index && i-taps_index < N) printf("n-%d:%.3f; ", i-taps_index, taps[i]);
-		else printf("(%.3f)    ", taps[i]);
-	printf("\n");
-#endif // FIR_DEBUG_APPEND
-	if(modm_likely(taps_index > 0)){
-		taps_index--;
+	if(modm_unlikely(taps_index == N + BLOCK_SIZE)){
+		rewind();
 	}
-	else{
-		for(int i = N + BLOCK_SIZE - 1; i > BLOCK_SIZE; i--)
-			taps[i] = taps[i - BLOCK_SIZE - 1];
-		taps_index = BLOCK_SIZE;
-	}
-	taps[taps_index] = input;
-
-#ifdef FIR_DEBUG_APPEND
-	printf(" AFTER: ");
-	for(int i = 0; i < N + BLOCK_SIZE; i++)
-		if(i >= taps_index && i-taps_index < N) printf("n-%d:%.3f; ", i-taps_index, taps[i]);
-		else printf("(%.3f)    ", taps[i]);
-	printf("\n\n");
-#endif // FIR_DEBUG_APPEND
+	taps[taps_index++] = input;
 }
 
 // -----------------------------------------------------------------------------
@@ -101,33 +73,94 @@ template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 void
 modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::update()
 {
-#ifdef FIR_DEBUG_UPDATE
-	printf("update();\ttaps_index=%d\n", taps_index);
-	for(int i = 0; i < N + BLOCK_SIZE; i++)
-		if(i >= taps_index && i-taps_index < N) printf("n-%d:%.3f; ", i-taps_index, taps[i]);
-		else printf("(%.3f)    ", taps[i]);
-	printf("\n");
-#endif // FIR_DEBUG_UPDATE
+	convolve(taps + taps_index - N, &output, 1);
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::process(
+		const T *input, T *out, std::size_t length)
+{
+	if (length == 0) return;
+	while (length)
+	{
+		if(taps_index == N + BLOCK_SIZE){
+			rewind();
+		}
+		const std::size_t count = std::min<std::size_t>(length, N + BLOCK_SIZE - taps_index);
+
+		// the input is consumed before the output is written, so they may alias
+		std::copy(input, input + count, taps + taps_index);
+		convolve(taps + taps_index + 1 - N, out, count);
 
-	T sum = (T)0;
-	T *tap = taps + taps_index;
-	for(int i = 0; i < (N - (N%4)); i++){
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i];
+		taps_index += count;
+		input += count;
+		out += count;
+		length -= count;
 	}
-	for(int i = (N - (N%4)); i < N; i++){
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i];
+	output = out[-1];
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::convolve(
+		const T *window, T *out, std::size_t count) const
+{
+	std::size_t k = 0;
+	// several outputs share every coefficient load
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		// floating point sums cannot be reordered by the compiler, instead
+		// the independent sums are mapped onto the vector registers
+		constexpr std::size_t Lanes = 8;
+		for(; k + Lanes <= count; k += Lanes)
+		{
+			Accumulator sum[Lanes] = {};
+			const T *tap = window + k;
+			for(int i = 0; i < N; i++)
+			{
+				const Accumulator coefficient = coefficients[i];
+				for(std::size_t lane = 0; lane < Lanes; lane++){
+					sum[lane] += coefficient * tap[i + lane];
+				}
+			}
+			for(std::size_t lane = 0; lane < Lanes; lane++){
+				out[k + lane] = sum[lane] / ScaleFactor;
+			}
+		}
+	}
+	else
+	{
+		// integer sums are vectorized along the coefficients
+		for(; k + 4 <= count; k += 4)
+		{
+			Accumulator sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+			const T *tap = window + k;
+			for(int i = 0; i < N; i++)
+			{
+				const Accumulator coefficient = coefficients[i];
+				sum0 += coefficient * tap[i];
+				sum1 += coefficient * tap[i + 1];
+				sum2 += coefficient * tap[i + 2];
+				sum3 += coefficient * tap[i + 3];
+			}
+			out[k] = static_cast<T>(sum0 / ScaleFactor);
+			out[k + 1] = static_cast<T>(sum1 / ScaleFactor);
+			out[k + 2] = static_cast<T>(sum2 / ScaleFactor);
+			out[k + 3] = static_cast<T>(sum3 / ScaleFactor);
+		}
+	}
+	for(; k < count; k++)
+	{
+		Accumulator sum = 0;
+		const T *tap = window + k;
+		for(int i = 0; i < N; i++){
+			sum += Accumulator(coefficients[i]) * tap[i];
+		}
+		out[k] = static_cast<T>(sum / ScaleFactor);
 	}
-	output = sum / ScaleFactor;
-#ifdef FIR_DEBUG_UPDATE
-	printf("sum=%.3f\n", output);
-#endif // FIR_DEBUG_UPDATE
 }
+
 #endif // MODM_FIR_IMPL_HPP
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -23,6 +24,7 @@ namespace modm
 }
 
 #include "interpolation/linear.hpp"
+#include "interpolation/uniform_linear.hpp"
 #include "interpolation/lagrange.hpp"
 
 #endif	// MODM_INTERPOLATION_HPP
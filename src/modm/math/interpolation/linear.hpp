@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Thorsten Lajewski
  * Copyright (c) 2009-2011, 2013, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -24,17 +25,34 @@ namespace modm
 {
 	namespace interpolation
 	{
+		/**
+		 * How the interval of the input value is found.
+		 *
+		 * \ingroup	modm_math_interpolation
+		 */
+		enum class
+		Search : uint8_t
+		{
+			Linear,		///< Walk all points, fastest for a few points
+			Binary,		///< O(log n) bisection, use for larger tables
+		};
+
 		/**
 		 * \tparam	T			Any specialization of modm::Pair<>
 		 * \tparam	Accessor	Accessor class. Can be modm::accessor::Ram,
 		 * 						modm::accessor::Flash or any self defined
 		 * 						accessor class.
 		 * 						Default is modm::accessor::Ram.
+		 * \tparam	search		Search strategy for the interval,
+		 * 						both deliver identical results.
+		 * 						Default is Search::Linear.
 		 *
+		 * \see		modm::interpolation::UniformLinear for equidistant points
 		 * \ingroup	modm_math_interpolation
 		 */
 		template <typename T,
-				  template <typename> class Accessor = ::modm::accessor::Ram>
+				  template <typename> class Accessor = ::modm::accessor::Ram,
+				  Search search = Search::Linear>
 		class Linear
 		{
 		public:
@@ -52,7 +70,7 @@ namespace modm
 			 * 								Needs to be an Array of modm::Pair<>.
 			 * \param	numberOfPoints		length of \p supportingPoints
 			 */
-			Linear(Accessor<T> supportingPoints, uint8_t numberOfPoints);
+			Linear(Accessor<T> supportingPoints, uint16_t numberOfPoints);
 
 			/**
 			 * \brief	Perform a linear interpolation
@@ -64,8 +82,13 @@ namespace modm
 			interpolate(const InputType& value) const;
 
 		private:
+			/// Index of the first point greater or equal to \p value,
+			/// which must be inside of the supporting points.
+			uint16_t
+			findInterval(const InputType& value) const;
+
 			const Accessor<T> supportingPoints;
-			const uint8_t numberOfPoints;
+			const uint16_t numberOfPoints;
 		};
 	}
 }
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Thorsten Lajewski
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -17,49 +18,77 @@
 
 // ----------------------------------------------------------------------------
 template <typename T,
-		  template <typename> class Accessor>
-modm::interpolation::Linear<T, Accessor>::Linear(
-		Accessor<T> supportingPoints, uint8_t numberOfPoints) :
+		  template <typename> class Accessor,
+		  modm::interpolation::Search search>
+modm::interpolation::Linear<T, Accessor, search>::Linear(
+		Accessor<T> supportingPoints, uint16_t numberOfPoints) :
 	supportingPoints(supportingPoints), numberOfPoints(numberOfPoints)
 {
 }
 
 // ----------------------------------------------------------------------------
 template <typename T,
-		  template <typename> class Accessor>
-typename modm::interpolation::Linear<T, Accessor>::OutputType
-modm::interpolation::Linear<T, Accessor>::interpolate(const InputType& value) const
+		  template <typename> class Accessor,
+		  modm::interpolation::Search search>
+uint16_t
+modm::interpolation::Linear<T, Accessor, search>::findInterval(const InputType& value) const
 {
-	T current(this->supportingPoints[0]);
-
-	if (value <= current.getFirst()) {
-		return current.getSecond();
+	if constexpr (search == Search::Binary)
+	{
+		// invariant: point[base] < value, without unpredictable branches
+		uint16_t base = 0;
+		uint16_t length = this->numberOfPoints;
+		while (length > 1)
+		{
+			const uint16_t half = length / 2;
+			if (T(this->supportingPoints[base + half]).getFirst() < value) {
+				base += half;
+			}
+			length -= half;
+		}
+		return base + 1;
 	}
-
-	T last(current);
-	uint8_t i;
-	for (i = 1; i < this->numberOfPoints; ++i)
+	else
 	{
-		current = this->supportingPoints[i];
+		uint16_t i = 1;
+		while (value > T(this->supportingPoints[i]).getFirst()) {
+			++i;
+		}
+		return i;
+	}
+}
 
-		if (value <= current.getFirst())
-		{
-			InputType x1_in = last.getFirst();
-			InputType x2_in = current.getFirst();
+// ----------------------------------------------------------------------------
+template <typename T,
+		  template <typename> class Accessor,
+		  modm::interpolation::Search search>
+typename modm::interpolation::Linear<T, Accessor, search>::OutputType
+modm::interpolation::Linear<T, Accessor, search>::interpolate(const InputType& value) const
+{
+	const T first(this->supportingPoints[0]);
+	if (value <= first.getFirst()) {
+		return first.getSecond();
+	}
 
-			OutputType x1_out = last.getSecond();
-			OutputType x2_out = current.getSecond();
+	const T end(this->supportingPoints[this->numberOfPoints - 1]);
+	if (value > end.getFirst()) {
+		return end.getSecond();
+	}
 
-			InputType a = value - x1_in;		// >0
-			WideType b = static_cast<OutputSignedType>(x2_out) -
-						 static_cast<OutputSignedType>(x1_out);
-			InputType c = x2_in - x1_in;		// >0
+	const uint16_t i = findInterval(value);
+	const T last(this->supportingPoints[i - 1]);
+	const T current(this->supportingPoints[i]);
 
-			return static_cast<OutputType>(((a * b) / c) + x1_out);
-		}
+	InputType x1_in = last.getFirst();
+	InputType x2_in = current.getFirst();
 
-		last = current;
-	}
+	OutputType x1_out = last.getSecond();
+	OutputType x2_out = current.getSecond();
+
+	InputType a = value - x1_in;		// >0
+	WideType b = static_cast<OutputSignedType>(x2_out) -
+				 static_cast<OutputSignedType>(x1_out);
+	InputType c = x2_in - x1_in;		// >0
 
-	return current.getSecond();
+	return static_cast<OutputType>(((a * b) / c) + x1_out);
 }
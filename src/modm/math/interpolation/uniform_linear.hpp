@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_INTERPOLATION_UNIFORM_LINEAR_HPP
+#define	MODM_INTERPOLATION_UNIFORM_LINEAR_HPP
+
+#include <stdint.h>
+
+#include <modm/math/utils/arithmetic_traits.hpp>
+#include <modm/architecture/interface/accessor.hpp>
+
+namespace modm
+{
+	namespace interpolation
+	{
+		/**
+		 * Linear interpolation of equidistant supporting points.
+		 *
+		 * Only the output values are stored, the input value of point `i` is
+		 * `Start + i * Step`. Since the spacing is known at compile time the
+		 * interval is computed with one division by a constant instead of a
+		 * search, which makes the lookup O(1) regardless of the table size.
+		 * Integer input types are interpolated in fixed-point, choose a
+		 * power of two for `Step` to replace the divisions with shifts.
+		 *
+		 * \tparam	InputType	Integer or floating point input type
+		 * \tparam	OutputType	Integer or floating point output type
+		 * \tparam	Start		Input value of the first point
+		 * \tparam	Step		Distance between two points, must be positive
+		 * \tparam	Accessor	Accessor class. Can be modm::accessor::Ram,
+		 * 						modm::accessor::Flash or any self defined
+		 * 						accessor class.
+		 * 						Default is modm::accessor::Ram.
+		 *
+		 * \ingroup	modm_math_interpolation
+		 */
+		template <typename InputType, typename OutputType,
+				  InputType Start, InputType Step,
+				  template <typename> class Accessor = ::modm::accessor::Ram>
+		class UniformLinear
+		{
+			static_assert(Step > 0, "The distance between the points must be positive!");
+
+		public:
+			typedef modm::SignedType< OutputType > OutputSignedType;
+			typedef modm::WideType< OutputSignedType > WideType;
+			/// Distance of the input value to the start, which cannot overflow
+			typedef modm::UnsignedType< InputType > OffsetType;
+
+		public:
+			/**
+			 * \brief	Constructor
+			 *
+			 * \param	values			Output values at the supporting points.
+			 * \param	numberOfValues	length of \p values, at least one
+			 */
+			UniformLinear(Accessor<OutputType> values, uint16_t numberOfValues);
+
+			/**
+			 * \brief	Perform a linear interpolation
+			 *
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType
+			interpolate(const InputType& value) const;
+
+			/// Input value of the last supporting point
+			InputType
+			getEnd() const
+			{ return end; }
+
+		private:
+			const Accessor<OutputType> values;
+			const uint16_t numberOfValues;
+			const InputType end;
+		};
+	}
+}
+
+#include "uniform_linear_impl.hpp"
+
+#endif	// MODM_INTERPOLATION_UNIFORM_LINEAR_HPP
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_INTERPOLATION_UNIFORM_LINEAR_HPP
+   #error "Don't include this file directly. Use 'modm/math/interpolation/uniform_linear.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  InputType Start, InputType Step,
+		  template <typename> class Accessor>
+modm::interpolation::UniformLinear<InputType, OutputType, Start, Step, Accessor>::UniformLinear(
+		Accessor<OutputType> values, uint16_t numberOfValues) :
+	values(values), numberOfValues(numberOfValues),
+	end(static_cast<InputType>(Start + (numberOfValues - 1) * Step))
+{
+}
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  InputType Start, InputType Step,
+		  template <typename> class Accessor>
+OutputType
+modm::interpolation::UniformLinear<InputType, OutputType, Start, Step, Accessor>::interpolate(
+		const InputType& value) const
+{
+	if (value <= Start) {
+		return this->values[0];
+	}
+	if (value >= this->end) {
+		return this->values[this->numberOfValues - 1];
+	}
+
+	const OffsetType offset = static_cast<OffsetType>(value - Start);
+	const uint16_t i = static_cast<uint16_t>(offset / Step);
+	if (i >= this->numberOfValues - 1) {
+		// rounding of floating point values just below the end
+		return this->values[this->numberOfValues - 1];
+	}
+	const OffsetType a = static_cast<OffsetType>(offset - i * Step);		// >=0
+
+	const OutputType x1_out = this->values[i];
+	const OutputType x2_out = this->values[i + 1];
+	const WideType b = static_cast<OutputSignedType>(x2_out) -
+					   static_cast<OutputSignedType>(x1_out);
+
+	if constexpr (std::is_floating_point_v<InputType>) {
+		return static_cast<OutputType>(((a * b) / Step) + x1_out);
+	} else {
+		// fixed-point: a < Step, so the product fits into the wide type
+		return static_cast<OutputType>(((WideType(a) * b) / WideType(Step)) + x1_out);
+	}
+}
@@ -2,6 +2,7 @@
  * Copyright (c) 2011, Fabian Greif
  * Copyright (c) 2011-2012, Niklas Hauser
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,11 @@
 #ifndef MODM_LU_DECOMPOSITION_HPP
 #define MODM_LU_DECOMPOSITION_HPP
 
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <modm/math/utils/arithmetic_traits.hpp>
+
 #include "matrix.hpp"
 #include "geometry/vector.hpp"
 
@@ -66,11 +72,44 @@ namespace modm
 				const Matrix<T, N, N> &u,
 				Matrix<T, N, BXWIDTH> *xb);
 
+		/**
+		 * \brief	Solve A*X = B and overwrite B with X
+		 *
+		 * \return	`false` if A is singular
+		 */
 		template <typename T, uint8_t N, uint8_t BXWIDTH>
 		static bool
 		solve(const Matrix<T, N, N> &A,
 				Matrix<T, N, BXWIDTH> *xb);
 
+		/**
+		 * \brief	Factorise a matrix in place, so that P*A = L*U
+		 *
+		 * Uses partial pivoting. Afterwards the lower triangle contains L
+		 * without its unit diagonal, the diagonal and upper triangle contain U.
+		 *
+		 * \param	p		row permutation, row i of L*U is row p[i] of A
+		 * \param	sign	sign of the permutation, to compute the determinant
+		 * \return	`false` if the matrix is singular
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decomposeInPlace(Matrix<T, N, N> *lu,
+				Vector<int8_t, N> *p,
+				int8_t *sign = nullptr);
+
+		/**
+		 * \brief	Solve A*X = B with the factorisation of decomposeInPlace()
+		 *
+		 * Overwrites B with X, so the factorisation can be reused for
+		 * several right-hand sides without forming the inverse.
+		 */
+		template <typename T, uint8_t N, uint8_t BXWIDTH>
+		static void
+		solveInPlace(const Matrix<T, N, N> &lu,
+				const Vector<int8_t, N> &p,
+				Matrix<T, N, BXWIDTH> *xb);
+
 
 	private:
 		template<typename T, uint8_t OFFSET, uint8_t HEIGHT, uint8_t WIDTH>
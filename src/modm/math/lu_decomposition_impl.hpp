@@ -2,6 +2,7 @@
  * Copyright (c) 2011, Fabian Greif
  * Copyright (c) 2011-2012, Niklas Hauser
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -82,18 +83,196 @@ modm::LUDecomposition::solve(
 		const modm::Matrix<T, SIZE, SIZE> &A,
 		modm::Matrix<T, SIZE, BXWIDTH> *xb)
 {
-	modm::Matrix<T, SIZE, SIZE> l;
-	modm::Matrix<T, SIZE, SIZE> u;
-	modm::Matrix<T, SIZE, SIZE> p;
-	if(not(decompose(A, &l, &u, &p))){
+	modm::Matrix<T, SIZE, SIZE> lu(A);
+	modm::Vector<int8_t, SIZE> p;
+	if (not decomposeInPlace(&lu, &p)) {
 		return false;
 	}
-	*xb = (p * (*xb));
-	if(not(solve(l, u, xb))){
-		return false;}
+	solveInPlace(lu, p, xb);
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+modm::LUDecomposition::decomposeInPlace(
+		modm::Matrix<T, SIZE, SIZE> *lu,
+		modm::Vector<int8_t, SIZE> *p,
+		int8_t *sign)
+{
+	modm::Matrix<T, SIZE, SIZE> &a = *lu;
+	int8_t parity = 1;
+	for (uint_fast8_t i = 0; i < SIZE; ++i) {
+		(*p)[i] = i;
+	}
+
+	for (uint_fast8_t k = 0; k < SIZE; ++k)
+	{
+		// swap with the lower row with the largest value in this column
+		uint_fast8_t maxRow = k;
+		T max = std::abs(a[k][k]);
+		for (uint_fast8_t j = k+1; j < SIZE; ++j)
+		{
+			const T v = std::abs(a[j][k]);
+			if (v > max)
+			{
+				max = v;
+				maxRow = j;
+			}
+		}
+		if (max == T(0)) {
+			return false;
+		}
+		if (maxRow != k)
+		{
+			RowOperation<T, SIZE>::swap(a[maxRow], a[k]);
+			const int8_t temp = (*p)[k];
+			(*p)[k] = (*p)[maxRow];
+			(*p)[maxRow] = temp;
+			parity = -parity;
+		}
+
+		// eliminate the column below the diagonal
+		const T inverse = T(1) / a[k][k];
+		for (uint_fast8_t j = k+1; j < SIZE; ++j)
+		{
+			const T factor = a[j][k] * inverse;
+			a[j][k] = factor;
+			for (uint_fast8_t i = k+1; i < SIZE; ++i) {
+				a[j][i] -= factor * a[k][i];
+			}
+		}
+	}
+
+	if (sign) {
+		*sign = parity;
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t BXWIDTH>
+void
+modm::LUDecomposition::solveInPlace(
+		const modm::Matrix<T, SIZE, SIZE> &lu,
+		const modm::Vector<int8_t, SIZE> &p,
+		modm::Matrix<T, SIZE, BXWIDTH> *xb)
+{
+	modm::Matrix<T, SIZE, BXWIDTH> &x = *xb;
+
+	// apply the permutation
+	const modm::Matrix<T, SIZE, BXWIDTH> b(x);
+	for (uint_fast8_t j = 0; j < SIZE; ++j) {
+		memcpy(x[j], b[p[j]], BXWIDTH * sizeof(T));
+	}
+
+	// forward substitution with L, which has a unit diagonal
+	for (uint_fast8_t j = 1; j < SIZE; ++j) {
+		for (uint_fast8_t k = 0; k < j; ++k) {
+			RowOperation<T, BXWIDTH>::addRowTimesFactor(x[j], x[j], x[k], -lu[j][k]);
+		}
+	}
+
+	// backward substitution with U
+	for (uint_fast8_t j = SIZE; j-- > 0;)
+	{
+		for (uint_fast8_t k = j+1; k < SIZE; ++k) {
+			RowOperation<T, BXWIDTH>::addRowTimesFactor(x[j], x[j], x[k], -lu[j][k]);
+		}
+		RowOperation<T, BXWIDTH>::multiply(x[j], x[j], T(1) / lu[j][j]);
+	}
+}
+
+//=============================================================================
+// modm::Matrix functions based on the decomposition
+//=============================================================================
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+T
+modm::determinant(const modm::Matrix<T, N, N> &m)
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		modm::Matrix<T, N, N> lu(m);
+		modm::Vector<int8_t, N> p;
+		int8_t sign;
+		if (not LUDecomposition::decomposeInPlace(&lu, &p, &sign)) {
+			return 0;
+		}
+
+		T value = sign;
+		for (uint_fast8_t i = 0; i < N; ++i) {
+			value *= lu[i][i];
+		}
+		return value;
+	}
+	else
+	{
+		// fraction-free elimination, all divisions are exact
+		using W = modm::SignedType<modm::WideType<T>>;
+		W a[N][N];
+		for (uint_fast8_t j = 0; j < N; ++j) {
+			for (uint_fast8_t i = 0; i < N; ++i) {
+				a[j][i] = m[j][i];
+			}
+		}
+
+		W previous = 1;
+		int8_t sign = 1;
+		for (uint_fast8_t k = 0; k < N-1; ++k)
+		{
+			if (a[k][k] == 0)
+			{
+				uint_fast8_t j = k+1;
+				while (j < N and a[j][k] == 0) ++j;
+				if (j == N) {
+					return 0;
+				}
+				for (uint_fast8_t i = k; i < N; ++i) {
+					std::swap(a[j][i], a[k][i]);
+				}
+				sign = -sign;
+			}
+			for (uint_fast8_t j = k+1; j < N; ++j) {
+				for (uint_fast8_t i = k+1; i < N; ++i) {
+					a[j][i] = (a[j][i] * a[k][k] - a[j][k] * a[k][i]) / previous;
+				}
+			}
+			previous = a[k][k];
+		}
+		return T(sign * a[N-1][N-1]);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+bool
+modm::Matrix<T, ROWS, COLUMNS>::inverse()
+{
+	static_assert(ROWS == COLUMNS, "inverse() only possible for square matrices");
+	static_assert(std::is_floating_point_v<T>, "inverse() only possible for floating point matrices");
+
+	Matrix lu(*this);
+	modm::Vector<int8_t, ROWS> p;
+	if (not LUDecomposition::decomposeInPlace(&lu, &p)) {
+		return false;
+	}
+	*this = identityMatrix();
+	LUDecomposition::solveInPlace(lu, p, this);
 	return true;
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::asInversed() const
+{
+	Matrix m(*this);
+	m.inverse();
+	return m;
+}
+
 //=============================================================================
 // PRIVATE CLASS modm::LUDecomposition::RowOperation
 //=============================================================================
@@ -2,6 +2,7 @@
  * Copyright (c) 2011, Fabian Greif
  * Copyright (c) 2011-2012, Niklas Hauser
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -22,6 +23,9 @@
 
 namespace modm
 {
+	template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+	class MatrixView;
+
 	/**
 	 * \brief	Class for handling common matrix operations
 	 *
@@ -38,6 +42,12 @@ namespace modm
 	 *   function expects a 4x4 matrix, you'll ask for a Matrix and you are
 	 *   guaranteed to get what you asked for.
 	 *
+	 * The arithmetic operators return a new matrix, so an expression like
+	 * `A*B + C*D - E` creates a temporary matrix for every operation. Use
+	 * modm::gemm() to accumulate products directly into the result and the
+	 * views returned by rowView(), columnView() and subView() to access parts
+	 * of a matrix without copying them.
+	 *
 	 * Adapted from the implementation of Gaspard Petit (gaspardpetit@gmail.com).
 	 * \see <a href"http://www-etud.iro.umontreal.ca/~petitg/cpp/matrix.html">Homepage</a>
 	 *
@@ -123,6 +133,29 @@ namespace modm
 		Matrix<T, ROWS, 1>
 		getColumn(uint8_t index) const;
 
+		/// View of a row without copying it, \see modm::MatrixView
+		MatrixView<T, 1, COLUMNS, COLUMNS>
+		rowView(uint8_t index);
+
+		MatrixView<const T, 1, COLUMNS, COLUMNS>
+		rowView(uint8_t index) const;
+
+		/// View of a column without copying it, \see modm::MatrixView
+		MatrixView<T, ROWS, 1, COLUMNS>
+		columnView(uint8_t index);
+
+		MatrixView<const T, ROWS, 1, COLUMNS>
+		columnView(uint8_t index) const;
+
+		/// View of a sub matrix without copying it, \see modm::MatrixView
+		template <uint8_t MR, uint8_t MC>
+		MatrixView<T, MR, MC, COLUMNS>
+		subView(uint8_t row, uint8_t column);
+
+		template <uint8_t MR, uint8_t MC>
+		MatrixView<const T, MR, MC, COLUMNS>
+		subView(uint8_t row, uint8_t column) const;
+
 		// TODO remove these?
 		const T* ptr() const;
 		T* ptr();
@@ -165,12 +198,22 @@ namespace modm
 		inline T
 		determinant() const;
 
-		// TODO Implement these
-		/*void
+		/**
+		 * \brief	Invert the matrix with a LU decomposition
+		 *
+		 * To solve a system of linear equations, use
+		 * modm::LUDecomposition::solve() instead of the inverse.
+		 *
+		 * \return	`false` if the matrix is singular and was not changed
+		 * \warning	Will only work if the matrix is square and of a floating
+		 * 			point type!
+		 */
+		bool
 		inverse();
 
+		/// \see inverse()
 		Matrix
-		asInversed() const;*/
+		asInversed() const;
 
 		bool hasNan() const;
 		bool hasInf() const;
@@ -241,14 +284,45 @@ namespace modm
 	/**
 	 * \brief	Calculate the determinant
 	 *
+	 * Floating point matrices use a LU decomposition, integer matrices the
+	 * fraction-free Bareiss algorithm to keep the result exact, both need
+	 * O(N^3) operations.
+	 *
 	 * \param	m	Matrix
 	 * \ingroup	modm_math_matrix
 	 */
 	template<typename T, uint8_t N>
 	T
 	determinant(const modm::Matrix<T, N, N> &m);
+
+	/**
+	 * \brief	Fused matrix multiplication and addition `C = alpha*A*B + beta*C`
+	 *
+	 * Calculates the result row by row in place without any temporary
+	 * matrices. An expression like `X = A*B + C*D - E` can be written as:
+	 *
+	 * \code
+	 * X = E;
+	 * modm::gemm(1.f, A, B, -1.f, &X);
+	 * modm::gemm(1.f, C, D,  1.f, &X);
+	 * \endcode
+	 *
+	 * If \p beta is zero, the previous values of \p c are not read, so it
+	 * may be uninitialized.
+	 *
+	 * \warning	\p c must not be the same matrix as \p a or \p b!
+	 * \ingroup	modm_math_matrix
+	 */
+	template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+	void
+	gemm(T alpha, const Matrix<T, ROWS, INNER> &a, const Matrix<T, INNER, COLUMNS> &b,
+		 T beta, Matrix<T, ROWS, COLUMNS> *c);
 }
 
 #include "matrix_impl.hpp"
+#include "matrix_view.hpp"
+
+// implements determinant() and inverse()
+#include "lu_decomposition.hpp"
 
 #endif	// MODM_MATRIX_HPP
@@ -2,6 +2,7 @@
  * Copyright (c) 2011, Fabian Greif
  * Copyright (c) 2011-2012, 2015, Niklas Hauser
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -229,13 +230,15 @@ modm::Matrix<T, ROWS, COLUMNS>::operator * (const Matrix<T, COLUMNS, RHSCOL> &rh
 
 	for (uint_fast8_t i = 0; i < ROWS; ++i)
 	{
+		const T *lhs = &element[i * COLUMNS];
 		for (uint_fast8_t j = 0; j < RHSCOL; ++j)
 		{
-			m[i][j] = element[i * COLUMNS] * rhs[0][j];
-			for (uint_fast8_t x = 1; x < COLUMNS; ++x)
-			{
-				m[i][j] += element[i * COLUMNS + x] * rhs[x][j];
+			// accumulate in a register instead of the matrix
+			T sum = lhs[0] * rhs[0][j];
+			for (uint_fast8_t x = 1; x < COLUMNS; ++x) {
+				sum += lhs[x] * rhs[x][j];
 			}
+			m[i][j] = sum;
 		}
 	}
 	return m;
@@ -419,6 +422,59 @@ modm::Matrix<T, ROWS, COLUMNS>::getNumberOfElements() const
 	return ROWS * COLUMNS;
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+modm::MatrixView<T, 1, COLUMNS, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::rowView(uint8_t index)
+{
+	return MatrixView<T, 1, COLUMNS, COLUMNS>(&element[index * COLUMNS]);
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+modm::MatrixView<const T, 1, COLUMNS, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::rowView(uint8_t index) const
+{
+	return MatrixView<const T, 1, COLUMNS, COLUMNS>(&element[index * COLUMNS]);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+modm::MatrixView<T, ROWS, 1, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::columnView(uint8_t index)
+{
+	return MatrixView<T, ROWS, 1, COLUMNS>(&element[index]);
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+modm::MatrixView<const T, ROWS, 1, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::columnView(uint8_t index) const
+{
+	return MatrixView<const T, ROWS, 1, COLUMNS>(&element[index]);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template <uint8_t MR, uint8_t MC>
+modm::MatrixView<T, MR, MC, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::subView(uint8_t row, uint8_t column)
+{
+	static_assert(MR <= ROWS, "sub matrix must be smaller than the original");
+	static_assert(MC <= COLUMNS, "sub matrix must be smaller than the original");
+
+	return MatrixView<T, MR, MC, COLUMNS>(&element[row * COLUMNS + column]);
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template <uint8_t MR, uint8_t MC>
+modm::MatrixView<const T, MR, MC, COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>::subView(uint8_t row, uint8_t column) const
+{
+	static_assert(MR <= ROWS, "sub matrix must be smaller than the original");
+	static_assert(MC <= COLUMNS, "sub matrix must be smaller than the original");
+
+	return MatrixView<const T, MR, MC, COLUMNS>(&element[row * COLUMNS + column]);
+}
+
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 template <uint8_t MR, uint8_t MC>
@@ -629,35 +685,39 @@ modm::determinant(const modm::Matrix<T, 2, 2> &m)
 	return (m[0][0] * m[1][1] - m[0][1] * m[1][0]);
 }
 
+
 // ----------------------------------------------------------------------------
-template<typename T, uint8_t N>
-T
-modm::determinant(const modm::Matrix<T, N, N> &m)
+template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+void
+modm::gemm(T alpha, const modm::Matrix<T, ROWS, INNER> &a, const modm::Matrix<T, INNER, COLUMNS> &b,
+		   T beta, modm::Matrix<T, ROWS, COLUMNS> *c)
 {
-	// not the most efficient way, but should work for now...
-	T value = 0;
-	int8_t factor = 1;
-	for (uint_fast8_t i = 0; i < N; ++i)
+	for (uint_fast8_t i = 0; i < ROWS; ++i)
 	{
-		T coeff = m[0][i];
-		modm::Matrix<T, N-1, N-1> subM;
-
-		for (uint_fast8_t x = 0; x < i; ++x) {
-			for (uint_fast8_t y = 1; y < N; ++y) {
-				subM[y-1][x] = m[y][x];
+		// Calculate the row on the stack first, since the compiler cannot
+		// prove that c is distinct from a and b and would otherwise reload
+		// them after every write.
+		T row[COLUMNS];
+		const T *lhs = a[i];
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j)
+		{
+			T sum = lhs[0] * b[0][j];
+			for (uint_fast8_t x = 1; x < INNER; ++x) {
+				sum += lhs[x] * b[x][j];
 			}
+			row[j] = alpha * sum;
 		}
 
-		for (uint_fast8_t x = i+1; x < N; ++x) {
-			for (uint_fast8_t y = 1; y < N; ++y) {
-				subM[y-1][x-1] = m[y][x];
+		T *out = (*c)[i];
+		if (beta == T(0)) {
+			for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+				out[j] = row[j];
+			}
+		}
+		else {
+			for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+				out[j] = row[j] + beta * out[j];
 			}
 		}
-
-		value += coeff * factor * determinant(subM);
-		factor *= -1;
 	}
-
-	return value;
 }
-
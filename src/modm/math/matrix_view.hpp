@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_MATRIX_VIEW_HPP
+#define MODM_MATRIX_VIEW_HPP
+
+#include <type_traits>
+#include "matrix.hpp"
+
+namespace modm
+{
+	/**
+	 * \brief	View of a part of a matrix without copying it
+	 *
+	 * The view points into the elements of a row-major modm::Matrix, the
+	 * rows of the view are \p STRIDE elements apart. Writing through the view
+	 * changes the viewed matrix, which must outlive the view.
+	 *
+	 * \code
+	 * modm::Matrix<float, 6, 6> P;
+	 * P.subView<3, 3>(0, 3) = modm::Matrix3f::identityMatrix();
+	 * P.columnView(2) *= 0.5f;
+	 * modm::Matrix<float, 1, 6> r = P.rowView(1);
+	 * \endcode
+	 *
+	 * \tparam	T			Element type, `const` for read-only views
+	 * \tparam	ROWS		Number of rows
+	 * \tparam	COLUMNS		Number of columns
+	 * \tparam	STRIDE		Number of elements from one row to the next
+	 *
+	 * \ingroup	modm_math_matrix
+	 * \author	Thomas Sommer
+	 */
+	template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+	class MatrixView
+	{
+	public:
+		using Type = std::remove_const_t<T>;
+
+		explicit
+		MatrixView(T *data) :
+			data(data)
+		{
+		}
+
+		MatrixView(const MatrixView &other) = default;
+
+		/// Copies the elements, not the pointer
+		MatrixView&
+		operator = (const MatrixView &other);
+
+		/// Copies the elements of \p m into the viewed matrix
+		MatrixView&
+		operator = (const Matrix<Type, ROWS, COLUMNS> &m);
+
+		MatrixView& operator += (const Matrix<Type, ROWS, COLUMNS> &rhs);
+		MatrixView& operator -= (const Matrix<Type, ROWS, COLUMNS> &rhs);
+		MatrixView& operator *= (const Type &rhs);		///< Scalar multiplication
+
+		bool operator == (const Matrix<Type, ROWS, COLUMNS> &m) const;
+		bool operator != (const Matrix<Type, ROWS, COLUMNS> &m) const;
+
+		T*
+		operator [] (uint8_t row) const
+		{
+			return data + row * STRIDE;
+		}
+
+		inline uint8_t
+		getNumberOfRows() const
+		{
+			return ROWS;
+		}
+
+		inline uint8_t
+		getNumberOfColumns() const
+		{
+			return COLUMNS;
+		}
+
+		/// Copy of the viewed elements
+		Matrix<Type, ROWS, COLUMNS>
+		asMatrix() const;
+
+		operator Matrix<Type, ROWS, COLUMNS> () const
+		{
+			return asMatrix();
+		}
+
+	private:
+		T *data;
+	};
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>&
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator = (const MatrixView &other)
+{
+	static_assert(not std::is_const_v<T>, "Cannot write through a read-only view");
+
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*this)[i][j] = other[i][j];
+		}
+	}
+	return *this;
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>&
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator = (const Matrix<Type, ROWS, COLUMNS> &m)
+{
+	static_assert(not std::is_const_v<T>, "Cannot write through a read-only view");
+
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*this)[i][j] = m[i][j];
+		}
+	}
+	return *this;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>&
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator += (const Matrix<Type, ROWS, COLUMNS> &rhs)
+{
+	static_assert(not std::is_const_v<T>, "Cannot write through a read-only view");
+
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*this)[i][j] += rhs[i][j];
+		}
+	}
+	return *this;
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>&
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator -= (const Matrix<Type, ROWS, COLUMNS> &rhs)
+{
+	static_assert(not std::is_const_v<T>, "Cannot write through a read-only view");
+
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*this)[i][j] -= rhs[i][j];
+		}
+	}
+	return *this;
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>&
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator *= (const Type &rhs)
+{
+	static_assert(not std::is_const_v<T>, "Cannot write through a read-only view");
+
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*this)[i][j] *= rhs;
+		}
+	}
+	return *this;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+bool
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator == (const Matrix<Type, ROWS, COLUMNS> &m) const
+{
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		if (memcmp((*this)[i], m[i], COLUMNS * sizeof(T)) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+bool
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::operator != (const Matrix<Type, ROWS, COLUMNS> &m) const
+{
+	return not (*this == m);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t STRIDE>
+modm::Matrix<typename modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::Type, ROWS, COLUMNS>
+modm::MatrixView<T, ROWS, COLUMNS, STRIDE>::asMatrix() const
+{
+	Matrix<Type, ROWS, COLUMNS> m;
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			m[i][j] = (*this)[i][j];
+		}
+	}
+	return m;
+}
+
+#endif	// MODM_MATRIX_VIEW_HPP
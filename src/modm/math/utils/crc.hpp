@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019-2020, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -13,13 +14,295 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <type_traits>
 #ifdef __AVR__
 #include <util/crc16.h>
 #endif
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
 
 namespace modm::math
 {
 
+/// @cond
+namespace detail
+{
+
+template< class T >
+constexpr T
+crc_reflect(T value, uint8_t width)
+{
+    T result{0};
+    for (uint8_t ii = 0; ii < width; ii++, value >>= 1)
+        result = T((result << 1) | (value & 1));
+    return result;
+}
+
+/// Slice tables of a CRC with the register in the low bits if reflected,
+/// otherwise aligned to the top bit of T.
+template< class T, T Polynomial, uint8_t Width, bool Reflected, uint8_t Slices >
+struct CrcTable
+{
+    static constexpr uint8_t Bits = sizeof(T) * 8;
+    static constexpr T poly = Reflected ? crc_reflect(Polynomial, Width) :
+                                         T(Polynomial << (Bits - Width));
+
+    static constexpr T
+    shift(T crc)
+    {
+        if constexpr (Bits == 8) return 0;
+        else if constexpr (Reflected) return crc >> 8;
+        else return T(crc << 8);
+    }
+
+    static constexpr uint8_t
+    index(T crc)
+    {
+        if constexpr (Reflected) return uint8_t(crc);
+        else return uint8_t(crc >> (Bits - 8));
+    }
+
+    struct Data { T table[Slices][256]; };
+
+    static constexpr Data
+    generate()
+    {
+        Data data{};
+        for (uint16_t byte = 0; byte < 256; byte++)
+        {
+            T crc = Reflected ? T(byte) : T(T(byte) << (Bits - 8));
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                if constexpr (Reflected)
+                    crc = (crc & 1) ? T((crc >> 1) ^ poly) : T(crc >> 1);
+                else
+                    crc = (crc >> (Bits - 1)) ? T((crc << 1) ^ poly) : T(crc << 1);
+            }
+            data.table[0][byte] = crc;
+        }
+        // the CRC of a byte followed by a number of zero bytes
+        for (uint8_t slice = 1; slice < Slices; slice++)
+        {
+            for (uint16_t byte = 0; byte < 256; byte++)
+            {
+                const T crc = data.table[slice - 1][byte];
+                data.table[slice][byte] = T(shift(crc) ^ data.table[0][index(crc)]);
+            }
+        }
+        return data;
+    }
+
+    static constexpr Data data = generate();
+};
+
+} // namespace detail
+/// @endcond
+
+/**
+ * Table-driven CRC computation for any polynomial up to 64 bit.
+ *
+ * The parameters are named like in the catalogue of the CRC RevEng project,
+ * with the same reflection of the input and output. The lookup tables are
+ * generated when compiling and shared by all CRCs with the same polynomial,
+ * which costs `Slices * 256 * sizeof(T)` bytes. More slices process that
+ * many bytes at once for a higher throughput.
+ *
+ * The CRC-32 and CRC-32C polynomials use the CRC32 instructions of the CPU
+ * instead, if available on ARMv8 or x86 with SSE4.2.
+ *
+ * @warning On AVR the tables are placed in RAM.
+ *
+ * ```cpp
+ * using Crc32 = modm::math::Crc<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, 32, 4>;
+ * uint32_t checksum = Crc32::compute(data, length);
+ *
+ * Crc32 crc; // or incrementally
+ * crc.update(header, sizeof(header));
+ * crc.update(payload, length);
+ * checksum = crc.value();
+ * ```
+ *
+ * @tparam  T           unsigned integer large enough for the CRC
+ * @tparam  Polynomial  without the highest bit and not reflected
+ * @tparam  Init        initial value of the register, not reflected
+ * @tparam  XorOut      value to XOR with the final register
+ * @tparam  Reflected   data is processed starting with the least significant bit
+ * @tparam  Width       in bits
+ * @tparam  Slices      number of bytes processed at once, from 1 to 8
+ *
+ * @author  Thomas Sommer
+ * @ingroup modm_math_utils
+ */
+template< class T, T Polynomial, T Init, T XorOut, bool Reflected,
+          uint8_t Width = sizeof(T) * 8, uint8_t Slices = 1 >
+class Crc
+{
+    static_assert(std::is_unsigned_v<T>, "The CRC type must be unsigned!");
+    static_assert(0 < Width and Width <= sizeof(T) * 8, "The width must fit into the CRC type!");
+    static_assert(1 <= Slices and Slices <= 8, "Only 1 to 8 slices are supported!");
+
+    using Table = detail::CrcTable<T, Polynomial, Width, Reflected, Slices>;
+    static constexpr uint8_t Bits = sizeof(T) * 8;
+    static constexpr T Mask = Width == Bits ? T(-1) : T((T(1) << Width) - 1);
+
+public:
+    using value_type = T;
+
+    /// Register value before any data, as used by the update functions
+    static constexpr T initial = Reflected ? detail::crc_reflect(Init, Width) :
+                                             T(Init << (Bits - Width));
+
+    /// Continues the CRC of the register with one byte
+    static constexpr T
+    update(T crc, uint8_t data)
+    {
+        if constexpr (Hardware != 0)
+        {
+            if (not std::is_constant_evaluated()) return hardware(crc, data);
+        }
+        return T(Table::shift(crc) ^ Table::data.table[0][Table::index(crc) ^ data]);
+    }
+
+    /// Continues the CRC of the register with a block of data
+    static constexpr T
+    update(T crc, const uint8_t *data, size_t length)
+    {
+        if constexpr (Hardware != 0)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                for (; length >= 4; length -= 4, data += 4)
+                    crc = hardware(crc, uint32_t(data[0]) | (uint32_t(data[1]) << 8) |
+                                        (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24));
+            }
+        }
+        if constexpr (Slices > 1)
+        {
+            for (; length >= Slices; length -= Slices, data += Slices)
+            {
+                T result = (Bits > Slices * 8) ? shift<Slices>(crc) : T(0);
+                for (uint8_t ii = 0; ii < Slices; ii++)
+                {
+                    const uint8_t byte = data[ii] ^ (ii < sizeof(T) ? registerByte(crc, ii) : 0);
+                    result ^= Table::data.table[Slices - 1 - ii][byte];
+                }
+                crc = result;
+            }
+        }
+        while (length--) crc = update(crc, *data++);
+        return crc;
+    }
+
+    /// @return the final CRC of the register
+    static constexpr T
+    finalize(T crc)
+    {
+        if constexpr (not Reflected) crc >>= (Bits - Width);
+        return (crc ^ XorOut) & Mask;
+    }
+
+    /// @return the CRC of a block of data
+    static constexpr T
+    compute(const uint8_t *data, size_t length)
+    {
+        return finalize(update(initial, data, length));
+    }
+
+public:
+    constexpr Crc() = default;
+
+    /// Starts a new computation
+    constexpr void
+    reset()
+    { crc = initial; }
+
+    constexpr Crc&
+    update(uint8_t data)
+    {
+        crc = update(crc, data);
+        return *this;
+    }
+
+    constexpr Crc&
+    update(const uint8_t *data, size_t length)
+    {
+        crc = update(crc, data, length);
+        return *this;
+    }
+
+    /// @return the CRC of all data since construction or `reset()`
+    constexpr T
+    value() const
+    { return finalize(crc); }
+
+private:
+    template< uint8_t Bytes >
+    static constexpr T
+    shift(T crc)
+    {
+        if constexpr (Bits <= Bytes * 8) return 0;
+        else if constexpr (Reflected) return crc >> (Bytes * 8);
+        else return T(crc << (Bytes * 8));
+    }
+
+    static constexpr uint8_t
+    registerByte(T crc, uint8_t index)
+    {
+        if constexpr (Reflected) return uint8_t(crc >> (index * 8));
+        else return uint8_t(crc >> (Bits - 8 - index * 8));
+    }
+
+    // 1: CRC-32, 2: CRC-32C
+    static constexpr uint8_t Hardware = [] {
+        if constexpr (not Reflected or Width != 32 or sizeof(T) != 4) return 0;
+#if defined(__ARM_FEATURE_CRC32)
+        if constexpr (Polynomial == 0x04C11DB7) return 1;
+#endif
+#if defined(__ARM_FEATURE_CRC32) or defined(__SSE4_2__)
+        if constexpr (Polynomial == 0x1EDC6F41) return 2;
+#endif
+        return 0;
+    }();
+
+    template< class Data >
+    static T
+    hardware(T crc, Data data)
+    {
+#if defined(__ARM_FEATURE_CRC32)
+        if constexpr (Hardware == 1)
+            return sizeof(Data) == 1 ? __crc32b(crc, data) : __crc32w(crc, data);
+        else
+            return sizeof(Data) == 1 ? __crc32cb(crc, data) : __crc32cw(crc, data);
+#elif defined(__SSE4_2__)
+        return sizeof(Data) == 1 ? _mm_crc32_u8(crc, data) : _mm_crc32_u32(crc, data);
+#else
+        (void) data;
+        return crc;
+#endif
+    }
+
+    T crc{initial};
+};
+
+/// CRC-8 with polynomial 0x07 and initial value 0xFF, as computed by `crc8_ccitt()` on AVR.
+/// @ingroup modm_math_utils
+using Crc8Ccitt = Crc<uint8_t, 0x07, 0xFF, 0x00, false>;
+/// CRC-16/MCRF4XX with polynomial 0x1021, as computed by `crc16_ccitt()`.
+/// @ingroup modm_math_utils
+using Crc16Ccitt = Crc<uint16_t, 0x1021, 0xFFFF, 0x0000, true>;
+/// CRC-32 of Ethernet, zlib and PNG, as computed by `crc32()`.
+/// @ingroup modm_math_utils
+using Crc32 = Crc<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true, 32, 4>;
+/// CRC-32C (Castagnoli) of iSCSI, ext4 and SCTP.
+/// @ingroup modm_math_utils
+using Crc32c = Crc<uint32_t, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, 32, 4>;
+
+// The functions below are bitwise and table-less to keep them small on every
+// target. Use modm::math::Crc32 or Crc16Ccitt with lookup tables for speed.
+
 /// @ingroup modm_math_utils
 inline uint8_t
 crc8_ccitt_update(uint8_t crc, uint8_t data)
@@ -78,6 +361,8 @@ crc8_ccitt(const uint8_t *data, size_t length)
     return crc;
 }
 
+/// Slow, but table-less computation of CRC-16/MCRF4XX.
+/// @see modm::math::Crc16Ccitt
 /// @ingroup modm_math_utils
 inline uint16_t
 crc16_ccitt(const uint8_t *data, size_t length)
@@ -88,6 +373,7 @@ crc16_ccitt(const uint8_t *data, size_t length)
 }
 
 /// Slow, but table-less computation of CRC32.
+/// @see modm::math::Crc32
 /// @ingroup modm_math_utils
 inline uint32_t
 crc32(const uint8_t *data, size_t length)
@@ -98,4 +384,3 @@ crc32(const uint8_t *data, size_t length)
 }
 
 } // namespace modm::math
-
@@ -4,6 +4,7 @@
  * Copyright (c) 2010-2011, Thorsten Lajewski
  * Copyright (c) 2012, 2015-2017, Sascha Schade
  * Copyright (c) 2012-2015, 2017-2018, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -197,7 +198,7 @@ template <typename SerialPort>
 bool
 modm::platform::CanUsb<SerialPort>::sendMessage(const can::Message& message)
 {
-	char str[128];
+	char str[modm::CanLawicelFormatter::MaxStringLength];
 	modm::CanLawicelFormatter::convertToString(message, str);
 	MODM_LOG_DEBUG.printf("Sending ");
 	char *p = str;
@@ -220,18 +221,27 @@ modm::platform::CanUsb<SerialPort>::update()
 		if (this->serialPort.read(a))
 		{
 			MODM_LOG_DEBUG.printf("Received %02x\n", a);
-			if (a == 'T' || a == 't' || a == 'r' || a == 'R')
+			if (a == '\r')
 			{
+				// the CAN FD types 'd' and 'b' are also hex digits, so
+				// they can only be detected after the end of a frame
 				this->tmpRead.clear();
 			}
-			this->tmpRead += a;
-
-			can::Message message;
-			if (modm::CanLawicelFormatter::convertToCanMessage(
-					this->tmpRead.c_str(), message))
+			else
 			{
-				MutexGuard stateGuard(readBufferLock);
-				this->readBuffer.push(message);
+				if (a == 'T' || a == 't' || a == 'r' || a == 'R')
+				{
+					this->tmpRead.clear();
+				}
+				this->tmpRead += a;
+
+				can::Message message;
+				if (modm::CanLawicelFormatter::convertToCanMessage(
+						this->tmpRead.c_str(), message))
+				{
+					MutexGuard stateGuard(readBufferLock);
+					this->readBuffer.push(message);
+				}
 			}
 		}
 		if (not this->active) {
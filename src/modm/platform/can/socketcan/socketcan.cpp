@@ -2,6 +2,7 @@
  * Copyright (c) 2016, Sascha Schade
  * Copyright (c) 2017, Fabian Greif
  * Copyright (c) 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -20,21 +21,70 @@
 #include <sys/ioctl.h>
 #include <net/if.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
 #include <string.h>
+#include <algorithm>
 
 #undef  MODM_LOG_LEVEL
 #define MODM_LOG_LEVEL modm::log::DEBUG
 
+namespace
+{
+
+/// Software and raw hardware timestamp, the second entry is unused
+struct ScmTimestamping
+{
+	struct timespec ts[3];
+};
+
+constexpr std::size_t ControlSize = CMSG_SPACE(sizeof(ScmTimestamping));
+
+modm::platform::SocketCan::Timestamp
+toTimestamp(const struct timespec& ts)
+{
+	return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+std::size_t
+toFrame(const modm::can::Message& message, struct canfd_frame& frame)
+{
+	frame = {};
+	frame.can_id = message.identifier;
+	if (message.isExtended()) {
+		frame.can_id |= CAN_EFF_FLAG;
+	}
+	if (message.isRemoteTransmitRequest()) {
+		frame.can_id |= CAN_RTR_FLAG;
+	}
+
+	frame.len = message.getLength();
+	std::copy_n(message.data, message.getLength(), frame.data);
+
+	if (message.isFlexibleData())
+	{
+		if (message.isBitRateSwitching()) {
+			frame.flags |= CANFD_BRS;
+		}
+		return CANFD_MTU;
+	}
+	return CAN_MTU;
+}
+
+}	// anonymous namespace
+
 modm::platform::SocketCan::SocketCan()
 {
 }
 
 modm::platform::SocketCan::~SocketCan()
 {
+	close();
 }
 
 bool
@@ -58,7 +108,18 @@ modm::platform::SocketCan::open(std::string deviceName /*, bitrate_t canBitrate
 		return false;
 	};
 
-	fcntl(skt, F_SETFL, O_NONBLOCK);
+	if constexpr (can::Message::capacity > 8)
+	{
+		// receive and transmit CAN FD frames in addition to classic frames
+		const int enable = 1;
+		if (setsockopt(skt, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable, sizeof(enable)) < 0)
+		{
+			MODM_LOG_WARNING << MODM_FILE_INFO;
+			MODM_LOG_WARNING << "SocketCAN does not support CAN FD frames" << modm::endl;
+		}
+	}
+
+	configure();
 
 	MODM_LOG_INFO << MODM_FILE_INFO;
 	MODM_LOG_INFO << "SocketCAN opened successfully with skt = " << skt << modm::endl;
@@ -66,9 +127,43 @@ modm::platform::SocketCan::open(std::string deviceName /*, bitrate_t canBitrate
 	return true;
 }
 
+bool
+modm::platform::SocketCan::attach(int socket)
+{
+	close();
+	if (socket < 0) {
+		return false;
+	}
+	skt = socket;
+	configure();
+	return true;
+}
+
+void
+modm::platform::SocketCan::configure()
+{
+	fcntl(skt, F_SETFL, O_NONBLOCK);
+
+	// hardware timestamps are only available if enabled on the interface,
+	// the raw hardware timestamp is preferred over the software timestamp
+	const int timestamping = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+							 SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+	setsockopt(skt, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping));
+
+	rxIndex = 0;
+	rxCount = 0;
+}
+
 void
 modm::platform::SocketCan::close()
 {
+	if (skt >= 0)
+	{
+		::close(skt);
+		skt = -1;
+	}
+	rxIndex = 0;
+	rxCount = 0;
 }
 
 modm::Can::BusState
@@ -78,61 +173,161 @@ modm::platform::SocketCan::getBusState()
 }
 
 bool
-modm::platform::SocketCan::isMessageAvailable()
+modm::platform::SocketCan::receive()
 {
-	struct can_frame frame;
-	int nbytes = recv(skt, &frame, sizeof(struct can_frame), MSG_DONTWAIT | MSG_PEEK);
+	if (skt < 0) {
+		return false;
+	}
 
-	// recv returns 'Resource temporary not available' which is wired but ignored here.
-	/* if (nbytes < 0)
+	struct mmsghdr headers[BatchSize];
+	struct iovec vectors[BatchSize];
+	alignas(struct cmsghdr) char control[BatchSize][ControlSize];
+	for (std::size_t ii = 0; ii < BatchSize; ++ii)
 	{
-		MODM_LOG_DEBUG << MODM_FILE_INFO;
-		MODM_LOG_DEBUG << strerror(errno) << modm::endl;
-	} */
+		vectors[ii].iov_base = &rxFrames[ii].frame;
+		vectors[ii].iov_len = sizeof(rxFrames[ii].frame);
+		headers[ii].msg_hdr = {};
+		headers[ii].msg_hdr.msg_iov = &vectors[ii];
+		headers[ii].msg_hdr.msg_iovlen = 1;
+		headers[ii].msg_hdr.msg_control = control[ii];
+		headers[ii].msg_hdr.msg_controllen = ControlSize;
+	}
 
-	return (nbytes > 0);
-}
+	const int count = recvmmsg(skt, headers, BatchSize, MSG_DONTWAIT, nullptr);
+	if (count <= 0) {
+		return false;
+	}
 
-bool
-modm::platform::SocketCan::getMessage(can::Message& message)
-{
-	struct can_frame frame;
-	int nbytes = recv(skt, &frame, sizeof(struct can_frame), MSG_DONTWAIT);
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
 
-	if (nbytes > 0)
+	// A classic frame has the same layout as the beginning of a CAN FD frame,
+	// the number of received bytes tells them apart. Invalid frames and
+	// CAN FD frames which do not fit into a message are dropped.
+	std::size_t valid = 0;
+	for (int ii = 0; ii < count; ++ii)
 	{
-		message.identifier = frame.can_id;
-		message.length = frame.can_dlc;
-		message.setExtended(frame.can_id & CAN_EFF_FLAG);
-		message.setRemoteTransmitRequest(frame.can_id & CAN_RTR_FLAG);
-		for (uint8_t ii = 0; ii < frame.can_dlc; ++ii) {
-			message.data[ii] = frame.data[ii];
+		const unsigned int size = headers[ii].msg_len;
+		const bool fd = (size == CANFD_MTU);
+		if ((size != CAN_MTU and not fd) or rxFrames[ii].frame.len > can::Message::capacity) {
+			continue;
+		}
+
+		Timestamp timestamp = toTimestamp(now);
+		for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&headers[ii].msg_hdr); cmsg;
+			 cmsg = CMSG_NXTHDR(&headers[ii].msg_hdr, cmsg))
+		{
+			if (cmsg->cmsg_level == SOL_SOCKET and cmsg->cmsg_type == SO_TIMESTAMPING)
+			{
+				ScmTimestamping stamps;
+				memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+				const auto& ts = (stamps.ts[2].tv_sec or stamps.ts[2].tv_nsec) ? stamps.ts[2] : stamps.ts[0];
+				timestamp = toTimestamp(ts);
+			}
 		}
+
+		if (std::size_t(ii) != valid) {
+			rxFrames[valid].frame = rxFrames[ii].frame;
+		}
+		rxFrames[valid].timestamp = timestamp;
+		rxFrames[valid].fd = fd;
+		valid++;
+	}
+
+	rxIndex = 0;
+	rxCount = valid;
+	return (valid > 0);
+}
+
+bool
+modm::platform::SocketCan::waitForMessage(std::chrono::milliseconds timeout)
+{
+	if (isMessageAvailable()) {
 		return true;
 	}
-	return false;
+	struct pollfd fd = { skt, POLLIN, 0 };
+	const int milliseconds = (timeout.count() < 0) ? -1 : int(timeout.count());
+	if (poll(&fd, 1, milliseconds) <= 0) {
+		return false;
+	}
+	return isMessageAvailable();
 }
 
 bool
-modm::platform::SocketCan::sendMessage(const can::Message& message)
+modm::platform::SocketCan::isMessageAvailable()
 {
-	struct can_frame frame;
+	return (rxIndex < rxCount) or receive();
+}
 
-	frame.can_id = message.identifier;
-	if (message.isExtended()) {
-		frame.can_id |= CAN_EFF_FLAG;
-	}
-	if (message.isRemoteTransmitRequest()) {
-		frame.can_id |= CAN_RTR_FLAG;
+bool
+modm::platform::SocketCan::getMessage(can::Message& message)
+{
+	return getMessage(message, nullptr);
+}
+
+bool
+modm::platform::SocketCan::getMessage(can::Message& message, Timestamp *timestamp)
+{
+	if (not isMessageAvailable()) {
+		return false;
 	}
+	const Frame& rx = rxFrames[rxIndex++];
+	const struct canfd_frame& frame = rx.frame;
 
-	frame.can_dlc = message.getLength();
+	message.setExtended(frame.can_id & CAN_EFF_FLAG);
+	message.setRemoteTransmitRequest(frame.can_id & CAN_RTR_FLAG);
+	message.identifier = frame.can_id & (message.isExtended() ? CAN_EFF_MASK : CAN_SFF_MASK);
+	message.setFlexibleData(rx.fd);
+	message.setBitRateSwitching(rx.fd and (frame.flags & CANFD_BRS));
+	message.setErrorStateIndicator(rx.fd and (frame.flags & CANFD_ESI));
+	message.length = std::min<uint8_t>(frame.len, rx.fd ? can::Message::capacity : 8);
+	std::copy_n(frame.data, message.length, message.data);
 
-	for (uint8_t ii = 0; ii < message.getLength(); ++ii) {
-		frame.data[ii] = message.data[ii];
+	if (timestamp) {
+		*timestamp = rx.timestamp;
 	}
+	return true;
+}
 
-	int bytes_sent = write( skt, &frame, sizeof(frame) );
+bool
+modm::platform::SocketCan::sendMessage(const can::Message& message)
+{
+	struct canfd_frame frame;
+	const std::size_t mtu = toFrame(message, frame);
+
+	int bytes_sent = write( skt, &frame, mtu );
 
 	return (bytes_sent > 0);
 }
+
+std::size_t
+modm::platform::SocketCan::sendMessages(std::span<const can::Message> messages)
+{
+	std::size_t sent = 0;
+	while (sent < messages.size())
+	{
+		struct canfd_frame frames[BatchSize];
+		struct mmsghdr headers[BatchSize];
+		struct iovec vectors[BatchSize];
+
+		const std::size_t count = std::min(BatchSize, messages.size() - sent);
+		for (std::size_t ii = 0; ii < count; ++ii)
+		{
+			vectors[ii].iov_base = &frames[ii];
+			vectors[ii].iov_len = toFrame(messages[sent + ii], frames[ii]);
+			headers[ii].msg_hdr = {};
+			headers[ii].msg_hdr.msg_iov = &vectors[ii];
+			headers[ii].msg_hdr.msg_iovlen = 1;
+		}
+
+		const int result = sendmmsg(skt, headers, count, MSG_DONTWAIT);
+		if (result <= 0) {
+			break;
+		}
+		sent += result;
+		if (std::size_t(result) < count) {
+			break;
+		}
+	}
+	return sent;
+}
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2016, Sascha Schade
  * Copyright (c) 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -13,7 +14,13 @@
 #ifndef MODM_HOSTED_SOCKETCAN_HPP
 #define MODM_HOSTED_SOCKETCAN_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <iostream>
+#include <span>
+#include <string>
+
+#include <linux/can.h>
 
 #include <modm/architecture/interface/can.hpp>
 
@@ -23,9 +30,33 @@ namespace modm
 namespace platform
 {
 
-/// @ingroup modm_platform_socketcan
+/**
+ * Linux SocketCAN interface.
+ *
+ * If the `modm:architecture:can:message.buffer` option allows 64 bytes, the
+ * socket is switched to CAN FD frames, so that classic and CAN FD frames can
+ * be received and transmitted.
+ *
+ * Frames are received in batches of up to `BatchSize` frames with a single
+ * `recvmmsg()` call into an internal buffer, from which `getMessage()`
+ * returns them one by one. Multiple messages can be transmitted with a single
+ * `sendmmsg()` call via `sendMessages()`.
+ *
+ * The socket can be added to an event loop via `getFileDescriptor()`, it is
+ * readable as soon as a frame arrives. Note that frames may already be waiting
+ * in the internal buffer, so check `isMessageAvailable()` before waiting.
+ *
+ * @ingroup modm_platform_socketcan
+ */
 class SocketCan : public ::modm::Can
 {
+public:
+	/// Maximum number of frames per system call
+	static constexpr std::size_t BatchSize = 32;
+
+	/// Receive time since the epoch of `CLOCK_REALTIME`
+	using Timestamp = std::chrono::nanoseconds;
+
 public:
 	SocketCan();
 
@@ -34,15 +65,37 @@ public:
 	bool
 	open(std::string deviceName /*, bitrate_t canBitrate = kbps(125) */);
 
+	/// Uses an already opened socket, which is closed by close().
+	/// Any datagram socket can be used, e.g. one end of a `socketpair()`
+	/// for testing without a (virtual) CAN interface.
+	bool
+	attach(int socket);
+
 	void
 	close();
 
+	/// Socket for `epoll()`, `poll()` or `select()`, -1 if not open
+	int
+	getFileDescriptor() const
+	{ return skt; }
+
+	/// Blocks until a message is available or the timeout expired.
+	/// A negative timeout waits forever.
+	bool
+	waitForMessage(std::chrono::milliseconds timeout);
+
 	bool
 	isMessageAvailable();
 
 	bool
 	getMessage(can::Message& message);
 
+	/// @param[out]	timestamp	Hardware timestamp of the CAN controller if
+	///		supported, otherwise the software timestamp of the kernel or, if
+	///		not available either, the time at which the batch was received.
+	bool
+	getMessage(can::Message& message, Timestamp *timestamp);
+
 	inline bool
 	isReadyToSend() { return true; }
 
@@ -52,8 +105,31 @@ public:
 	bool
 	sendMessage(const can::Message& message);
 
+	/// Transmits messages with one system call per `BatchSize` messages.
+	/// @return	number of transmitted messages, which is less than the number
+	///			of messages if the socket buffer is full.
+	std::size_t
+	sendMessages(std::span<const can::Message> messages);
+
 private:
-	int skt;
+	void
+	configure();
+
+	/// Fills the empty receive buffer
+	bool
+	receive();
+
+	int skt = -1;
+
+	struct Frame
+	{
+		canfd_frame frame;
+		Timestamp timestamp;
+		bool fd;
+	};
+	Frame rxFrames[BatchSize];
+	std::size_t rxIndex = 0;
+	std::size_t rxCount = 0;
 };
 
 } // namespace platform
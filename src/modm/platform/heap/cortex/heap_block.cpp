@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2016, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -15,6 +16,7 @@
 #include <reent.h>
 #include <errno.h>
 #include <modm/architecture/interface/assert.hpp>
+#include <modm/architecture/interface/heap_statistics.hpp>
 #include <modm/platform/core/heap_table.hpp>
 
 // ----------------------------------------------------------------------------
@@ -34,6 +36,62 @@ static modm::BlockAllocator< MODM_MEMORY_BLOCK_ALLOCATOR_TYPE, MODM_MEMORY_BLOCK
 // this allocator has a maximum heap size!
 const size_t max_heap_size = (1 << (sizeof(MODM_MEMORY_BLOCK_ALLOCATOR_TYPE) * 8)) *
 							  MODM_MEMORY_BLOCK_ALLOCATOR_CHUNK_SIZE;
+// zero initialized, only accessed with the heap locked
+static modm::HeapTracker tracker;
+
+extern "C" void __malloc_lock(struct _reent *);
+extern "C" void __malloc_unlock(struct _reent *);
+
+static void*
+allocate(struct _reent *r, size_t size, const void *caller)
+{
+	__malloc_lock(r);
+	void *ptr = allocator.allocate(size);
+	if (ptr) tracker.allocated(ptr, size, allocator.getBlockSize(ptr), caller);
+	else tracker.failed(size, caller);
+	__malloc_unlock(r);
+	modm_assert_continue_fail_debug(ptr, "malloc",
+			"No memory left in Block heap!", size);
+	return ptr;
+}
+
+static void
+release(struct _reent *r, void *p, const void *caller)
+{
+	if (!p) return;
+	__malloc_lock(r);
+	tracker.freed(p, allocator.getBlockSize(p), caller);
+	allocator.free(p);
+	__malloc_unlock(r);
+}
+
+// ----------------------------------------------------------------------------
+modm::HeapStatistics
+modm::getHeapStatistics()
+{
+	__malloc_lock(_REENT);
+	HeapStatistics statistics = tracker.getStatistics();
+	statistics.totalSize = allocator.getTotalSize();
+	statistics.largestFree = allocator.getLargestFreeSize();
+	__malloc_unlock(_REENT);
+	return statistics;
+}
+
+void
+modm::resetHeapStatistics()
+{
+	__malloc_lock(_REENT);
+	tracker.reset();
+	__malloc_unlock(_REENT);
+}
+
+void
+modm::setHeapTraceHandler(HeapTraceHandler handler)
+{
+	__malloc_lock(_REENT);
+	tracker.setTraceHandler(handler);
+	__malloc_unlock(_REENT);
+}
 
 extern "C"
 {
@@ -52,38 +110,48 @@ void __modm_initialize_memory(void)
 	allocator.initialize((void*)heap_start, (void*)heap_end);
 }
 
-extern void __malloc_lock(struct _reent *);
-extern void __malloc_unlock(struct _reent *);
-
 void* __wrap__malloc_r(struct _reent *r, size_t size)
 {
-	__malloc_lock(r);
-	void *ptr = allocator.allocate(size);
-	__malloc_unlock(r);
-	modm_assert_continue_fail_debug(ptr, "malloc",
-			"No memory left in Block heap!", size);
-	return ptr;
+	return allocate(r, size, __builtin_return_address(0));
 }
 
 void* __wrap__calloc_r(struct _reent *r, size_t size)
 {
-	void *ptr = __wrap__malloc_r(r, size);
+	void *ptr = allocate(r, size, __builtin_return_address(0));
 	if (ptr) memset(ptr, 0, size);
 	return ptr;
 }
 
-void* __wrap__realloc_r(struct _reent *, void *, size_t size)
+void* __wrap__realloc_r(struct _reent *r, void *p, size_t size)
 {
-	// NOT IMPLEMENTED!
-	modm_assert(0, "realloc", "Realloc is not implemented for Block heap!", size);
-	return NULL;
+	const void *caller = __builtin_return_address(0);
+
+	// realloc(NULL, size) is malloc(size) and realloc(p, 0) is free(p)
+	if (!p) return allocate(r, size, caller);
+	if (!size)
+	{
+		release(r, p, caller);
+		return NULL;
+	}
+
+	__malloc_lock(r);
+	const size_t oldSize = allocator.getBlockSize(p);
+	void *ptr = allocator.reallocate(p, size);
+	if (ptr)
+	{
+		tracker.freed(p, oldSize, caller);
+		tracker.allocated(ptr, size, allocator.getBlockSize(ptr), caller);
+	}
+	else tracker.failed(size, caller);
+	__malloc_unlock(r);
+	modm_assert_continue_fail_debug(ptr, "realloc",
+			"Unable to realloc in Block heap!", size);
+	return ptr;
 }
 
 void __wrap__free_r(struct _reent *r, void *p)
 {
-	__malloc_lock(r);
-	allocator.free(p);
-	__malloc_unlock(r);
+	release(r, p, __builtin_return_address(0));
 }
 
 } // extern "C"
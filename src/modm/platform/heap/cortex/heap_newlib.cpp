@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2016, 2019 Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -11,8 +12,10 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <malloc.h>
 #include <reent.h>
 #include <modm/architecture/interface/assert.h>
+#include <modm/architecture/interface/heap_statistics.hpp>
 #include <modm/platform/core/heap_table.hpp>
 
 // ----------------------------------------------------------------------------
@@ -21,12 +24,14 @@ extern "C"
 
 const uint8_t *heap_top{nullptr};
 const uint8_t *heap_end{nullptr};
+static const uint8_t *heap_start{nullptr};
 
 void __modm_initialize_memory(void)
 {
 	// find the largest heap that is DMA-able and S-Bus accessible
 	bool success = modm::platform::HeapTable::find_largest(&heap_top, &heap_end);
 	modm_assert(success, "heap.init", "Could not find main heap memory!");
+	heap_start = heap_top;
 }
 
 /* Support function. Adjusts end of heap to provide more memory to
@@ -50,3 +55,28 @@ _sbrk_r(struct _reent *,  ptrdiff_t size)
 }
 
 }
+
+// ----------------------------------------------------------------------------
+// The newlib allocator is not wrapped, so there are no counters and no trace.
+// The usage is derived from its internal bookkeeping instead.
+modm::HeapStatistics
+modm::getHeapStatistics()
+{
+	const struct mallinfo info = mallinfo();
+	HeapStatistics statistics{};
+	statistics.totalSize = heap_end - heap_start;
+	statistics.usedSize = info.uordblks;
+	// memory is never returned to sbrk, so the arena is the high-water mark
+	statistics.peakSize = info.arena;
+	// lower bound, a block in the free-list may be larger
+	statistics.largestFree = heap_end - heap_top;
+	return statistics;
+}
+
+void
+modm::resetHeapStatistics()
+{}
+
+void
+modm::setHeapTraceHandler(HeapTraceHandler)
+{}
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2016-2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -16,6 +17,7 @@
 #include <errno.h>
 #include <modm/architecture/interface/assert.h>
 #include <modm/architecture/interface/memory.hpp>
+#include <modm/architecture/interface/heap_statistics.hpp>
 #include <modm/platform/core/heap_table.hpp>
 
 // ----------------------------------------------------------------------------
@@ -25,6 +27,10 @@
 #define MODM_TLSF_MAX_MEM_POOL_COUNT 6
 #endif
 
+#ifndef MODM_TLSF_MAX_REGION_COUNT
+#define MODM_TLSF_MAX_REGION_COUNT (2 * MODM_TLSF_MAX_MEM_POOL_COUNT)
+#endif
+
 typedef struct
 {
 	uint16_t traits;
@@ -33,6 +39,24 @@ typedef struct
 } mem_pool_t;
 
 static mem_pool_t mem_pools[MODM_TLSF_MAX_MEM_POOL_COUNT];
+// all memory regions of all pools, only used for the statistics
+static pool_t regions[MODM_TLSF_MAX_REGION_COUNT];
+static size_t total_size;
+// zero initialized, only accessed with the heap locked
+static modm::HeapTracker tracker;
+
+static void
+add_region(pool_t region, size_t size)
+{
+	total_size += size;
+	for (pool_t &slot : regions)
+	{
+		if (!slot) {
+			slot = region;
+			return;
+		}
+	}
+}
 
 extern "C"
 {
@@ -59,13 +83,15 @@ __modm_initialize_memory(void)
 				current_pool->traits = current_traits;
 				current_pool->tlsf = pool;
 				current_pool->end = tend;
+				add_region(tlsf_get_pool(pool), tsize);
 
 				current_pool++;
 			}
 		}
 		// otherwise add this pool to the existing allocator
-		else if (tlsf_add_pool((current_pool - 1)->tlsf, (void*)tstart, tsize)) {
+		else if (pool_t region = tlsf_add_pool((current_pool - 1)->tlsf, (void*)tstart, tsize); region) {
 			(current_pool - 1)->end = tend;
+			add_region(region, tsize);
 		}
 	}
 }
@@ -91,7 +117,8 @@ get_tlsf_for_ptr(void *p)
 extern void __malloc_lock(struct _reent *);
 extern void __malloc_unlock(struct _reent *);
 
-void * malloc_traits(size_t size, uint32_t traits)
+static void *
+allocate(size_t size, uint32_t traits, const void *caller)
 {
 try_again:
 	for (mem_pool_t *pool = mem_pools;
@@ -102,6 +129,7 @@ try_again:
 		{
 			__malloc_lock(_REENT);
 			void *p = tlsf_malloc(pool->tlsf, size);
+			if (p) tracker.allocated(p, size, tlsf_block_size(p), caller);
 			__malloc_unlock(_REENT);
 			if (p) return p;
 		}
@@ -121,32 +149,74 @@ try_again:
 		goto try_again;
 	}
 	// there is no memory left even after fallback.
+	__malloc_lock(_REENT);
+	tracker.failed(size, caller);
+	__malloc_unlock(_REENT);
 	modm_assert_continue_fail_debug(0, "malloc",
 			"No memory left in any TLSF pools!", size);
 	return NULL;
 }
 
+void * malloc_traits(size_t size, uint32_t traits)
+{
+	return allocate(size, traits, __builtin_return_address(0));
+}
+
+// default is accessible by S-Bus and DMA-able
+static constexpr uint32_t default_traits = uint32_t(modm::MemoryTrait::AccessSBus) |
+										   uint32_t(modm::MemoryTrait::AccessDMA);
+
 void *__wrap__malloc_r(struct _reent *, size_t size)
 {
-	// default is accessible by S-Bus and DMA-able
-	return malloc_traits(size, uint32_t(modm::MemoryTrait::AccessSBus) |
-							   uint32_t(modm::MemoryTrait::AccessDMA));
+	return allocate(size, default_traits, __builtin_return_address(0));
 }
 
-void *__wrap__calloc_r(struct _reent *r, size_t size)
+void *__wrap__calloc_r(struct _reent *, size_t size)
 {
-	void *ptr = __wrap__malloc_r(r, size);
+	void *ptr = allocate(size, default_traits, __builtin_return_address(0));
 	if (ptr) memset(ptr, 0, size);
 	return ptr;
 }
 
+static void
+release(struct _reent *r, void *p, const void *caller)
+{
+	// do nothing if NULL pointer
+	if (!p) return;
+	__malloc_lock(r);
+	const tlsf_t pool = get_tlsf_for_ptr(p);
+	// free if pointer belongs to a pool.
+	if (pool)
+	{
+		tracker.freed(p, tlsf_block_size(p), caller);
+		tlsf_free(pool, p);
+	}
+	__malloc_unlock(r);
+}
+
 void *__wrap__realloc_r(struct _reent *r, void *p, size_t size)
 {
 	void *ptr = NULL;
+	const void *caller = __builtin_return_address(0);
+
+	// realloc(NULL, size) is malloc(size) and realloc(p, 0) is free(p)
+	if (!p) return allocate(size, default_traits, caller);
+	if (!size)
+	{
+		release(r, p, caller);
+		return NULL;
+	}
 
 	__malloc_lock(r);
 	const tlsf_t pool = get_tlsf_for_ptr(p);
+	const size_t old_size = tlsf_block_size(p);
 	if (pool) ptr = tlsf_realloc(pool, p, size);
+	if (ptr)
+	{
+		tracker.freed(p, old_size, caller);
+		tracker.allocated(ptr, size, tlsf_block_size(ptr), caller);
+	}
+	else tracker.failed(size, caller);
 	__malloc_unlock(r);
 
 	modm_assert_continue_fail_debug(ptr, "realloc",
@@ -156,13 +226,46 @@ void *__wrap__realloc_r(struct _reent *r, void *p, size_t size)
 
 void __wrap__free_r(struct _reent *r, void *p)
 {
-	// do nothing if NULL pointer
-	if (!p) return;
-	__malloc_lock(r);
-	const tlsf_t pool = get_tlsf_for_ptr(p);
-	// free if pointer belongs to a pool.
-	if (pool) tlsf_free(pool, p);
-	__malloc_unlock(r);
+	release(r, p, __builtin_return_address(0));
 }
 
 } // extern "C"
+
+// ----------------------------------------------------------------------------
+static void
+largest_free_walker(void *, size_t size, int used, void *user)
+{
+	size_t *largest = static_cast<size_t *>(user);
+	if (!used and size > *largest) *largest = size;
+}
+
+modm::HeapStatistics
+modm::getHeapStatistics()
+{
+	__malloc_lock(_REENT);
+	HeapStatistics statistics = tracker.getStatistics();
+	statistics.totalSize = total_size;
+	statistics.largestFree = 0;
+	for (pool_t region : regions)
+	{
+		if (region) tlsf_walk_pool(region, largest_free_walker, &statistics.largestFree);
+	}
+	__malloc_unlock(_REENT);
+	return statistics;
+}
+
+void
+modm::resetHeapStatistics()
+{
+	__malloc_lock(_REENT);
+	tracker.reset();
+	__malloc_unlock(_REENT);
+}
+
+void
+modm::setHeapTraceHandler(HeapTraceHandler handler)
+{
+	__malloc_lock(_REENT);
+	tracker.setTraceHandler(handler);
+	__malloc_unlock(_REENT);
+}
@@ -2,6 +2,7 @@
  * Copyright (c) 2010-2011, 2013, Fabian Greif
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012, 2014, 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -15,14 +16,19 @@
 
 #include <iostream>
 #include <ios>
+#include <algorithm>
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <fcntl.h>		// file control
+#include <poll.h>		// waiting for data
 #include <sys/ioctl.h>	// I/O control routines
 #include <termios.h>	// POSIX terminal control
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>	// vectored writes
 
 #include <errno.h>
 
@@ -36,7 +42,9 @@ modm::platform::SerialInterface::SerialInterface() :
 	isConnected(false),
 	deviceName("unknown"),
 	baudRate(0),
-	fileDescriptor(0)
+	fileDescriptor(0),
+	receiveIndex(0),
+	receiveCount(0)
 {
 }
 
@@ -45,7 +53,9 @@ modm::platform::SerialInterface::SerialInterface(
 	isConnected(false),
 	deviceName(device),
 	baudRate(baudRate),
-	fileDescriptor(0)
+	fileDescriptor(0),
+	receiveIndex(0),
+	receiveCount(0)
 {
 }
 
@@ -149,6 +159,8 @@ modm::platform::SerialInterface::open()
 			//           soll 'read' 0 zurueckliefern
 			fcntl(this->fileDescriptor, F_SETFL, FNDELAY);
 			this->isConnected = true;
+			this->receiveIndex = 0;
+			this->receiveCount = 0;
 
 			MODM_LOG_INFO << "Connected!" << modm::endl;
 			return true;
@@ -223,6 +235,8 @@ modm::platform::SerialInterface::close()
 		(void) result;
 
 		this->isConnected = false;
+		this->receiveIndex = 0;
+		this->receiveCount = 0;
 	}
 }
 
@@ -233,73 +247,197 @@ modm::platform::SerialInterface::isOpen()
 	return this->isConnected;
 }
 
+// ----------------------------------------------------------------------------
+bool
+modm::platform::SerialInterface::receive()
+{
+	const ssize_t result = ::read(this->fileDescriptor, this->receiveBuffer, ReceiveBufferSize);
+	if (result <= 0) {
+		return false;
+	}
+	this->receiveIndex = 0;
+	this->receiveCount = result;
+	return true;
+}
+
 // ----------------------------------------------------------------------------
 bool
 modm::platform::SerialInterface::read(char& c)
 {
-	if (::read(this->fileDescriptor, &c, 1) > 0)
-	{
-		MODM_LOG_DEBUG << "0x" << modm::hex << c << " " << modm::endl;
-		return true;
+	if (this->receiveIndex == this->receiveCount and not this->receive()) {
+		return false;
 	}
+	c = this->receiveBuffer[this->receiveIndex++];
+	MODM_LOG_DEBUG << "0x" << modm::hex << c << " " << modm::endl;
+	return true;
+}
 
-	return false;
+// ----------------------------------------------------------------------------
+std::size_t
+modm::platform::SerialInterface::read(uint8_t* data, std::size_t length)
+{
+	// serve the buffered data first
+	std::size_t count = std::min(length, this->receiveCount - this->receiveIndex);
+	std::memcpy(data, this->receiveBuffer + this->receiveIndex, count);
+	this->receiveIndex += count;
+
+	if (count < length)
+	{
+		if (length - count >= ReceiveBufferSize)
+		{
+			// large reads go directly to the destination
+			const ssize_t result = ::read(this->fileDescriptor, data + count, length - count);
+			if (result > 0) {
+				count += result;
+			}
+		}
+		else if (this->receive())
+		{
+			const std::size_t remaining = std::min(length - count, this->receiveCount);
+			std::memcpy(data + count, this->receiveBuffer, remaining);
+			this->receiveIndex = remaining;
+			count += remaining;
+		}
+	}
+	return count;
 }
 
 // ----------------------------------------------------------------------------
-void
-modm::platform::SerialInterface::readBytes(uint8_t* data, std::size_t length)
+bool
+modm::platform::SerialInterface::readBytes(uint8_t* data, std::size_t length,
+		std::chrono::milliseconds timeout)
 {
-	int delta = length;
-	int result = 0 ;
-	while (delta > 0)
+	const auto deadline = std::chrono::steady_clock::now() + timeout;
+	std::size_t count = this->read(data, length);
+	while (count < length)
 	{
-		result = ::read(this->fileDescriptor, (data + (length - delta)), delta);
-		if (result < 0) {
-			usleep(20);	// swap the thread, so that something could be done while waiting
-			continue;
+		std::chrono::milliseconds remaining = timeout;
+		if (timeout.count() >= 0)
+		{
+			remaining = std::chrono::ceil<std::chrono::milliseconds>(
+					deadline - std::chrono::steady_clock::now());
+			if (remaining.count() < 0) {
+				remaining = std::chrono::milliseconds(0);
+			}
+		}
+		if (not this->waitForData(remaining)) {
+			return false;
+		}
+		const std::size_t result = this->read(data + count, length - count);
+		if (result == 0) {
+			// readable, but no data: end of file or error
+			return false;
 		}
-		delta -= result;
+		count += result;
 	}
 
 	for (std::size_t i = 0; i < length; i++) {
 		MODM_LOG_DEBUG << "0x" << modm::hex << data[i] << modm::ascii << " ";
 	}
 	MODM_LOG_DEBUG << modm::endl;
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+bool
+modm::platform::SerialInterface::waitForData(std::chrono::milliseconds timeout)
+{
+	if (this->receiveIndex < this->receiveCount) {
+		return true;
+	}
+	struct pollfd fd = { this->fileDescriptor, POLLIN, 0 };
+	const int milliseconds = (timeout.count() < 0) ? -1 : int(timeout.count());
+	int result;
+	do {
+		result = poll(&fd, 1, milliseconds);
+	}
+	while (result < 0 and errno == EINTR);
+	return (result > 0) and (fd.revents & POLLIN);
+}
+
+// ----------------------------------------------------------------------------
+bool
+modm::platform::SerialInterface::waitForWrite()
+{
+	struct pollfd fd = { this->fileDescriptor, POLLOUT, 0 };
+	int result;
+	do {
+		result = poll(&fd, 1, -1);
+	}
+	while (result < 0 and errno == EINTR);
+	return (result > 0) and (fd.revents & POLLOUT);
 }
 
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::write(char c)
 {
-/*	SUB_LOGGER_LOG(logger, Logger::ERROR, "writeByte")
-		<< "0x" << std::hex << (int)data << "; ";
- */
-	int reply = ::write(this->fileDescriptor, &c, 1);
-	if (reply <= 0) {
-		this->dumpErrorMessage();
-	}
-//	SUB_LOGGER_LOG( logger, Logger::DEBUG, "writeByte" )
-//		<< "0x" << std::hex << data << " => " << reply << std::dec;
+	this->writeBytes(reinterpret_cast<const uint8_t*>(&c), 1);
 }
 
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::write(const char* str)
 {
-	char c;
-	while ((c = *str++)) {
-		this->write(c);
-	}
+	this->writeBytes(reinterpret_cast<const uint8_t*>(str), std::strlen(str));
+}
+
+// ----------------------------------------------------------------------------
+void
+modm::platform::SerialInterface::write(const char* data, std::size_t length)
+{
+	this->writeBytes(reinterpret_cast<const uint8_t*>(data), length);
 }
 
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::writeBytes(const uint8_t* data, std::size_t length)
 {
-	for (std::size_t i = 0; i < length; ++i) {
-		this->write(static_cast<char>(*data++));
+	struct iovec buffer = { const_cast<uint8_t*>(data), length };
+	this->writeVectored(&buffer, 1);
+}
+
+// ----------------------------------------------------------------------------
+bool
+modm::platform::SerialInterface::writeVectored(const struct iovec* buffers, std::size_t count)
+{
+	// the device is non-blocking, so partial writes must be continued
+	struct iovec vectors[IOV_MAX];
+	while (count > 0)
+	{
+		const std::size_t batch = std::min<std::size_t>(count, IOV_MAX);
+		std::copy_n(buffers, batch, vectors);
+		struct iovec* vector = vectors;
+		std::size_t remaining = batch;
+		while (remaining > 0)
+		{
+			const ssize_t result = ::writev(this->fileDescriptor, vector, remaining);
+			if (result < 0)
+			{
+				if ((errno == EAGAIN or errno == EINTR) and this->waitForWrite()) {
+					continue;
+				}
+				this->dumpErrorMessage();
+				return false;
+			}
+			// skip the written buffers and adjust the partially written one
+			std::size_t written = result;
+			while (remaining > 0 and written >= vector->iov_len)
+			{
+				written -= vector->iov_len;
+				vector++;
+				remaining--;
+			}
+			if (remaining > 0)
+			{
+				vector->iov_base = static_cast<uint8_t*>(vector->iov_base) + written;
+				vector->iov_len -= written;
+			}
+		}
+		buffers += batch;
+		count -= batch;
 	}
+	return true;
 }
 
 // ----------------------------------------------------------------------------
@@ -350,11 +488,11 @@ modm::platform::SerialInterface::dumpErrorMessage()
 std::size_t
 modm::platform::SerialInterface::bytesAvailable() const
 {
-	std::size_t bytesAvailable;
+	int bytesAvailable = 0;
 
 	ioctl(this->fileDescriptor, FIONREAD, &bytesAvailable);
 
-	return bytesAvailable;
+	return (this->receiveCount - this->receiveIndex) + std::max(bytesAvailable, 0);
 }
 
 // ----------------------------------------------------------------------------
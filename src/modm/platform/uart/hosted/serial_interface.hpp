@@ -2,6 +2,7 @@
  * Copyright (c) 2010-2011, 2013, Fabian Greif
  * Copyright (c) 2012-2013, Sascha Schade
  * Copyright (c) 2012, 2014, 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,10 +15,14 @@
 #ifndef MODM_HOSTED_SERIAL_INTERFACE_HPP
 #define MODM_HOSTED_SERIAL_INTERFACE_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <string>
 #include <stdint.h>
 #include <ostream>
 
+#include <sys/uio.h>
+
 #include <modm/io/iodevice.hpp>
 
 namespace modm
@@ -36,11 +41,22 @@ namespace modm
 		 *	- Read & write, whatever you want... Note: Use bytesAvailable() before read operation.
 		 *	- close()
 		 *
+		 * Received data is read from the device in chunks of up to
+		 * `ReceiveBufferSize` bytes into a buffer, from which all read
+		 * functions are served, so that reading single characters does not
+		 * need a system call each. Blocking reads wait with `poll()` for new
+		 * data instead of polling the device. Multiple buffers can be written
+		 * with a single system call via `writeVectored()`.
+		 *
 		 * @author	Philipp & Metty
 		 * @ingroup	modm_platform_uart
 		 */
 		class SerialInterface : public IODevice
 		{
+		public:
+			/// Maximum number of bytes read from the device at once
+			static constexpr std::size_t ReceiveBufferSize = 4096;
+
 		public:
 			/**
 			 * Constructor.
@@ -134,14 +150,33 @@ namespace modm
 			virtual bool
 			read(char& c);
 
+			/**
+			 * Read up to `length` bytes without waiting.
+			 *
+			 * @return	number of bytes read
+			 */
+			std::size_t
+			read(uint8_t* data, std::size_t length);
 
 			/**
 			 * Read length bytes from device.
 			 *
-			 * Tries until `length` bytes are read.
+			 * Waits until `length` bytes are read or the timeout expired,
+			 * a negative timeout waits forever.
+			 *
+			 * @return	\c true if all bytes were read, \c false on timeout or
+			 * 			error. The bytes read until then are stored in `data`.
 			 */
-			void
-			readBytes(uint8_t* data, std::size_t length);
+			bool
+			readBytes(uint8_t* data, std::size_t length,
+					  std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+			/**
+			 * Wait until data can be read or the timeout expired, a
+			 * negative timeout waits forever.
+			 */
+			bool
+			waitForData(std::chrono::milliseconds timeout);
 
 			/**
 			 * Write exactly one byte to device.
@@ -153,18 +188,37 @@ namespace modm
 			virtual void
 			write(const char* str);
 
+			/// Writes the block at once with writeBytes()
+			virtual void
+			write(const char* data, std::size_t length);
+
 			/**
 			 * Write length bytes to device.
 			 */
 			void
 			writeBytes(const uint8_t* data, std::size_t length);
 
+			/**
+			 * Write `count` buffers with as few system calls as possible,
+			 * e.g. header and payload of a packet.
+			 *
+			 * @return	\c true if all bytes were written
+			 */
+			bool
+			writeVectored(const struct iovec* buffers, std::size_t count);
+
 			/**
 			 * Return the number of bytes waiting to be read.
 			 */
 			std::size_t
 			bytesAvailable() const;
 
+			/// File descriptor for `epoll()`, `poll()` or `select()`.
+			/// Data may already be buffered, check bytesAvailable() first.
+			int
+			getFileDescriptor() const
+			{ return fileDescriptor; }
+
 			virtual void
 			flush();
 
@@ -181,12 +235,24 @@ namespace modm
 			void
 			dumpErrorMessage();
 
+			/// Refill the empty receive buffer without waiting
+			bool
+			receive();
+
+			/// Wait until the device is writable
+			bool
+			waitForWrite();
+
 			bool 			isConnected;	///< Is there an existing connection?
 			std::string 	deviceName;		///< The port (e.g. /dev/ttyS0)
 			unsigned int 	baudRate;
 
 			/// The file descriptor that is internally needed for handling the read/ write/ close operations
 			int 			fileDescriptor;
+
+			uint8_t			receiveBuffer[ReceiveBufferSize];
+			std::size_t		receiveIndex;
+			std::size_t		receiveCount;
 		};
 	}
 }
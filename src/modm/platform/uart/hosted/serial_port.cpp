@@ -2,6 +2,7 @@
  * Copyright (c) 2010-2011, Thorsten Lajewski
  * Copyright (c) 2010-2011, 2013, Fabian Greif
  * Copyright (c) 2014, 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -12,11 +13,26 @@
 // ----------------------------------------------------------------------------
 
 #include "serial_port.hpp"
+#include <cstring>
 #include <iostream>
+#include <span>
+#include <thread>
 
 modm::platform::SerialPort::SerialPort():
+	SerialPort(ownContext)
+{
+}
+
+modm::platform::SerialPort::SerialPort(boost::asio::io_context& context):
 	shutdown(true),
-	port(io_service)
+	tmpReadIndex(0),
+	tmpReadCount(0),
+	readStalled(false),
+	writeActive(false),
+	pendingHandlers(0),
+	context(context),
+	port(context),
+	thread(nullptr)
 {
 }
 
@@ -25,40 +41,135 @@ modm::platform::SerialPort::~SerialPort()
 	this->close();
 }
 
+template< typename Handler >
+void
+modm::platform::SerialPort::post(Handler&& handler)
+{
+	this->pendingHandlers++;
+	boost::asio::post(this->context,
+			[this, handler = std::forward<Handler>(handler)]() mutable
+			{
+				handler();
+				this->pendingHandlers--;
+			});
+}
+
+void
+modm::platform::SerialPort::stop()
+{
+	while (this->pendingHandlers.load(std::memory_order_acquire)) {
+		std::this_thread::yield();
+	}
+	if (this->thread)
+	{
+		this->work.reset();
+		this->thread->join();
+		delete this->thread;
+		this->thread = nullptr;
+		this->ownContext.restart();
+	}
+}
+
 void
 modm::platform::SerialPort::write(char c)
 {
-	this->io_service.post(boost::bind(&modm::platform::SerialPort::doWrite, this, c));
+	this->writeBytes(reinterpret_cast<const uint8_t*>(&c), 1);
 }
 
+void
+modm::platform::SerialPort::write(const char* str)
+{
+	this->writeBytes(reinterpret_cast<const uint8_t*>(str), std::strlen(str));
+}
+
+void
+modm::platform::SerialPort::write(const char* data, std::size_t length)
+{
+	this->writeBytes(reinterpret_cast<const uint8_t*>(data), length);
+}
+
+void
+modm::platform::SerialPort::writeBytes(const uint8_t* data, std::size_t length)
+{
+	std::span<const char> chars(reinterpret_cast<const char*>(data), length);
+	while (not this->shutdown)
+	{
+		chars = chars.subspan(this->writeBuffer.push(chars));
+
+		// the event loop must see the data, if it has just stopped sending
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (not this->writeActive.load(std::memory_order_relaxed) and
+			not this->writeActive.exchange(true))
+		{
+			this->post([this] { this->writeStart(); });
+		}
+		if (chars.empty()) {
+			break;
+		}
+		std::this_thread::yield();
+	}
+}
 
 void
 modm::platform::SerialPort::flush()
 {
+	while (this->writeActive.load(std::memory_order_acquire) and not this->shutdown) {
+		std::this_thread::yield();
+	}
+}
+
+void
+modm::platform::SerialPort::resumeRead()
+{
+	if (this->readStalled.load(std::memory_order_relaxed) and
+		this->readStalled.exchange(false))
+	{
+		this->post([this] { this->readForward(); });
+	}
 }
 
 void
 modm::platform::SerialPort::readStart()
 {
-	port.async_read_some(boost::asio::buffer(&this->tmpRead, sizeof(this->tmpRead)),
-			boost::bind(&modm::platform::SerialPort::readComplete,
-					this,
-					boost::asio::placeholders::error,
-					boost::asio::placeholders::bytes_transferred));
+	this->pendingHandlers++;
+	port.async_read_some(boost::asio::buffer(this->tmpRead, sizeof(this->tmpRead)),
+			[this](const boost::system::error_code& error, size_t bytes_transferred)
+			{
+				this->readComplete(error, bytes_transferred);
+				this->pendingHandlers--;
+			});
+}
+
+void
+modm::platform::SerialPort::readForward()
+{
+	this->tmpReadIndex += this->readBuffer.push(std::span<const char>(
+			this->tmpRead + this->tmpReadIndex, this->tmpReadCount - this->tmpReadIndex));
+
+	if (this->tmpReadIndex < this->tmpReadCount) {
+		// continued by the reading thread via resumeRead()
+		this->readStalled.store(true, std::memory_order_release);
+	}
+	else if (this->port.is_open()) {
+		this->readStart();
+	}
 }
 
 bool
 modm::platform::SerialPort::read(char& value)
 {
-	if(this->readBuffer.empty())
-		return false;
-	else
-	{
-		MutexGuard queueGuard( this->readMutex);
-		value=this->readBuffer.front();
-		this->readBuffer.pop();
-		return true;
-	}
+	const bool result = this->readBuffer.pop(value);
+	this->resumeRead();
+	return result;
+}
+
+std::size_t
+modm::platform::SerialPort::readBytes(uint8_t* data, std::size_t length)
+{
+	const std::size_t count = this->readBuffer.pop(
+			std::span<char>(reinterpret_cast<char*>(data), length));
+	this->resumeRead();
+	return count;
 }
 
 bool
@@ -69,11 +180,9 @@ modm::platform::SerialPort::open(std::string deviceName, unsigned int baudRate)
 		this->deviceName = deviceName;
 		this->baudRate = baudRate;
 
-		//std::cout << "open port" << std::endl;
-
-		this->shutdown = false;
-		this->port.open(this->deviceName);
-		if (!this->port.is_open()) {
+		boost::system::error_code error;
+		this->port.open(this->deviceName, error);
+		if (error or !this->port.is_open()) {
 			std::cerr << "Failed to open serial port " << deviceName << "\n";
 			return false;
 		}
@@ -84,9 +193,19 @@ modm::platform::SerialPort::open(std::string deviceName, unsigned int baudRate)
 		this->port.set_option(boost::asio::serial_port_base::character_size(8));
 		this->port.set_option(boost::asio::serial_port_base::stop_bits(boost::asio::serial_port_base::stop_bits::one));
 
-		this->io_service.post(boost::bind(&SerialPort::readStart, this));
+		this->tmpReadIndex = 0;
+		this->tmpReadCount = 0;
+		this->readStalled = false;
+		this->writeActive = false;
+		this->shutdown = false;
+
+		this->post([this] { this->readStart(); });
 
-		this->thread = new boost::thread(boost::bind(&boost::asio::io_service::run, &this->io_service));
+		if (&this->context == &this->ownContext)
+		{
+			this->work.emplace(this->ownContext.get_executor());
+			this->thread = new boost::thread([this] { this->ownContext.run(); });
+		}
 	}
 	else {
 		std::cerr << "Port already open!" << std::endl;
@@ -99,23 +218,17 @@ modm::platform::SerialPort::open(std::string deviceName, unsigned int baudRate)
 bool
 modm::platform::SerialPort::isOpen()
 {
-	return this->port.is_open() && !this->shutdown;
+	return !this->shutdown;
 }
 
 void
 modm::platform::SerialPort::close()
 {
-	if (!this->isOpen())
-		return;
-
-	this->io_service.post(boost::bind(
-			&modm::platform::SerialPort::doClose,
-			this,
-			boost::system::error_code()));
-
-	this->thread->join();
-	delete this->thread;
-	this->io_service.reset();
+	if (this->isOpen()) {
+		this->post([this] { this->doClose(boost::system::error_code()); });
+	}
+	// also finishes the event loop after the port was closed due to an error
+	this->stop();
 }
 
 void
@@ -124,78 +237,74 @@ modm::platform::SerialPort::kill()
 	if (!this->isOpen())
 		return;
 
-	this->io_service.post(boost::bind(
-				&modm::platform::SerialPort::doAbort,
-				this,
-				boost::system::error_code()));
+	this->post([this] { this->doAbort(boost::system::error_code()); });
 	this->shutdown = true;
-	this->thread->join();
-	delete this->thread;
-	this->io_service.reset();
+	this->stop();
 }
 
 void
 modm::platform::SerialPort::doAbort(const boost::system::error_code& error)
 {
-
-	if (error)
-		std::cerr << "Error: " << error.message() << std::endl;
-	this->port.close();
 	if (error)
 		std::cerr << "Error: " << error.message() << std::endl;
+
+	boost::system::error_code closeError;
+	this->port.close(closeError);
+	if (closeError)
+		std::cerr << "Error: " << closeError.message() << std::endl;
 }
 
 void
 modm::platform::SerialPort::doClose(const boost::system::error_code& error)
 {
-	if( this->writeBuffer.empty() ) {
+	// pending data is sent before the port is closed by writeStart()
+	if (not this->writeActive) {
 		this->doAbort(error);
 	}
 	this->shutdown = true;
 }
 
 void
-modm::platform::SerialPort::doWrite(const char c) {
-	if (!this->shutdown)
+modm::platform::SerialPort::writeStart(void)
+{
+	std::size_t count;
+	while ((count = this->writeBuffer.pop(std::span<char>(this->tmpWrite))) == 0)
 	{
-		std::cout<<"get 0x"<< std::hex << (int) c << std::dec
-		<< "(" << c << ")" << std::endl;
-
-		MutexGuard mutex(this->writeMutex);
-		bool idle = this->writeBuffer.empty();
-		this->writeBuffer.push(c);
-
-		if (idle) {
-			this->writeStart();
+		this->writeActive.store(false, std::memory_order_relaxed);
+		// writeBytes() may have pushed data after pop() and seen writeActive still set
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (this->writeBuffer.isEmpty())
+		{
+			if (this->shutdown) {
+				this->doAbort(boost::system::error_code());
+			}
+			return;
+		}
+		if (this->writeActive.exchange(true)) {
+			// writeBytes() has posted another writeStart()
+			return;
 		}
 	}
-}
 
-void
-modm::platform::SerialPort::writeStart(void)
-{
+	this->pendingHandlers++;
 	boost::asio::async_write(this->port,
-			boost::asio::buffer(&this->writeBuffer.front(), 1),
-			boost::bind(&modm::platform::SerialPort::writeComplete, this,
-					boost::asio::placeholders::error));
+			boost::asio::buffer(this->tmpWrite, count),
+			[this](const boost::system::error_code& error, size_t)
+			{
+				this->writeComplete(error);
+				this->pendingHandlers--;
+			});
 }
 
 void
 modm::platform::SerialPort::writeComplete(const boost::system::error_code& error)
 {
 	if (!error) {
-		MutexGuard mutex(this->writeMutex);
-		this->writeBuffer.pop();
-		if (!this->writeBuffer.empty()) {
-			std::cout << "restart " << this->writeBuffer.size() << std::endl;
-			this->writeStart();
-		}
-		else if (this->shutdown) {
-			this->doAbort(error);
-		}
+		this->writeStart();
 	}
 	else {
 		std::cerr << "Error in write: " << error.message() << std::endl;
+		this->writeActive = false;
 		this->doAbort(error);
 	}
 }
@@ -203,38 +312,36 @@ modm::platform::SerialPort::writeComplete(const boost::system::error_code& error
 void
 modm::platform::SerialPort::readComplete(const boost::system::error_code& error, size_t bytes_transferred)
 {
-    if (!error)
-    {
-    	{
-			MutexGuard queueGuard( this->readMutex);
-			for(unsigned int i=0; i<bytes_transferred; ++i)
-			{
-				std::cout<<"get 0x"<< std::hex << (int) this->tmpRead[i] << std::dec
-				<< "(" << this->tmpRead[i] << ")" << std::endl;
-				this->readBuffer.push(this->tmpRead[i]);
-			}
-    	}
-        this->readStart();
-    }
-    else
-    {
+	if (!error)
+	{
+		this->tmpReadIndex = 0;
+		this->tmpReadCount = bytes_transferred;
+		this->readForward();
+	}
+	else if (error != boost::asio::error::operation_aborted)
+	{
 		doClose(error);
-    }
+	}
 }
 
 void
 modm::platform::SerialPort::clearReadBuffer()
 {
-	MutexGuard queueGuard( this->readMutex);
-	while(!this->readBuffer.empty()) {
-		this->readBuffer.pop();
-	}
+	char data[256];
+	while (this->readBuffer.pop(std::span<char>(data))) {}
+	this->resumeRead();
 }
 
 void
 modm::platform::SerialPort::clearWriteBuffer()
 {
-	while(!this->writeBuffer.empty()) {
-		this->writeBuffer.pop();
-	}
+	if (!this->isOpen())
+		return;
+
+	// only the event loop may remove data from the transmit buffer
+	this->post([this]
+	{
+		char data[256];
+		while (this->writeBuffer.pop(std::span<char>(data))) {}
+	});
 }
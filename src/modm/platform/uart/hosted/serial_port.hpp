@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2011, 2013, Fabian Greif
  * Copyright (c) 2010, Thorsten Lajewski
  * Copyright (c) 2012, 2014, 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -15,13 +16,14 @@
 #ifndef MODM_HOSTED_SERIAL_PORT_HPP
 #define MODM_HOSTED_SERIAL_PORT_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <optional>
 #include <string>
-#include <queue>
 #include <boost/asio.hpp>
-#include <boost/bind/bind.hpp>
-#include <boost/thread/mutex.hpp>
 #include <boost/thread.hpp>
 
+#include <modm/architecture/driver/atomic/spsc_queue.hpp>
 #include <modm/io/iodevice.hpp>
 
 namespace modm
@@ -33,27 +35,69 @@ namespace modm
 		 *
 		 * Port is closed right after construction.
 		 *
+		 * The port reads blocks of up to `TransferSize` bytes asynchronously
+		 * into a lock-free receive buffer, and sends the content of a
+		 * lock-free transmit buffer in blocks of the same size. The read and
+		 * write functions may therefore be called from one thread while the
+		 * I/O is handled by the event loop in another. Received data is
+		 * kept in the I/O buffer while the receive buffer is full.
+		 *
+		 * By default every port runs its own event loop in a thread.
+		 * Alternatively, several ports can share one `boost::asio::io_context`,
+		 * which the caller must run in a single thread and keep running with
+		 * a work guard. open() and close() must not be called from that
+		 * thread.
+		 *
 		 * \ingroup	modm_platform_uart
 		 */
 		class SerialPort : IODevice
 		{
+		public :
+			/// Maximum number of bytes read or written at once
+			static constexpr std::size_t TransferSize = 4096;
+			/// Size of the receive and transmit buffer each
+			static constexpr std::size_t BufferSize = 65536;
+
 		public :
 
+			/// Port with its own event loop thread
 			SerialPort();
 
+			/// Port using the event loop of `context`, which must be run by the caller
+			explicit
+			SerialPort(boost::asio::io_context& context);
+
 			~SerialPort();
 
 			using IODevice::write;
 
+			/// Waits while the transmit buffer is full
 			virtual void
 			write(char c);
 
+			virtual void
+			write(const char* str);
+
+			/// Writes the block at once with writeBytes()
+			virtual void
+			write(const char* data, std::size_t length);
+
+			/// Waits until all bytes are in the transmit buffer
+			void
+			writeBytes(const uint8_t* data, std::size_t length);
+
+			/// Waits until the transmit buffer is sent
 			virtual void
 			flush();
 
 			virtual bool
 			read(char& value);
 
+			/// Reads up to `length` bytes without waiting
+			/// @return number of bytes read
+			std::size_t
+			readBytes(uint8_t* data, std::size_t length);
+
 			virtual bool
 			open( std::string deviceName, unsigned int baudRate );
 
@@ -73,35 +117,59 @@ namespace modm
 			clearWriteBuffer();
 
 		private:
-			typedef boost::mutex				Mutex;
-			typedef boost::mutex::scoped_lock	MutexGuard;
+			using Buffer = modm::atomic::SpscQueue<char, BufferSize>;
 
-			bool shutdown;
+			std::atomic<bool> shutdown;
 			std::string deviceName;
 			unsigned int baudRate;
-			Mutex readMutex;
-			Mutex writeMutex;
 
-			char tmpRead[512];
-			std::queue<char> writeBuffer;
-			std::queue<char> readBuffer;
+			// producer: event loop, consumer: reading thread
+			Buffer readBuffer;
+			char tmpRead[TransferSize];
+			std::size_t tmpReadIndex;
+			std::size_t tmpReadCount;
+			std::atomic<bool> readStalled;
+
+			// producer: writing thread, consumer: event loop
+			Buffer writeBuffer;
+			char tmpWrite[TransferSize];
+			std::atomic<bool> writeActive;
 
-			boost::asio::io_service  io_service;
+			/// Number of posted or started handlers, which still access the port
+			std::atomic<std::size_t> pendingHandlers;
+
+			using WorkGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+			boost::asio::io_context  ownContext;
+			boost::asio::io_context& context;
 			boost::asio::serial_port port;
 			boost::thread* 			 thread;
+			std::optional<WorkGuard> work;
+
+			template< typename Handler >
+			void
+			post(Handler&& handler);
+
+			/// Waits until all handlers are finished and stops the own event loop
+			void
+			stop();
+
+			/// Restarts reading once the receive buffer has space again
+			void
+			resumeRead();
 
 			void
 			readStart();
 
+			void
+			readForward();
+
 	        void
 	        doClose(const boost::system::error_code& error);
 
 	        void
 	        doAbort(const boost::system::error_code& error);
 
-	        void
-	        doWrite(const char c);
-
 	        void
 	        writeStart(void);
 
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2013, Fabian Greif
  * Copyright (c) 2014, 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -92,16 +93,7 @@ template<int N>
 std::size_t
 modm::platform::StaticSerialInterface<N>::read(uint8_t *data, std::size_t length)
 {
-	// Check how many bytes are available before reading to
-	// avoid a blocking access.
-	std::size_t available = backend->bytesAvailable();
-	if (available < length) {
-		length = available;
-	}
-
-	backend->readBytes(data, length);
-
-	return length;
+	return backend->read(data, length);
 }
 
 template<int N>
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2011-2012, Fabian Greif
  * Copyright (c) 2012, 2018, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,16 +15,28 @@
 #define MODM_STDLIB_QUEUE_HPP
 
 #include <stdint.h>
-#include <deque>
+#include <cstddef>
+#include <memory>
 
 #include <mutex>
+#include <condition_variable>
 
 namespace modm
 {
 	namespace rtos
 	{
 		/**
-		 * Thread-safe Queue.
+		 * Thread-safe bounded Queue.
+		 *
+		 * The items are stored in a ring buffer of uninitialized storage, which
+		 * is allocated once on construction. Items are copy-constructed into
+		 * the buffer and destroyed when they are removed, so `T` does not need
+		 * to be default-constructible. Threads blocking on a full or empty queue wait on a
+		 * condition variable until another thread gets or appends an item or
+		 * the timeout expires.
+		 *
+		 * All timeouts are given in milliseconds, a timeout of `-1` waits
+		 * forever, a timeout of `0` does not wait at all.
 		 *
 		 * \ingroup	modm_processing_rtos
 		 */
@@ -47,26 +60,33 @@ namespace modm
 			std::size_t
 			getSize() const;
 
+			/// Post an item to the back of the queue.
 			bool
 			append(const T& item, uint32_t timeout = -1);
 
+			/// Post an item to the front of the queue.
 			bool
 			prepend(const T& item, uint32_t timeout = -1);
 
 
+			/// Copy the item at the front of the queue without removing it.
 			bool
 			peek(T& item, uint32_t timeout = -1) const;
 
+			/// Copy and remove the item at the front of the queue.
 			bool
 			get(T& item, uint32_t timeout = -1);
 
 
+			/// Never blocks.
 			inline bool
 			appendFromInterrupt(const T& item);
 
+			/// Never blocks.
 			inline bool
 			prependFromInterrupt(const T& item);
 
+			/// Never blocks.
 			inline bool
 			getFromInterrupt(T& item);
 
@@ -78,12 +98,29 @@ namespace modm
 			Queue&
 			operator = (const Queue& other);
 
-			mutable std::timed_mutex mutex;
+			template<typename Predicate>
+			static bool
+			wait(std::condition_variable& condition, std::unique_lock<std::mutex>& lock,
+				 uint32_t timeout, Predicate predicate);
+
+			mutable std::mutex mutex;
 
-			uint32_t maxSize;
-			std::deque<T> deque;
+			// Signaled whenever an item was added
+			mutable std::condition_variable notEmpty;
+			// Signaled whenever an item was removed
+			std::condition_variable notFull;
+
+			const uint32_t maxSize;
+			std::allocator<T> allocator;
+			T* const buffer;
+
+			// index of the front item
+			uint32_t head;
+			uint32_t count;
 		};
 	}
 }
 
+#include "queue_impl.hpp"
+
 #endif // MODM_STDLIB_QUEUE_HPP
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2012, Fabian Greif
  * Copyright (c) 2012, 2017-2018, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -19,92 +20,120 @@
 
 template <typename T>
 modm::rtos::Queue<T>::Queue(uint32_t length) :
-	maxSize(length)
+	maxSize(length), buffer(allocator.allocate(length)), head(0), count(0)
 {
 }
 
 template <typename T>
 modm::rtos::Queue<T>::~Queue()
 {
+	for (; count > 0; --count)
+	{
+		std::destroy_at(buffer + head);
+		if (++head >= maxSize) {
+			head = 0;
+		}
+	}
+	allocator.deallocate(buffer, maxSize);
+}
+
+template <typename T>
+template <typename Predicate>
+bool
+modm::rtos::Queue<T>::wait(std::condition_variable& condition,
+		std::unique_lock<std::mutex>& lock, uint32_t timeout, Predicate predicate)
+{
+	if (timeout == uint32_t(-1)) {
+		condition.wait(lock, predicate);
+		return true;
+	}
+	return condition.wait_for(lock, std::chrono::milliseconds(timeout), predicate);
 }
 
 template <typename T>
 std::size_t
 modm::rtos::Queue<T>::getSize() const
 {
-	std::lock_guard<std::timed_mutex> lock(mutex);
-	deque.size();
+	std::lock_guard<std::mutex> lock(mutex);
+	return count;
 }
 
 template <typename T>
 bool
-modm::rtos::Queue<T>::append(const T& item, uint32_t timeout = -1)
+modm::rtos::Queue<T>::append(const T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout)) ||
-			deque.size() >= maxSize) {
-		return false;
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!wait(notFull, lock, timeout, [this] { return count < maxSize; })) {
+			return false;
+		}
+
+		uint32_t tail = head + count;
+		if (tail >= maxSize) {
+			tail -= maxSize;
+		}
+		std::construct_at(buffer + tail, item);
+		++count;
 	}
-
-	deque.push_back(item);
-	mutex.unlock();
+	// notify after unlocking, so that the woken thread does not block again
+	notEmpty.notify_one();
+	return true;
 }
 
 template <typename T>
 bool
-modm::rtos::Queue<T>::prepend(const T& item, uint32_t timeout = -1)
+modm::rtos::Queue<T>::prepend(const T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
-	}
-
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!wait(notFull, lock, timeout, [this] { return count < maxSize; })) {
+			return false;
+		}
+
+		const uint32_t front = (head == 0) ? (maxSize - 1) : (head - 1);
+		std::construct_at(buffer + front, item);
+		head = front;
+		++count;
 	}
-
-	deque.push_front(item);
-	mutex.unlock();
-
-	return false;
+	notEmpty.notify_one();
+	return true;
 }
 
 // ----------------------------------------------------------------------------
 template <typename T>
 bool
-modm::rtos::Queue<T>::peek(T& item, uint32_t timeout = -1) const
+modm::rtos::Queue<T>::peek(T& item, uint32_t timeout) const
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
+	std::unique_lock<std::mutex> lock(mutex);
+	if (!wait(notEmpty, lock, timeout, [this] { return count > 0; })) {
 		return false;
 	}
 
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
-	}
-
-	item = deque.front();
-
-	mutex.unlock();
+	item = buffer[head];
+	lock.unlock();
+	// the item is still there, pass the wake-up on to another waiting thread
+	notEmpty.notify_one();
 	return true;
 }
 
 template <typename T>
 bool
-modm::rtos::Queue<T>::get(T& item, uint32_t timeout = -1)
+modm::rtos::Queue<T>::get(T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
-	}
-
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!wait(notEmpty, lock, timeout, [this] { return count > 0; })) {
+			return false;
+		}
+
+		item = std::move(buffer[head]);
+		std::destroy_at(buffer + head);
+		if (++head >= maxSize) {
+			head = 0;
+		}
+		--count;
 	}
-
-	item = deque.front();
-	deque.pop_front();
-
-	mutex.unlock();
+	notFull.notify_one();
 	return true;
 }
 
@@ -113,19 +142,19 @@ template <typename T>
 inline bool
 modm::rtos::Queue<T>::appendFromInterrupt(const T& item)
 {
-	return append(item);
+	return append(item, 0);
 }
 
 template <typename T>
 inline bool
 modm::rtos::Queue<T>::prependFromInterrupt(const T& item)
 {
-	return prepend(item);
+	return prepend(item, 0);
 }
 
 template <typename T>
 inline bool
 modm::rtos::Queue<T>::getFromInterrupt(T& item)
 {
-	return get(item);
+	return get(item, 0);
 }
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -10,37 +11,128 @@
  */
 // ----------------------------------------------------------------------------
 
+#include <new>
+
 #include "scheduler.hpp"
 
 // ----------------------------------------------------------------------------
 modm::Scheduler::Scheduler() :
-	taskList(0), readyList(0), currentPriority(0)
+	heap(0), heapSize(0), heapCapacity(0),
+	readyList(0), removedList(0), now(0), currentPriority(0)
 {
 }
 
+modm::Scheduler::~Scheduler()
+{
+	deleteRemoved();
+	for (uint16_t ii = 0; ii < heapSize; ii++) {
+		delete heap[ii];
+	}
+	delete[] heap;
+}
+
 // ----------------------------------------------------------------------------
-void
+bool
 modm::Scheduler::scheduleTask(Task& task,
-		uint16_t period,
+		uint32_t period,
 		Priority priority)
 {
-	TaskListItem *item = new TaskListItem(task, period, priority);
+	deleteRemoved();
 
-	if (taskList == 0) {
-		taskList = item;
+	if (period == 0) {
+		period = 1;
 	}
-	else {
-		item->nextTask = taskList;
-		taskList = item;
+
+	TaskListItem *item = new (std::nothrow) TaskListItem(task, period, 0, priority);
+	if (item == 0) {
+		return false;
 	}
+
+	TaskListItem **oldHeap = 0;
+	if (heapSize == heapCapacity)
+	{
+		// the new array is allocated outside of the atomic lock, but the
+		// copy and exchange must not be interrupted by the scheduler, which
+		// reorders the heap
+		const uint16_t capacity = heapCapacity ? heapCapacity * 2 : 4;
+		TaskListItem **newHeap = new (std::nothrow) TaskListItem*[capacity];
+		if (newHeap == 0 or capacity <= heapCapacity) {
+			delete[] newHeap;
+			delete item;
+			return false;
+		}
+
+		modm::atomic::Lock lock;
+		for (uint16_t ii = 0; ii < heapSize; ii++) {
+			newHeap[ii] = heap[ii];
+		}
+		oldHeap = heap;
+		heap = newHeap;
+		heapCapacity = capacity;
+	}
+
+	{
+		modm::atomic::Lock lock;
+		item->deadline = now + period;
+		item->index = heapSize;
+		heap[heapSize++] = item;
+		siftUp(item->index);
+	}
+
+	delete[] oldHeap;
+	return true;
 }
 
 // ----------------------------------------------------------------------------
-/*bool
+bool
 modm::Scheduler::removeTask(const Task& task)
 {
+	deleteRemoved();
+
+	TaskListItem *item = 0;
+	{
+		modm::atomic::Lock lock;
+		for (uint16_t ii = 0; ii < heapSize; ii++)
+		{
+			if (&heap[ii]->task == &task) {
+				item = heap[ii];
+				break;
+			}
+		}
+		if (item == 0) {
+			return false;
+		}
+
+		// replace with the last element and restore the heap order
+		const uint16_t index = item->index;
+		TaskListItem *last = heap[--heapSize];
+		if (last != item)
+		{
+			heap[index] = last;
+			last->index = index;
+			siftUp(index);
+			siftDown(last->index);
+		}
+
+		if (item->state == TaskListItem::READY)
+		{
+			TaskListItem **list = &readyList;
+			while (*list != item) {
+				list = &(*list)->nextReady;
+			}
+			*list = item->nextReady;
+		}
+		else if (item->state == TaskListItem::RUNNING)
+		{
+			// still executed, deleted the next time a task is added or removed
+			item->removed = true;
+			return true;
+		}
+	}
+
+	delete item;
+	return true;
 }
-*/
 
 // ----------------------------------------------------------------------------
 void
@@ -48,3 +140,21 @@ modm::Scheduler::schedule()
 {
 	this->scheduleInterupt();
 }
+
+// ----------------------------------------------------------------------------
+void
+modm::Scheduler::deleteRemoved()
+{
+	TaskListItem *item;
+	{
+		modm::atomic::Lock lock;
+		item = removedList;
+		removedList = 0;
+	}
+	while (item != 0)
+	{
+		TaskListItem *next = item->nextReady;
+		delete item;
+		item = next;
+	}
+}
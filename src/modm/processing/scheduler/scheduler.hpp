@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012, 2015-2016, Niklas Hauser
  * Copyright (c) 2013, Kevin Läufer
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -32,9 +33,15 @@ namespace modm
 	 * with the highest priority is executed. It will only change tasks if a
 	 * task with a higher priority becomes ready or the current task ends.
 	 *
+	 * The tasks are kept in a binary heap ordered by their next deadline, so
+	 * a tick only compares the earliest deadline with the current time and
+	 * its cost does not depend on the number of tasks. Only due tasks cost
+	 * O(log n) to be rescheduled.
+	 *
 	 * \warning	Works for ATmega, but currently not for the ATxmega!
 	 *
 	 * \author	Fabian Greif
+	 * \author	Thomas Sommer
 	 * \todo	Check that this implementation works from inside an interrupt
 	 */
 	class Scheduler
@@ -55,14 +62,28 @@ namespace modm
 	public:
 		Scheduler();
 
-		void
+		~Scheduler();
+
+		/**
+		 * Adds a task, which is executed every `period` ticks, first after
+		 * `period` ticks from now.
+		 *
+		 * \param	period		in ticks, from 1 to 2^31 - 1
+		 * \param	priority	tasks with priority zero are never executed
+		 * \return	`false` if no memory could be allocated
+		 */
+		bool
 		scheduleTask(Task& task,
-					 uint16_t period,
+					 uint32_t period,
 					 Priority priority = 127);
 
-		// TODO	Implement this function
-		/*bool
-		removeTask(const Task& task);*/
+		/**
+		 * Removes a task, also from inside its own run() function.
+		 *
+		 * \return	`false` if the task was not scheduled
+		 */
+		bool
+		removeTask(const Task& task);
 
 		void
 		schedule();
@@ -74,20 +95,21 @@ namespace modm
 		struct TaskListItem
 		{
 			TaskListItem(Task& task,
-						 uint16_t period,
+						 uint32_t period,
+						 uint32_t deadline,
 						 Priority priority) :
-				nextTask(0), nextReady(0), task(task),
-				period(period), time(period), priority(priority),
-				state(WAITING)
+				nextReady(0), task(task),
+				period(period), deadline(deadline), priority(priority),
+				state(WAITING), removed(false)
 			{
 			}
 
-			TaskListItem *nextTask;
 			TaskListItem *nextReady;
 
 			Task& task;
-			uint16_t period;
-			uint16_t time;
+			uint32_t period;
+			uint32_t deadline;		///< tick of the next execution
+			uint16_t index;			///< position in the heap
 			Priority priority;
 			/// @cond
 			enum {
@@ -96,11 +118,36 @@ namespace modm
 				WAITING
 			} state;
 			/// @endcond
+			bool removed;			///< deleted after run() returns
 		};
 
-		TaskListItem *taskList;
+		/// Earliest deadline first, correct as long as the periods are below 2^31
+		static modm_always_inline bool
+		isEarlier(const TaskListItem *a, const TaskListItem *b)
+		{
+			return int32_t(a->deadline - b->deadline) < 0;
+		}
+
+		void
+		siftUp(uint16_t index);
+
+		void
+		siftDown(uint16_t index);
+
+		void
+		setReady(TaskListItem *item);
+
+		void
+		deleteRemoved();
+
+		TaskListItem **heap;
+		uint16_t heapSize;
+		uint16_t heapCapacity;
+
 		TaskListItem *readyList;
+		TaskListItem *removedList;
 
+		uint32_t now;
 		Priority currentPriority;
 	};
 }
@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Georgi Grinshpun
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -16,16 +17,16 @@
 	#error	"Don't include this file directly, use 'scheduler.hpp' instead!"
 #endif
 
-/* item is element of two lists (schedule list and ready list).
- * ready list is order by its priority.
+/* item is element of two lists (deadline heap and ready list).
+ * heap is ordered by the next deadline, ready list by the priority.
  *
  * ALGORITHM:
  * ----------------------------------------------------------------------------
- * foreach item
- *     decrement
- *     if time = 0
- *         reload time
- *         set as ready
+ * increment time
+ * while first item of heap is due
+ *     advance deadline by period
+ *     restore heap order
+ *     set as ready, unless it is still ready or running
  *
  * foreach item is ready (ordered by priority)
  *     run item
@@ -35,44 +36,20 @@
 inline void
 modm::Scheduler::scheduleInterupt()
 {
-	if (taskList == 0) {
-		// nothing to schedule right now
-		return;
-	}
-
-	// update all tasks
-	TaskListItem *item = taskList;
-	do {
-		item->time--;
-		if (item->time == 0) {
-			item->time = item->period;
+	now++;
 
-			// add to ready list
-			if ((readyList == 0) ||
-				(readyList->priority < item->priority))
-			{
-				item->nextReady = readyList;
-				readyList = item;
-			}
-			else {
-				TaskListItem *list = readyList;
+	// only the earliest deadline must be compared with the current time
+	TaskListItem *item;
+	while ((heapSize != 0) &&
+			(int32_t(now - (item = heap[0])->deadline) >= 0))
+	{
+		item->deadline += item->period;
+		siftDown(0);
 
-				while (true)
-				{
-					if ((list->nextReady == 0) ||
-						(list->nextReady->priority < item->priority))
-					{
-						item->nextReady = list->nextReady;
-						list->nextReady = item;
-						break;
-					}
-					list = list->nextReady;
-				}
-			}
-			item->state = TaskListItem::READY;
+		if (item->state == TaskListItem::WAITING) {
+			setReady(item);
 		}
 	}
-	while ((item = item->nextTask) != 0);
 
 	// now execute the tasks which are ready
 	while (((item = modm::accessor::asVolatile(readyList)) != 0) &&
@@ -80,6 +57,7 @@ modm::Scheduler::scheduleInterupt()
 	{
 		item->state = TaskListItem::RUNNING;
 		readyList = item->nextReady;
+		const Priority previousPriority = currentPriority;
 		currentPriority = item->priority;
 		{
 			modm::atomic::Unlock();
@@ -88,7 +66,70 @@ modm::Scheduler::scheduleInterupt()
 			// enabled
 			item->task.run();
 		}
-		currentPriority = 0;
-		item->state = TaskListItem::WAITING;
+		currentPriority = previousPriority;
+
+		if (item->removed) {
+			item->nextReady = removedList;
+			removedList = item;
+		}
+		else {
+			item->state = TaskListItem::WAITING;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+inline void
+modm::Scheduler::setReady(TaskListItem *item)
+{
+	// add to ready list, after all tasks with the same priority
+	TaskListItem **list = &readyList;
+	while ((*list != 0) && ((*list)->priority >= item->priority)) {
+		list = &(*list)->nextReady;
+	}
+	item->nextReady = *list;
+	*list = item;
+	item->state = TaskListItem::READY;
+}
+
+inline void
+modm::Scheduler::siftUp(uint16_t index)
+{
+	TaskListItem *item = heap[index];
+	while (index > 0)
+	{
+		const uint16_t parent = (index - 1) / 2;
+		if (not isEarlier(item, heap[parent])) {
+			break;
+		}
+		heap[index] = heap[parent];
+		heap[index]->index = index;
+		index = parent;
+	}
+	heap[index] = item;
+	item->index = index;
+}
+
+inline void
+modm::Scheduler::siftDown(uint16_t index)
+{
+	TaskListItem *item = heap[index];
+	while (true)
+	{
+		uint16_t child = 2 * index + 1;
+		if (child >= heapSize) {
+			break;
+		}
+		if ((child + 1 < heapSize) && isEarlier(heap[child + 1], heap[child])) {
+			child++;
+		}
+		if (not isEarlier(heap[child], item)) {
+			break;
+		}
+		heap[index] = heap[child];
+		heap[index]->index = index;
+		index = child;
 	}
+	heap[index] = item;
+	item->index = index;
 }
@@ -2,6 +2,7 @@
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2014, Sascha Schade
  * Copyright (c) 2014-2015, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,3 +15,4 @@
 #include "timer/timestamp.hpp"
 #include "timer/timeout.hpp"
 #include "timer/periodic_timer.hpp"
+#include "timer/timer_wheel.hpp"
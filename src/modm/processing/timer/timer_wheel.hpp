@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+#include "timeout.hpp"
+#include <cstddef>
+
+namespace modm
+{
+
+/**
+ * Hierarchical timer wheel, which multiplexes many timeouts onto one clock.
+ *
+ * The `update()` function reads the clock once and advances the wheel tick
+ * by tick to the current time. Every tick only looks at one slot, so the cost
+ * does not depend on the number of armed entries, and the `expired()` function
+ * is only called for entries that actually expired. The timeouts polled by the
+ * application only check a flag instead of reading the clock.
+ *
+ * Entries are kept in `Levels` wheels with `2^Bits` slots each. Entries
+ * further than the range of all levels are moved down the levels again.
+ *
+ * @warning	The wheel and its entries must only be used from the main loop,
+ * 			not from interrupts.
+ *
+ * @tparam	Clock
+ * 		Used clock which inherits from modm::Clock, one tick per clock unit.
+ * @tparam	Bits
+ * 		log2 of the number of slots per level.
+ * @tparam	Levels
+ * 		Number of levels of the hierarchy.
+ *
+ * @author	Thomas Sommer
+ * @ingroup	modm_processing_timer
+ */
+template< class Clock, uint8_t Bits = 6, uint8_t Levels = 4 >
+class GenericTimerWheel
+{
+	static_assert(Bits >= 1 and Levels >= 1 and Bits * Levels <= 32,
+				  "The levels must cover at most 32 bits!");
+
+public:
+	using clock = Clock;
+	using duration = std::chrono::duration<uint32_t, typename Clock::period>;
+	using wide_signed_duration = std::chrono::duration<int64_t, typename Clock::period>;
+
+	/**
+	 * Base class of everything armed in the wheel, which is called by
+	 * `update()` when it expires. It is removed from the wheel when
+	 * destroyed.
+	 */
+	class Entry
+	{
+	public:
+		Entry(GenericTimerWheel& wheel) : wheel(wheel) {}
+		Entry(const Entry&) = delete;
+		Entry& operator=(const Entry&) = delete;
+		~Entry() { wheel.remove(*this); }
+
+		/// @return `true` if the entry waits for its expiration
+		bool
+		isLinked() const
+		{ return pprev != nullptr; }
+
+	protected:
+		/// Called once from `update()` after the entry has been removed
+		virtual void
+		expired() = 0;
+
+		GenericTimerWheel& wheel;
+
+	private:
+		Entry *next{nullptr};
+		Entry **pprev{nullptr};
+		uint32_t expiry{0};
+
+		friend class GenericTimerWheel;
+	};
+
+	/// Timeout with the interface of `modm::GenericTimeout`
+	class Timeout;
+
+	/// Periodic timer with the interface of `modm::GenericPeriodicTimer`
+	class PeriodicTimer;
+
+public:
+	GenericTimerWheel() : current(now()) {}
+
+	/**
+	 * Arms the entry to expire after the interval, or rearms it if already
+	 * armed. The interval is rounded up to at least one tick.
+	 */
+	void
+	insert(Entry& entry, duration interval);
+
+	/// Disarms the entry without calling `expired()`
+	void
+	remove(Entry& entry);
+
+	/**
+	 * Advances the wheel to the current time of the clock and calls
+	 * `expired()` of all entries that expired in the meantime.
+	 *
+	 * @return the number of expired entries
+	 */
+	std::size_t
+	update();
+
+	/// @return the number of armed entries
+	std::size_t
+	size() const
+	{ return count; }
+
+protected:
+	static constexpr uint32_t Slots = 1ul << Bits;
+	static constexpr uint32_t Mask = Slots - 1;
+
+	static uint32_t
+	now()
+	{ return std::chrono::duration_cast<duration>(Clock::now().time_since_epoch()).count(); }
+
+	void
+	link(Entry& entry);
+
+	static void
+	unlink(Entry& entry);
+
+	void
+	cascade(uint8_t level);
+
+	std::size_t
+	step();
+
+	void
+	rearm(Entry& entry, duration interval)
+	{
+		entry.expiry += interval.count();
+		link(entry);
+		count++;
+	}
+
+	Entry *slots[Levels][Slots] = {};
+	uint32_t current;
+	std::size_t count{0};
+};
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+class GenericTimerWheel<Clock, Bits, Levels>::Timeout : protected Entry
+{
+public:
+	using duration = GenericTimerWheel::duration;
+	using wide_signed_duration = GenericTimerWheel::wide_signed_duration;
+
+	/// Create a stopped timeout
+	Timeout(GenericTimerWheel& wheel) : Entry(wheel) {}
+
+	/// Create and start the timeout
+	template< typename Rep, typename Period >
+	Timeout(GenericTimerWheel& wheel, std::chrono::duration<Rep, Period> interval) :
+		Entry(wheel)
+	{ restart(interval); }
+
+	/// Restart the timer with the current timeout.
+	void restart()
+	{ restart(_interval); }
+
+	/// Set a new timeout value.
+	template< typename Rep, typename Period >
+	void restart(std::chrono::duration<Rep, Period> interval);
+
+	/// Stops the timer and sets isStopped() to `true`, and isExpired() to `false`.
+	void
+	stop();
+
+	/// @return the time until (positive time) or since (negative time) expiration, or 0 if stopped
+	wide_signed_duration
+	remaining() const;
+
+	/// @return the currently set interval
+	duration
+	interval() const
+	{ return _interval; }
+
+	/// @return the current state of the timeout
+	TimerState
+	state() const
+	{ return TimerState(_state & STATUS_MASK); }
+
+	/// @return `true` if the timeout is stopped, `false` otherwise
+	bool
+	isStopped() const
+	{ return _state == STOPPED; }
+
+	/// @return `true` if the timeout has expired, `false` otherwise
+	bool
+	isExpired() const
+	{ return _state & EXPIRED; }
+
+	/// @return `true` if the timeout is armed (not stopped and not expired), `false` otherwise
+	bool
+	isArmed() const
+	{ return _state == ARMED; }
+
+	/// @return `true` exactly once, after the timeout expired
+	bool
+	execute();
+
+protected:
+	void
+	expired() override
+	{ _state = EXPIRED; }
+
+	enum
+	InternalState : uint8_t
+	{
+		STOPPED  = int(TimerState::Stopped),
+		EXPIRED  = int(TimerState::Expired),
+		ARMED    = int(TimerState::Armed),
+		EXECUTED = 0b1000,
+		STATUS_MASK = (EXPIRED | ARMED | STOPPED)
+	};
+
+	uint32_t _start{0};
+	duration _interval{0};
+	uint8_t _state{STOPPED};
+};
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+class GenericTimerWheel<Clock, Bits, Levels>::PeriodicTimer : public Timeout
+{
+public:
+	// Inherit all constructors
+	using Timeout::Timeout;
+
+	/**
+	 * For a duration of 0, this function will always expire, but only return 1.
+	 *
+	 * @return the number of missed periods, or zero if not expired yet
+	 */
+	std::size_t
+	execute();
+
+protected:
+	void
+	expired() override;
+
+	std::size_t periods{0};
+};
+
+/// Timer wheel with millisecond resolution.
+/// @ingroup	modm_processing_timer
+using        TimerWheel = GenericTimerWheel< Clock >;
+
+/// Timer wheel with microsecond resolution.
+/// @ingroup	modm_processing_timer
+using PreciseTimerWheel = GenericTimerWheel< PreciseClock >;
+
+}	// namespace modm
+
+#include "timer_wheel_impl.hpp"
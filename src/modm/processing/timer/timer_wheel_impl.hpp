@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::insert(Entry& entry, duration interval)
+{
+	if (entry.isLinked()) {
+		unlink(entry);
+		count--;
+	}
+	modm_assert_continue_fail_debug(interval.count() <= 0x7fff'ffff, "tmr.size",
+			"Timer interval must be smaller than half the maximal duration!", interval.count());
+
+	// an empty wheel may not have been updated for a long time
+	if (count == 0) current = now();
+	entry.expiry = now() + (interval.count() ? interval.count() : 1);
+	link(entry);
+	count++;
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::remove(Entry& entry)
+{
+	if (entry.isLinked()) {
+		unlink(entry);
+		count--;
+	}
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+std::size_t
+modm::GenericTimerWheel<Clock, Bits, Levels>::update()
+{
+	const uint32_t time = now();
+	std::size_t expired{0};
+	while (int32_t(time - current) > 0)
+	{
+		// nothing to expire, so the wheel can jump to the current time
+		if (count == 0) {
+			current = time;
+			break;
+		}
+		expired += step();
+	}
+	return expired;
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::link(Entry& entry)
+{
+	const uint32_t delta = entry.expiry - current;
+
+	// the lowest level on which all higher bits are already equal
+	uint8_t level = 0;
+	for (; level < Levels - 1; level++)
+	{
+		const uint8_t shift = Bits * (level + 1);
+		if ((entry.expiry >> shift) == (current >> shift)) break;
+	}
+
+	const uint8_t shift = Bits * level;
+	uint32_t slot = (entry.expiry >> shift) & Mask;
+	if ((level == Levels - 1) and (uint64_t(delta) >= (uint64_t(Slots - 1) << shift)))
+	{
+		// out of range: wait in the slot passed last and insert again then
+		slot = ((current >> shift) - 1) & Mask;
+	}
+
+	Entry **head = &slots[level][slot];
+	entry.next = *head;
+	if (entry.next) entry.next->pprev = &entry.next;
+	entry.pprev = head;
+	*head = &entry;
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::unlink(Entry& entry)
+{
+	*entry.pprev = entry.next;
+	if (entry.next) entry.next->pprev = entry.pprev;
+	entry.next = nullptr;
+	entry.pprev = nullptr;
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::cascade(uint8_t level)
+{
+	Entry **head = &slots[level][(current >> (Bits * level)) & Mask];
+	while (Entry *entry = *head)
+	{
+		unlink(*entry);
+		link(*entry);
+	}
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+std::size_t
+modm::GenericTimerWheel<Clock, Bits, Levels>::step()
+{
+	std::size_t expired{0};
+	current++;
+
+	// move the entries of the next higher slot down when a level wraps around
+	for (uint8_t level = 1; level < Levels; level++)
+	{
+		if ((current >> (Bits * (level - 1))) & Mask) break;
+		cascade(level);
+	}
+
+	Entry **head = &slots[0][current & Mask];
+	while (Entry *entry = *head)
+	{
+		unlink(*entry);
+		if (entry->expiry != current) {
+			// only out of range entries of a single level wheel
+			link(*entry);
+			continue;
+		}
+		count--;
+		expired++;
+		entry->expired();
+	}
+	return expired;
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, uint8_t Bits, uint8_t Levels >
+template< typename Rep, typename Period >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::Timeout::restart(std::chrono::duration<Rep, Period> interval)
+{
+	if (0 <= interval.count())
+	{
+		const auto cast_interval = std::chrono::duration_cast<duration>(interval);
+		modm_assert_continue_fail_debug(interval.count() <= duration::max().count(), "tmr.size",
+				"Timer interval must be smaller than the maximal duration!", interval.count());
+
+		_start = now();
+		_interval = cast_interval;
+		if (_interval.count())
+		{
+			this->wheel.insert(*this, _interval);
+			_state = ARMED;
+		}
+		else {
+			// expires immediately without waiting for the wheel
+			this->wheel.remove(*this);
+			_state = EXPIRED;
+		}
+	}
+	else {
+		modm_assert_continue_fail_debug(false, "tmr.neg",
+			"Timer interval must be larger than zero!", interval.count());
+		stop();
+	}
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::Timeout::stop()
+{
+	this->wheel.remove(*this);
+	_state = STOPPED;
+	_interval = duration{0};
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+typename modm::GenericTimerWheel<Clock, Bits, Levels>::wide_signed_duration
+modm::GenericTimerWheel<Clock, Bits, Levels>::Timeout::remaining() const
+{
+	if (_state == STOPPED)
+		return wide_signed_duration{0};
+	return wide_signed_duration{int32_t(_start + _interval.count() - now())};
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+bool
+modm::GenericTimerWheel<Clock, Bits, Levels>::Timeout::execute()
+{
+	if (_state == EXPIRED)
+	{
+		_state = (EXPIRED | EXECUTED);
+		return true;
+	}
+	// can only be fired once!
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, uint8_t Bits, uint8_t Levels >
+std::size_t
+modm::GenericTimerWheel<Clock, Bits, Levels>::PeriodicTimer::execute()
+{
+	if (this->_state != this->EXPIRED)
+		return 0;
+	if (this->_interval.count() == 0)
+		return 1;
+
+	const std::size_t count = periods;
+	periods = 0;
+	this->_state = this->ARMED;
+	return count;
+}
+
+template< class Clock, uint8_t Bits, uint8_t Levels >
+void
+modm::GenericTimerWheel<Clock, Bits, Levels>::PeriodicTimer::expired()
+{
+	// restart counting after execute() or restart()
+	if (this->_state != this->EXPIRED) periods = 0;
+
+	// keep the period accurate by adding the interval to the old expiry
+	this->_start += this->_interval.count();
+	this->wheel.rearm(*this, this->_interval);
+	this->_state = this->EXPIRED;
+	periods++;
+}
@@ -6,7 +6,7 @@
  * Copyright (c) 2013, Hans Schily
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2015, Niclas Rohrer
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -19,11 +19,12 @@
 #ifndef MODM_GRAPHIC_DISPLAY_HPP
 #define MODM_GRAPHIC_DISPLAY_HPP
 
+#include <type_traits>
+
 #include <modm/architecture/interface/accessor.hpp>
 #include <modm/io/iodevice.hpp>
 #include <modm/io/iostream.hpp>
 #include <modm/math/geometry.hpp>
-#include <modm/math/utils/concepts.hpp>
 
 #include "font.hpp"
 
@@ -46,10 +47,12 @@ public:
 
 	// Allow arbitray arithmetic Types for Point-construction
 	// This prevents 'narrowing conversion' compiler-warnings
-	template<modm::arithmetic T, modm::arithmetic U>
+	template<typename T, typename U>
+		requires std::is_arithmetic_v<T> and std::is_arithmetic_v<U>
 	Point(T x, U y) : Vector<int16_t, 2>(x, y){};
 
-	template<modm::arithmetic T>
+	template<typename T>
+		requires std::is_arithmetic_v<T>
 	Point(Vector<T, 2> vector) : Vector<int16_t, 2>(vector){};
 };
 #else
@@ -186,7 +189,7 @@ public:
 	 *
 	 * Uses the faster drawHorizontalLine() or drawVerticalLine() if
 	 * possible, otherwise the line is rastered with the Bresenham line
-	 * algorithm.
+	 * algorithm and drawn as horizontal or vertical runs of pixels.
 	 *
 	 * \param start	first point
 	 * \param end	second point
@@ -207,6 +210,9 @@ public:
 	/**
 	 * Draw a filled rectangle.
 	 *
+	 * The rectangle is clipped to the screen and filled with
+	 * fillRectangleFast().
+	 *
 	 * \param start 	Upper left corner
 	 * \param width		Width of rectangle
 	 * \param height	Height of rectangle
@@ -287,6 +293,9 @@ public:
 	/**
 	 * Draw an image.
 	 *
+	 * The image is clipped to the screen and copied with
+	 * drawImageBytesFast() eight rows at a time.
+	 *
 	 * \param start		Upper left corner
 	 * \param width		Image width
 	 * \param height	Image height
@@ -415,6 +424,39 @@ protected:
 		pixel ? setPixelFast(pos) : clearPixelFast(pos);
 	}
 
+	/**
+	 * Set the pixels `[start.x, start.x + length)` of row `start.y`
+	 * without checking the scope.
+	 *
+	 * The default implementation calls setPixelFast() for every pixel,
+	 * displays with a RAM buffer override it to write whole bytes.
+	 */
+	virtual void
+	drawHorizontalLineFast(glcd::Point start, int16_t length);
+
+	/**
+	 * fillRectangle() without checking the scope
+	 *
+	 * The default implementation calls drawHorizontalLineFast() for every row.
+	 */
+	virtual void
+	fillRectangleFast(glcd::Point start, int16_t width, int16_t height);
+
+	/**
+	 * Copy `length` columns of image bytes to the screen without checking
+	 * the scope.
+	 *
+	 * Bit `n` of `data[i]` is the pixel `{pos.x + i, pos.y + n}`, which
+	 * is only written if bit `n` of `mask` is set. `pos.y` may be negative
+	 * as long as the masked pixels are on the screen.
+	 *
+	 * The default implementation calls setPixelFast() or clearPixelFast()
+	 * for every masked pixel.
+	 */
+	virtual void
+	drawImageBytesFast(glcd::Point pos, int16_t length, uint8_t mask,
+					   modm::accessor::Flash<uint8_t> data);
+
 	/// helper method for drawCircle() and drawEllipse()
 	void
 	drawCircle4(glcd::Point center, int16_t x, int16_t y);
@@ -3,6 +3,7 @@
  * Copyright (c) 2012-2013, Niklas Hauser
  * Copyright (c) 2013, Hans Schily
  * Copyright (c) 2013, Thorsten Lajewski
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -22,11 +23,29 @@ template<uint16_t Width, uint16_t Height>
 void
 modm::GraphicDisplay<Width, Height>::fillRectangle(glcd::Point start, int16_t width, int16_t height)
 {
-	const int16_t x_max = std::min<int16_t>(start.x + width, getWidth());
-	const int16_t y_max = std::min<int16_t>(start.y + height, getHeight());
+	const int16_t x_min = std::max<int16_t>(start.x, 0);
+	const int16_t y_min = std::max<int16_t>(start.y, 0);
+	const int16_t x_max = std::min<int32_t>(start.x + width, Width);
+	const int16_t y_max = std::min<int32_t>(start.y + height, Height);
 
-	for (int16_t x = start.x; x < x_max; x++)
-		for (int16_t y = start.y; y < y_max; y++) this->setPixel({x, y});
+	if (x_min < x_max and y_min < y_max)
+		this->fillRectangleFast({x_min, y_min}, x_max - x_min, y_max - y_min);
+}
+
+template<uint16_t Width, uint16_t Height>
+void
+modm::GraphicDisplay<Width, Height>::fillRectangleFast(glcd::Point start, int16_t width, int16_t height)
+{
+	const int16_t y_max = start.y + height;
+	for (int16_t y = start.y; y < y_max; y++) this->drawHorizontalLineFast({start.x, y}, width);
+}
+
+template<uint16_t Width, uint16_t Height>
+void
+modm::GraphicDisplay<Width, Height>::drawHorizontalLineFast(glcd::Point start, int16_t length)
+{
+	const int16_t x_max = start.x + length;
+	for (int16_t x = start.x; x < x_max; x++) this->setPixelFast({x, start.y});
 }
 
 template<uint16_t Width, uint16_t Height>
@@ -7,7 +7,7 @@
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2016, Antal Szabó
  * Copyright (c) 2017, Christopher Durand
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -21,8 +21,6 @@
 #error "Don't include this file directly, use 'graphic_display.hpp' instead!"
 #endif
 
-#include <bit>
-
 #include "font/fixed_width_5x8.hpp"
 
 using namespace std;
@@ -74,16 +72,22 @@ modm::GraphicDisplay<Width, Height>::drawLine(glcd::Point start, glcd::Point end
 		else
 			yStep = -1;
 
+		// pixels with the same y form a run, which is drawn at once
+		int16_t run = start.x;
 		for (int16_t x = start.x; x <= end.x; ++x)
 		{
-			// OPTIMIZE use setPixelFast(pos);
-			if (steep)
-				this->setPixel({y, x});
-			else
-				this->setPixel({x, y});
-
 			error = error - deltaY;
 
+			if (error < 0 or x == end.x)
+			{
+				const int16_t length = x - run + 1;
+				if (steep)
+					this->fillRectangle({y, run}, 1, length);
+				else
+					this->fillRectangle({run, y}, length, 1);
+				run = x + 1;
+			}
+
 			if (error < 0)
 			{
 				y += yStep;
@@ -97,16 +101,14 @@ template<uint16_t Width, uint16_t Height>
 void
 modm::GraphicDisplay<Width, Height>::drawHorizontalLine(glcd::Point start, int16_t length)
 {
-	const int16_t x_max = min<int16_t>(start.x + length, Width);
-	for (int16_t x = start.x; x < x_max; x++) this->setPixelFast({x, start.y});
+	this->fillRectangle(start, length, 1);
 }
 
 template<uint16_t Width, uint16_t Height>
 void
 modm::GraphicDisplay<Width, Height>::drawVerticalLine(glcd::Point start, int16_t length)
 {
-	const int16_t y_max = min<int16_t>(start.y + length, Height);
-	for (int16_t y = start.y; y < y_max; y++) this->setPixelFast({start.x, y});
+	this->fillRectangle(start, 1, length);
 }
 
 template<uint16_t Width, uint16_t Height>
@@ -271,37 +273,46 @@ modm::GraphicDisplay<Width, Height>::drawImage(glcd::Point start,
 	drawImageRaw(start, width, height, modm::accessor::Flash<uint8_t>(image.getPointer() + 2));
 }
 
-#include <modm/board.hpp>
-#include <modm/debug/logger.hpp>
-#include <modm/debug/logger/level.hpp>
-/**
- * Convertion MonochromeBuffer -> AnyBuffer
- */
 template<uint16_t Width, uint16_t Height>
 void
 modm::GraphicDisplay<Width, Height>::drawImageRaw(glcd::Point pos, uint16_t width,
 												  uint16_t height,
 												  modm::accessor::Flash<uint8_t> data)
 {
-	const glcd::Point screenMin{max<int16_t>(pos.x, 0), max<int16_t>(pos.y, 0)};
-	const glcd::Point screenMax{min<int16_t>(pos.x + width, Width - 1), min<int16_t>(pos.y + height, Height - 1)};
-	const glcd::Point dataMin{pos.x < 0 ? -pos.x : 0, pos.y < 0 ? -pos.y : 0};
+	const int16_t x_min = max<int16_t>(pos.x, 0);
+	const int16_t x_max = min<int32_t>(pos.x + width, Width);
+	if (x_min >= x_max) return;
+
+	// every byte of the image data holds eight rows of a column
+	for (uint16_t row = 0; row < height; row += 8)
+	{
+		const int16_t y = pos.y + row;
+		if (y >= int16_t(Height)) break;
+		if (y + 8 <= 0) continue;
+
+		uint8_t mask = 0xff;
+		if (height - row < 8) mask >>= 8 - (height - row);
+		if (y < 0) mask &= 0xff << -y;
+		if (y + 8 > int16_t(Height)) mask &= 0xff >> (y + 8 - Height);
 
-	size_t i_start = dataMin.x + (dataMin.y / 8) * width;
-	const uint8_t j_start = std::rotl(Bit0, dataMin.y % 8);
+		this->drawImageBytesFast({x_min, y}, x_max - x_min, mask,
+				modm::accessor::Flash<uint8_t>(data.getPointer() + (row / 8) * width + (x_min - pos.x)));
+	}
+}
 
-	for (int16_t x = screenMin.x; x < screenMax.x; x++)
+template<uint16_t Width, uint16_t Height>
+void
+modm::GraphicDisplay<Width, Height>::drawImageBytesFast(glcd::Point pos, int16_t length,
+														uint8_t mask,
+														modm::accessor::Flash<uint8_t> data)
+{
+	for (int16_t i = 0; i < length; i++)
 	{
-		uint8_t i = i_start++;
-		uint8_t j = j_start;
-		for (int16_t y = screenMin.y; y < screenMax.y; y++)
+		const uint8_t byte = data[i];
+		for (uint8_t bit = 0; bit < 8; bit++)
 		{
-			// TODO get the actual pixel from callback or generator so this
-			// nested loop can do any squary action, like drawing filled rect / clearing screen
-			this->setPixelFast({x, y}, data[i] & j);
-			j = std::rotl(j, 1);
-			// OPTIMIZE handle ovf-carry of `std::rotl` instead of `if (j == Bit0)`
-			if (j == Bit0) i += width;
+			if (mask & (1 << bit))
+				this->setPixelFast({int16_t(pos.x + i), int16_t(pos.y + bit)}, byte & (1 << bit));
 		}
 	}
 }
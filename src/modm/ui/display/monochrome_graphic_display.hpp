@@ -4,7 +4,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2011, Thorsten Lajewski
  * Copyright (c) 2012-2015, Niklas Hauser
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -17,6 +17,7 @@
 #define MODM_MONOCHROME_GRAPHIC_DISPLAY_HPP
 
 #include <stdlib.h>
+#include <type_traits>
 
 #include "graphic_display.hpp"
 
@@ -28,6 +29,11 @@ namespace modm
  * Every operation works on the internal RAM buffer, therefore the content
  * of the real display is not changed until a call of update().
  *
+ * For every row of the buffer the range of modified columns is tracked, so
+ * that update() only needs to transfer the modified part of the buffer.
+ * Everything written directly into the buffer must be marked with
+ * markDirty().
+ *
  * \tparam	Width			Horizontal number of Pixels
  * \tparam	Height			Vertical number of Pixels
  * \tparam	BufferWidth		Horizontal (first) dimension of Buffer
@@ -43,6 +49,29 @@ class MonochromeGraphicDisplay : public GraphicDisplay<Width, Height>
 	static_assert(Height > 0, "height must be greater than 0");
 
 public:
+	/// Range of modified columns `[begin, end)` in a row of the buffer
+	struct DirtyRange
+	{
+		using Index = std::conditional_t<(BufferWidth < 256), uint8_t, uint16_t>;
+
+		Index begin;
+		Index end;
+
+		bool
+		isEmpty() const
+		{ return begin >= end; }
+
+		std::size_t
+		size() const
+		{ return isEmpty() ? 0 : end - begin; }
+	};
+
+public:
+	MonochromeGraphicDisplay()
+	{
+		markDirty();
+	}
+
 	virtual ~MonochromeGraphicDisplay() = default;
 
 	inline std::size_t
@@ -68,8 +97,40 @@ public:
 	void
 	clear() final;
 
+	/// Mark the whole buffer as modified, so that the next update() transfers all of it
+	void
+	markDirty();
+
+	/// @return	`true` if the buffer was modified since the last update()
+	bool
+	isDirty() const;
+
 protected:
+	/// Mark the columns `[begin, end)` of a buffer row as modified
+	void
+	markDirty(std::size_t row, std::size_t begin, std::size_t end)
+	{
+		using Index = typename DirtyRange::Index;
+		DirtyRange &range = dirty[row];
+		if (begin < range.begin) range.begin = Index(begin);
+		if (end > range.end) range.end = Index(end);
+	}
+
+	/// Returns the modified range of a buffer row and marks the row as unmodified
+	DirtyRange
+	takeDirty(std::size_t row)
+	{
+		const DirtyRange range = dirty[row];
+		dirty[row] = {BufferWidth, 0};
+		return range;
+	}
+
+	/// @return	the number of modified bytes in the buffer
+	std::size_t
+	getDirtySize() const;
+
 	uint8_t buffer[BufferHeight][BufferWidth];
+	DirtyRange dirty[BufferHeight];
 
 	virtual bool
 	getPixelFast(glcd::Point pos) const = 0;
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019, Fabian Greif
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -50,6 +51,10 @@ protected:
 
 	bool
 	getPixelFast(glcd::Point pos) const final;
+
+	// Faster version adapted for the RAM buffer, fills whole bytes
+	void
+	drawHorizontalLineFast(glcd::Point start, int16_t length) final;
 };
 }  // namespace modm
 
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019, Fabian Greif
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -12,26 +13,55 @@
 #error "Don't include this file directly, use 'monochrome_graphic_display_horizontal.hpp' instead!"
 #endif
 
+#include <algorithm>
+
 namespace modm
 {
 template<uint16_t Width, uint16_t Height>
 void
 MonochromeGraphicDisplayHorizontal<Width, Height>::setPixelFast(glcd::Point pos)
 {
-	this->buffer[pos.x / 8][pos.y] |= (1 << (pos.x % 8));
+	this->buffer[pos.y][pos.x / 8] |= (1 << (pos.x % 8));
+	this->markDirty(pos.y, pos.x / 8, pos.x / 8 + 1);
 }
 
 template<uint16_t Width, uint16_t Height>
 void
 MonochromeGraphicDisplayHorizontal<Width, Height>::clearPixelFast(glcd::Point pos)
 {
-	this->buffer[pos.x / 8][pos.y] &= ~(1 << (pos.x % 8));
+	this->buffer[pos.y][pos.x / 8] &= ~(1 << (pos.x % 8));
+	this->markDirty(pos.y, pos.x / 8, pos.x / 8 + 1);
 }
 
 template<uint16_t Width, uint16_t Height>
 bool
 MonochromeGraphicDisplayHorizontal<Width, Height>::getPixelFast(glcd::Point pos) const
 {
-	return (this->buffer[pos.x / 8][y] & (1 << (pos.x % 8)));
+	return (this->buffer[pos.y][pos.x / 8] & (1 << (pos.x % 8)));
+}
+
+template<uint16_t Width, uint16_t Height>
+void
+MonochromeGraphicDisplayHorizontal<Width, Height>::drawHorizontalLineFast(glcd::Point start,
+																		  int16_t length)
+{
+	const size_t xb_min = start.x / 8;
+	const size_t xb_max = (start.x + length - 1) / 8;
+
+	// mask out the columns left and right of the line
+	const uint8_t byte_min = 0xFF << (start.x % 8);
+	const uint8_t byte_max = 0xFF >> (7 - (start.x + length - 1) % 8);
+
+	uint8_t *const row = this->buffer[start.y];
+	if (xb_min == xb_max)
+	{
+		row[xb_min] |= byte_min & byte_max;
+	} else
+	{
+		row[xb_min] |= byte_min;
+		std::fill(row + xb_min + 1, row + xb_max, 0xFF);
+		row[xb_max] |= byte_max;
+	}
+	this->markDirty(start.y, xb_min, xb_max + 1);
 }
 }  // namespace modm
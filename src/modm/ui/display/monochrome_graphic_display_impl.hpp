@@ -3,7 +3,7 @@
  * Copyright (c) 2011, Martin Rosekeit
  * Copyright (c) 2012-2013, Niklas Hauser
  * Copyright (c) 2016, Antal Szabó
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -23,5 +23,30 @@ void
 modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::clear()
 {
 	std::fill(&buffer[0][0], &buffer[0][0] + sizeof(buffer), 0);
+	markDirty();
 	this->cursor = {0, 0};
+}
+
+template<uint16_t Width, uint16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+void
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::markDirty()
+{
+	std::fill(dirty, dirty + BufferHeight, DirtyRange{0, BufferWidth});
+}
+
+template<uint16_t Width, uint16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+bool
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::isDirty() const
+{
+	return std::any_of(dirty, dirty + BufferHeight,
+					   [](const DirtyRange &range) { return not range.isEmpty(); });
+}
+
+template<uint16_t Width, uint16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+std::size_t
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::getDirtySize() const
+{
+	std::size_t size = 0;
+	for (const DirtyRange &range : dirty) size += range.size();
+	return size;
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2011, Thorsten Lajewski
  * Copyright (c) 2012-2015, Niklas Hauser
- * Copyright (c) 2021, Thomas Sommer
+ * Copyright (c) 2021, 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -43,11 +43,6 @@ class MonochromeGraphicDisplayVertical
 public:
 	virtual ~MonochromeGraphicDisplayVertical() = default;
 
-	// Faster version adapted for the RAM buffer
-	void
-	drawImageRaw(glcd::Point pos, uint16_t width, uint16_t height,
-				 modm::accessor::Flash<uint8_t> data) final;
-
 protected:
 	void
 	setPixelFast(glcd::Point pos) final;
@@ -60,11 +55,16 @@ protected:
 
 	// Faster version adapted for the RAM buffer
 	void
-	drawHorizontalLine(glcd::Point start, int16_t length) final;
+	drawHorizontalLineFast(glcd::Point start, int16_t length) final;
 
-	// Faster version adapted for the RAM buffer
+	// Faster version adapted for the RAM buffer, fills whole bytes per page
+	void
+	fillRectangleFast(glcd::Point start, int16_t width, int16_t height) final;
+
+	// Faster version adapted for the RAM buffer, the bytes are only shifted
 	void
-	drawVerticalLine(glcd::Point start, int16_t length) final;
+	drawImageBytesFast(glcd::Point pos, int16_t length, uint8_t mask,
+					   modm::accessor::Flash<uint8_t> data) final;
 };
 }  // namespace modm
 
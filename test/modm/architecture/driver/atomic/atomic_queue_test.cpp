@@ -51,3 +51,73 @@ AtomicQueueTest::testQueue()
 
 	TEST_ASSERT_TRUE(queue.isEmpty());
 }
+
+void
+AtomicQueueTest::testBulk()
+{
+	modm::atomic::Queue<uint8_t, 7> queue;
+
+	const uint8_t input[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	uint8_t output[10] = {};
+
+	TEST_ASSERT_EQUALS(queue.push(input, 5), 5U);
+	TEST_ASSERT_EQUALS(queue.getSize(), 5);
+	TEST_ASSERT_EQUALS(queue.pop(output, 4), 4U);
+	TEST_ASSERT_EQUALS_ARRAY(output, input, 4);
+
+	// wraps around the end of the buffer
+	TEST_ASSERT_EQUALS(queue.push(input + 5, 5), 5U);
+	TEST_ASSERT_EQUALS(queue.getSize(), 6);
+	TEST_ASSERT_EQUALS(queue.push(input, 5), 1U);
+	TEST_ASSERT_TRUE(queue.isFull());
+
+	TEST_ASSERT_EQUALS(queue.pop(output, 10), 7U);
+	TEST_ASSERT_EQUALS_ARRAY(output, input + 4, 6);
+	TEST_ASSERT_EQUALS(output[6], 0);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.pop(output, 10), 0U);
+}
+
+void
+AtomicQueueTest::testClaimCommit()
+{
+	modm::atomic::Queue<uint8_t, 7> queue;
+
+	uint8_t* write;
+	const uint8_t* read;
+
+	TEST_ASSERT_EQUALS(queue.claimWrite(write), 7);
+	TEST_ASSERT_EQUALS(queue.claimRead(read), 0);
+
+	write[0] = 10; write[1] = 11; write[2] = 12;
+	queue.commitWrite(3);
+	TEST_ASSERT_EQUALS(queue.getSize(), 3);
+	TEST_ASSERT_EQUALS(queue.get(), 10);
+
+	TEST_ASSERT_EQUALS(queue.claimRead(read), 3);
+	TEST_ASSERT_EQUALS(read[2], 12);
+	queue.commitRead(2);
+	TEST_ASSERT_EQUALS(queue.get(), 12);
+
+	// block until the end of the buffer
+	TEST_ASSERT_EQUALS(queue.claimWrite(write), 5);
+	for (uint8_t ii = 0; ii < 5; ++ii) write[ii] = 20 + ii;
+	queue.commitWrite(5);
+
+	// wrapped block until the tail
+	TEST_ASSERT_EQUALS(queue.claimWrite(write), 1);
+	write[0] = 30;
+	queue.commitWrite(1);
+	TEST_ASSERT_TRUE(queue.isFull());
+	TEST_ASSERT_EQUALS(queue.claimWrite(write), 0);
+
+	TEST_ASSERT_EQUALS(queue.claimRead(read), 6);
+	TEST_ASSERT_EQUALS(read[0], 12);
+	TEST_ASSERT_EQUALS(read[5], 24);
+	queue.commitRead(6);
+
+	TEST_ASSERT_EQUALS(queue.claimRead(read), 1);
+	TEST_ASSERT_EQUALS(read[0], 30);
+	queue.commitRead(1);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
@@ -19,4 +19,10 @@ class AtomicQueueTest : public unittest::TestSuite
 public:
 	void
 	testQueue();
+
+	void
+	testBulk();
+
+	void
+	testClaimCommit();
 };
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <thread>
+#include <vector>
+#include <modm/architecture/driver/atomic/spsc_queue.hpp>
+#include <modm/architecture/driver/atomic/mpsc_queue.hpp>
+
+#include "lockfree_queue_stress_test.hpp"
+
+namespace
+{
+constexpr uint32_t Iterations = 200'000;
+constexpr uint32_t Producers = 4;
+}
+
+void
+LockFreeQueueStressTest::testSpscQueueThreaded()
+{
+	static modm::atomic::SpscQueue<uint32_t, 64> queue;
+
+	std::thread producer([]
+	{
+		for (uint32_t ii = 0; ii < Iterations; ++ii) {
+			while (not queue.push(ii)) std::this_thread::yield();
+		}
+	});
+
+	// values must arrive complete and in order
+	uint32_t expected = 0;
+	uint32_t errors = 0;
+	while (expected < Iterations)
+	{
+		uint32_t value;
+		if (queue.pop(value)) {
+			if (value != expected) errors++;
+			expected++;
+		}
+		else std::this_thread::yield();
+	}
+	producer.join();
+
+	TEST_ASSERT_EQUALS(errors, 0U);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+LockFreeQueueStressTest::testSpscQueueBulkThreaded()
+{
+	static modm::atomic::SpscQueue<uint8_t, 256> queue;
+
+	std::thread producer([]
+	{
+		uint8_t data[37];
+		uint32_t sent = 0;
+		while (sent < Iterations)
+		{
+			const std::size_t size = std::min<std::size_t>(sizeof(data), Iterations - sent);
+			for (std::size_t ii = 0; ii < size; ++ii) data[ii] = uint8_t(sent + ii);
+			std::span<const uint8_t> pending{data, size};
+			while (not pending.empty()) {
+				pending = pending.subspan(queue.push(pending));
+			}
+			sent += size;
+		}
+	});
+
+	uint8_t data[23];
+	uint32_t received = 0;
+	uint32_t errors = 0;
+	while (received < Iterations)
+	{
+		const std::size_t size = queue.pop(data);
+		if (size == 0) std::this_thread::yield();
+		for (std::size_t ii = 0; ii < size; ++ii) {
+			if (data[ii] != uint8_t(received++)) errors++;
+		}
+	}
+	producer.join();
+
+	TEST_ASSERT_EQUALS(errors, 0U);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+LockFreeQueueStressTest::testMpscQueueThreaded()
+{
+	static modm::atomic::MpscQueue<uint32_t, 128> queue;
+
+	std::vector<std::thread> producers;
+	for (uint32_t id = 0; id < Producers; ++id)
+	{
+		producers.emplace_back([id]
+		{
+			// encode the producer in the top bits
+			for (uint32_t ii = 0; ii < Iterations / Producers; ++ii) {
+				while (not queue.push((id << 24) | ii)) std::this_thread::yield();
+			}
+		});
+	}
+
+	// values of each producer must arrive in order
+	uint32_t expected[Producers] = {};
+	uint32_t received = 0;
+	uint32_t errors = 0;
+	while (received < (Iterations / Producers) * Producers)
+	{
+		uint32_t value;
+		if (queue.pop(value))
+		{
+			const uint32_t id = value >> 24;
+			if (id >= Producers or (value & 0xffffff) != expected[id]++) errors++;
+			received++;
+		}
+		else std::this_thread::yield();
+	}
+	for (auto& producer : producers) producer.join();
+
+	TEST_ASSERT_EQUALS(errors, 0U);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/driver/atomic/spsc_queue.hpp>
+#include <modm/architecture/driver/atomic/mpsc_queue.hpp>
+
+#include "lockfree_queue_test.hpp"
+
+void
+LockFreeQueueTest::testSpscQueue()
+{
+	modm::atomic::SpscQueue<int16_t, 4> queue;
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getMaxSize(), 4U);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+
+	TEST_ASSERT_TRUE(queue.push(1));
+	TEST_ASSERT_TRUE(queue.push(2));
+	TEST_ASSERT_TRUE(queue.push(3));
+	TEST_ASSERT_TRUE(queue.push(4));
+
+	TEST_ASSERT_FALSE(queue.push(5));
+	TEST_ASSERT_TRUE(queue.isFull());
+	TEST_ASSERT_EQUALS(queue.getSize(), 4U);
+
+	TEST_ASSERT_EQUALS(queue.get(), 1);
+	queue.pop();
+
+	int16_t value;
+	TEST_ASSERT_TRUE(queue.pop(value));
+	TEST_ASSERT_EQUALS(value, 2);
+
+	TEST_ASSERT_TRUE(queue.push(5));
+	TEST_ASSERT_TRUE(queue.push(6));
+	TEST_ASSERT_TRUE(queue.isFull());
+
+	for (int16_t expected = 3; expected <= 6; ++expected)
+	{
+		TEST_ASSERT_TRUE(queue.isNotEmpty());
+		TEST_ASSERT_EQUALS(queue.get(), expected);
+		queue.pop();
+	}
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_FALSE(queue.pop(value));
+}
+
+void
+LockFreeQueueTest::testSpscQueueBulk()
+{
+	modm::atomic::SpscQueue<uint8_t, 8> queue;
+
+	const uint8_t input[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	uint8_t output[10] = {};
+
+	TEST_ASSERT_EQUALS(queue.push(std::span{input, 5}), 5U);
+	TEST_ASSERT_EQUALS(queue.getSize(), 5U);
+	// only three more fit
+	TEST_ASSERT_EQUALS(queue.push(std::span{input + 5, 5}), 3U);
+	TEST_ASSERT_TRUE(queue.isFull());
+
+	TEST_ASSERT_EQUALS(queue.pop(std::span{output, 3}), 3U);
+	TEST_ASSERT_EQUALS_ARRAY(output, input, 3);
+
+	TEST_ASSERT_EQUALS(queue.pop(output), 5U);
+	TEST_ASSERT_EQUALS_ARRAY(output, input + 3, 5);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.pop(output), 0U);
+}
+
+void
+LockFreeQueueTest::testSpscQueueWrapAround()
+{
+	// the 8-bit indices overflow many times during this test
+	modm::atomic::SpscQueue<uint16_t, 128> queue;
+
+	uint16_t expected = 0;
+	for (uint16_t ii = 0; ii < 1000; ++ii)
+	{
+		TEST_ASSERT_TRUE(queue.push(ii));
+		if (queue.getSize() > 100)
+		{
+			TEST_ASSERT_EQUALS(queue.get(), expected++);
+			queue.pop();
+		}
+	}
+	TEST_ASSERT_EQUALS(queue.getSize(), 1000U - expected);
+	while (queue.isNotEmpty())
+	{
+		TEST_ASSERT_EQUALS(queue.get(), expected++);
+		queue.pop();
+	}
+	TEST_ASSERT_EQUALS(expected, 1000U);
+}
+
+void
+LockFreeQueueTest::testMpscQueue()
+{
+	modm::atomic::MpscQueue<int16_t, 4> queue;
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getMaxSize(), 4U);
+
+	TEST_ASSERT_TRUE(queue.push(1));
+	TEST_ASSERT_TRUE(queue.push(2));
+	TEST_ASSERT_TRUE(queue.push(3));
+	TEST_ASSERT_TRUE(queue.push(4));
+
+	TEST_ASSERT_FALSE(queue.push(5));
+	TEST_ASSERT_TRUE(queue.isFull());
+
+	TEST_ASSERT_EQUALS(queue.get(), 1);
+	queue.pop();
+	TEST_ASSERT_TRUE(queue.isNotFull());
+
+	TEST_ASSERT_TRUE(queue.push(5));
+	TEST_ASSERT_FALSE(queue.push(6));
+
+	for (int16_t expected = 2; expected <= 5; ++expected)
+	{
+		int16_t value;
+		TEST_ASSERT_TRUE(queue.pop(value));
+		TEST_ASSERT_EQUALS(value, expected);
+	}
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+}
+
+void
+LockFreeQueueTest::testMpscQueueBulk()
+{
+	modm::atomic::MpscQueue<uint8_t, 8> queue;
+
+	const uint8_t input[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	uint8_t output[10] = {};
+
+	TEST_ASSERT_EQUALS(queue.push(input), 8U);
+	TEST_ASSERT_EQUALS(queue.pop(std::span{output, 6}), 6U);
+	TEST_ASSERT_EQUALS(queue.push(std::span{input + 8, 2}), 2U);
+	TEST_ASSERT_EQUALS(queue.pop(std::span{output + 6, 4}), 4U);
+	TEST_ASSERT_EQUALS_ARRAY(output, input, 10);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2016, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -11,6 +12,8 @@
 
 #include "can_message_test.hpp"
 
+#include <algorithm>
+
 void
 CanMessageTest::testEqualOperator()
 {
@@ -64,3 +67,70 @@ CanMessageTest::testConstructor()
 	TEST_ASSERT_EQUALS(msgB.getLength(), 1);
 	TEST_ASSERT_TRUE(msgB.isExtended());
 }
+
+void
+CanMessageTest::testDataLengthCode()
+{
+	using modm::can::Message;
+	for (uint8_t dlc = 0; dlc <= 8; ++dlc) {
+		TEST_ASSERT_EQUALS(Message::dlcToLength(dlc), dlc);
+	}
+	TEST_ASSERT_EQUALS(Message::dlcToLength(9), 12);
+	TEST_ASSERT_EQUALS(Message::dlcToLength(13), 32);
+	TEST_ASSERT_EQUALS(Message::dlcToLength(15), 64);
+
+	// every length maps to the smallest code that can hold it
+	for (uint8_t length = 0; length <= 64; ++length)
+	{
+		const uint8_t dlc = Message::lengthToDlc(length);
+		TEST_ASSERT_TRUE(Message::dlcToLength(dlc) >= length);
+		if (dlc > 0) {
+			TEST_ASSERT_TRUE(Message::dlcToLength(dlc - 1) < length);
+		}
+	}
+}
+
+void
+CanMessageTest::testFlexibleData()
+{
+	modm::can::Message msgA(0x12, 8);
+	TEST_ASSERT_FALSE(msgA.isFlexibleData());
+	TEST_ASSERT_EQUALS(msgA.getDataLengthCode(), 8);
+
+	if constexpr (modm::can::Message::capacity > 8)
+	{
+		// lengths above 8 switch to CAN FD and are padded
+		modm::can::Message msgB(0x12);
+		std::fill(msgB.data, msgB.data + 64, 0xaa);
+		msgB.setLength(10);
+		TEST_ASSERT_TRUE(msgB.isFlexibleData());
+		TEST_ASSERT_EQUALS(msgB.getLength(), 12);
+		TEST_ASSERT_EQUALS(msgB.getDataLengthCode(), 9);
+		TEST_ASSERT_EQUALS(msgB.data[9], 0xaa);
+		TEST_ASSERT_EQUALS(msgB.data[10], 0);
+		TEST_ASSERT_EQUALS(msgB.data[11], 0);
+
+		msgB.setDataLengthCode(15);
+		TEST_ASSERT_EQUALS(msgB.getLength(), 64);
+		msgB.setLength(200);
+		TEST_ASSERT_EQUALS(msgB.getLength(), 64);
+
+		// the frame format is part of the message
+		modm::can::Message msgC(0x12, 4);
+		modm::can::Message msgD(0x12, 4);
+		std::fill(msgC.data, msgC.data + 4, 0x55);
+		std::fill(msgD.data, msgD.data + 4, 0x55);
+		msgD.setFlexibleData();
+		msgD.setBitRateSwitching();
+		TEST_ASSERT_TRUE(msgD.isBitRateSwitching());
+		TEST_ASSERT_FALSE(msgC == msgD);
+		msgC.setFlexibleData();
+		TEST_ASSERT_TRUE(msgC == msgD);
+	}
+	else
+	{
+		msgA.setLength(10);
+		TEST_ASSERT_EQUALS(msgA.getLength(), 8);
+		TEST_ASSERT_FALSE(msgA.isFlexibleData());
+	}
+}
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, 2015, Niklas Hauser
  * Copyright (c) 2016-2020, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -27,6 +28,12 @@ public:
 
 	void
 	testConstructor();
+
+	void
+	testDataLengthCode();
+
+	void
+	testFlexibleData();
 };
 
 #endif // MODM_UNITTEST_CAN_MESSAGE_HPP
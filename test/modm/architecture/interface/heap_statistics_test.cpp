@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/detect.hpp>
+#include <modm/architecture/interface/heap_statistics.hpp>
+
+#include "heap_statistics_test.hpp"
+
+namespace
+{
+	modm::HeapTraceRecord records[8];
+	std::size_t recordCount;
+
+	void
+	recordTrace(const modm::HeapTraceRecord &record)
+	{
+		if (recordCount < 8) {
+			records[recordCount] = record;
+		}
+		recordCount++;
+	}
+
+	const void *const caller = reinterpret_cast<const void *>(0x08001234);
+}
+
+void
+HeapStatisticsTest::testSizeClass()
+{
+	using modm::HeapStatistics;
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(0), 0);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(8), 0);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(9), 1);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(16), 1);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(17), 2);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(512), 6);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(513), 7);
+	TEST_ASSERT_EQUALS(HeapStatistics::getSizeClass(100000), 7);
+}
+
+void
+HeapStatisticsTest::testUsage()
+{
+	modm::HeapTracker tracker{};
+	int a, b;
+
+	tracker.allocated(&a, 10, 12, caller);
+	tracker.allocated(&b, 600, 604, caller);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().usedSize, 616U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().peakSize, 616U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().allocations, 2U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().histogram[1], 1U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().histogram[7], 1U);
+
+	tracker.freed(&b, 604, caller);
+	tracker.failed(1000, caller);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().usedSize, 12U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().peakSize, 616U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().frees, 1U);
+	TEST_ASSERT_EQUALS(tracker.getStatistics().failures, 1U);
+	// failures are not part of the histogram
+	TEST_ASSERT_EQUALS(tracker.getStatistics().histogram[7], 1U);
+}
+
+void
+HeapStatisticsTest::testReset()
+{
+	modm::HeapTracker tracker{};
+	int a, b;
+
+	tracker.allocated(&a, 20, 24, caller);
+	tracker.allocated(&b, 40, 44, caller);
+	tracker.freed(&b, 44, caller);
+	tracker.reset();
+
+	const modm::HeapStatistics &statistics = tracker.getStatistics();
+	TEST_ASSERT_EQUALS(statistics.usedSize, 24U);
+	TEST_ASSERT_EQUALS(statistics.peakSize, 24U);
+	TEST_ASSERT_EQUALS(statistics.allocations, 0U);
+	TEST_ASSERT_EQUALS(statistics.frees, 0U);
+	TEST_ASSERT_EQUALS(statistics.histogram[2], 0U);
+
+	// the allocation from before the reset can still be freed
+	tracker.freed(&a, 24, caller);
+	TEST_ASSERT_EQUALS(statistics.usedSize, 0U);
+	TEST_ASSERT_EQUALS(statistics.peakSize, 24U);
+}
+
+void
+HeapStatisticsTest::testTrace()
+{
+	TEST_ASSERT_EQUALS(sizeof(modm::HeapTraceRecord), 13U);
+
+	modm::HeapTracker tracker{};
+	int a;
+	recordCount = 0;
+
+	// no handler, nothing is traced
+	tracker.allocated(&a, 4, 8, caller);
+	TEST_ASSERT_EQUALS(recordCount, 0U);
+
+	tracker.setTraceHandler(recordTrace);
+	tracker.freed(&a, 8, caller);
+	tracker.failed(100, caller);
+	TEST_ASSERT_EQUALS(recordCount, 2U);
+
+	TEST_ASSERT_TRUE(records[0].type == modm::HeapTraceRecord::Type::Free);
+	TEST_ASSERT_EQUALS(records[0].address, uint32_t(uintptr_t(&a)));
+	TEST_ASSERT_EQUALS(records[0].size, 8U);
+	TEST_ASSERT_EQUALS(records[0].caller, 0x08001234U);
+
+	TEST_ASSERT_TRUE(records[1].type == modm::HeapTraceRecord::Type::Failure);
+	TEST_ASSERT_EQUALS(records[1].address, 0U);
+	TEST_ASSERT_EQUALS(records[1].size, 100U);
+
+	tracker.setTraceHandler(nullptr);
+	tracker.allocated(&a, 4, 8, caller);
+	TEST_ASSERT_EQUALS(recordCount, 2U);
+}
+
+void
+HeapStatisticsTest::testDefaultHeap()
+{
+	// must link on every target, with or without a tracking heap
+	modm::resetHeapStatistics();
+	modm::setHeapTraceHandler(recordTrace);
+	const modm::HeapStatistics statistics = modm::getHeapStatistics();
+	modm::setHeapTraceHandler(nullptr);
+
+#ifdef MODM_OS_HOSTED
+	// the hosted heap does not track its usage
+	TEST_ASSERT_EQUALS(statistics.totalSize, 0U);
+	TEST_ASSERT_EQUALS(statistics.usedSize, 0U);
+	TEST_ASSERT_EQUALS(statistics.peakSize, 0U);
+	TEST_ASSERT_EQUALS(statistics.allocations, 0U);
+	TEST_ASSERT_EQUALS(statistics.histogram[0], 0U);
+#else
+	TEST_ASSERT_TRUE(statistics.usedSize <= statistics.totalSize);
+#endif
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_UNITTEST_HEAP_STATISTICS_HPP
+#define MODM_UNITTEST_HEAP_STATISTICS_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_architecture
+class HeapStatisticsTest : public unittest::TestSuite
+{
+public:
+	void
+	testSizeClass();
+
+	void
+	testUsage();
+
+	void
+	testReset();
+
+	void
+	testTrace();
+
+	void
+	testDefaultHeap();
+};
+
+#endif	// MODM_UNITTEST_HEAP_STATISTICS_HPP
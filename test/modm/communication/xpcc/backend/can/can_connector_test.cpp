@@ -2,6 +2,7 @@
  * Copyright (c) 2010, Fabian Greif
  * Copyright (c) 2012-2013, Niklas Hauser
  * Copyright (c) 2016, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -13,6 +14,10 @@
 
 #include "can_connector_test.hpp"
 
+#include <modm-test/mock/clock.hpp>
+
+using namespace std::chrono_literals;
+
 // ----------------------------------------------------------------------------
 void
 CanConnectorTest::checkShortMessage(const modm::can::Message& message) const
@@ -136,9 +141,9 @@ CanConnectorTest::testSendFragmentedMessage()
 	// fragmented messages aren't send directly but queued immediately
 	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
 
-	// with two send slots two message should be send
+	// with two send slots two message should be send in one update
 	connector->update();
-	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 1U);
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 2U);
 	connector->update();
 	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 2U);
 
@@ -257,3 +262,281 @@ CanConnectorTest::testReceiveFragmentedMessage()
 
 	TEST_ASSERT_FALSE(connector->isPacketAvailable());
 }
+
+void
+CanConnectorTest::testSendFlexibleData()
+{
+	if constexpr (modm::can::Message::capacity <= 8) {
+		return;
+	}
+	TestingCanConnector fdConnector(driver, true);
+
+	driver->sendSlots = 1;
+	fdConnector.messageCounter = 0x30;
+
+	// the complete payload is sent directly in one CAN FD frame
+	modm::SmartPointer payload(&fragmentedPayload);
+	fdConnector.sendPacket(xpccHeader, payload);
+
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 1U);
+	const modm::can::Message& message = driver->sendList.getFront();
+	TEST_ASSERT_EQUALS(message.identifier, fragmentedIdentifier);
+	TEST_ASSERT_TRUE(message.isFlexibleData());
+	// 14 bytes + 2 byte header padded to 16 bytes
+	TEST_ASSERT_EQUALS(message.length, 16U);
+	TEST_ASSERT_EQUALS(message.data[0], 0x30);
+	TEST_ASSERT_EQUALS(message.data[1], sizeof(fragmentedPayload));
+	TEST_ASSERT_EQUALS_ARRAY(&message.data[2], fragmentedPayload, sizeof(fragmentedPayload));
+	TEST_ASSERT_EQUALS(fdConnector.messageCounter, 0x40);
+	driver->sendList.removeFront();
+
+	// queued if the driver is busy
+	fdConnector.sendPacket(xpccHeader, payload);
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
+
+	driver->sendSlots = 1;
+	fdConnector.update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 1U);
+	TEST_ASSERT_EQUALS(driver->sendList.getFront().data[0], 0x40);
+	TEST_ASSERT_EQUALS(driver->sendList.getFront().length, 16U);
+
+	// short messages are not affected
+	driver->sendSlots = 1;
+	fdConnector.sendPacket(xpccHeader, modm::SmartPointer(&shortPayload));
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 2U);
+	TEST_ASSERT_FALSE(driver->sendList.getBack().isFlexibleData());
+	checkShortMessage(driver->sendList.getBack());
+}
+
+void
+CanConnectorTest::testReceiveFlexibleData()
+{
+	if constexpr (modm::can::Message::capacity <= 8) {
+		return;
+	}
+	// the receiver does not need to enable CAN FD
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+
+	modm::can::Message message(fragmentedIdentifier, sizeof(fragmentedPayload) + 2);
+	message.data[0] = 0x70;
+	message.data[1] = sizeof(fragmentedPayload);
+	memcpy(&message.data[2], fragmentedPayload, sizeof(fragmentedPayload));
+	TEST_ASSERT_TRUE(message.isFlexibleData());
+	driver->receiveList.append(message);
+
+	connector->update();
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+
+	TEST_ASSERT_EQUALS(connector->getPacketHeader(), xpccHeader);
+	TEST_ASSERT_EQUALS(connector->getPacketPayload().getSize(), sizeof(fragmentedPayload));
+	TEST_ASSERT_EQUALS_ARRAY(
+			connector->getPacketPayload().getPointer(),
+			fragmentedPayload,
+			sizeof(fragmentedPayload));
+	connector->dropPacket();
+
+	// message size does not fit into the frame
+	message.data[1] = 15;
+	driver->receiveList.append(message);
+	// not the first fragment
+	message.data[0] = 0x71;
+	message.data[1] = sizeof(fragmentedPayload);
+	driver->receiveList.append(message);
+
+	connector->update();
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+}
+
+void
+CanConnectorTest::testSendInterleaved()
+{
+	this->messageCounter = connector->messageCounter = 0x30;
+
+	modm::SmartPointer payload(&fragmentedPayload);
+	connector->sendPacket(xpccHeader, payload);
+	connector->sendPacket(xpccHeader, payload);
+	// short message queued behind two fragmented messages
+	connector->sendPacket(xpccHeader, modm::SmartPointer(&shortPayload));
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
+
+	// counters are assigned when queuing
+	TEST_ASSERT_EQUALS(connector->messageCounter, 0x50);
+
+	// one frame of every message in turn
+	driver->sendSlots = 3;
+	connector->update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 3U);
+	checkFragmentedMessage(driver->sendList.getFront(), 0);
+	driver->sendList.removeFront();
+	this->messageCounter = 0x40;
+	checkFragmentedMessage(driver->sendList.getFront(), 0);
+	driver->sendList.removeFront();
+	checkShortMessage(driver->sendList.getFront());
+	driver->sendList.removeFront();
+
+	// remaining fragments alternate between both messages
+	driver->sendSlots = 10;
+	connector->update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 4U);
+	TEST_ASSERT_EQUALS(driver->sendSlots, 6U);
+	for (uint8_t fragment = 1; fragment < 3; ++fragment)
+	{
+		this->messageCounter = 0x30;
+		checkFragmentedMessage(driver->sendList.getFront(), fragment);
+		driver->sendList.removeFront();
+		this->messageCounter = 0x40;
+		checkFragmentedMessage(driver->sendList.getFront(), fragment);
+		driver->sendList.removeFront();
+	}
+}
+
+void
+CanConnectorTest::testSendInterleavedLimit()
+{
+	this->messageCounter = connector->messageCounter = 0x00;
+
+	modm::SmartPointer payload(&fragmentedPayload);
+	for (uint8_t ii = 0; ii <= xpcc::CanConnectorBase::maxInterleavedMessages; ++ii) {
+		connector->sendPacket(xpccHeader, payload);
+	}
+
+	// the last message waits until one of the others is sent completely
+	driver->sendSlots = 3 * xpcc::CanConnectorBase::maxInterleavedMessages;
+	connector->update();
+	uint8_t counters = 0;
+	for (const modm::can::Message& message : driver->sendList) {
+		counters |= 1 << (message.data[0] >> 4);
+	}
+	TEST_ASSERT_EQUALS(counters, (1 << xpcc::CanConnectorBase::maxInterleavedMessages) - 1);
+	driver->sendList.removeAll();
+
+	driver->sendSlots = 3;
+	connector->update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 3U);
+	this->messageCounter = xpcc::CanConnectorBase::maxInterleavedMessages << 4;
+	for (uint8_t fragment = 0; fragment < 3; ++fragment)
+	{
+		checkFragmentedMessage(driver->sendList.getFront(), fragment);
+		driver->sendList.removeFront();
+	}
+}
+
+void
+CanConnectorTest::testReceiveInterleaved()
+{
+	// fragments of two messages from different sources
+	xpcc::Header otherHeader(xpcc::Header::Type::REQUEST, false, 0x12, 0x35, 0x56);
+	const uint32_t otherIdentifier = 0x01123556;
+
+	modm::can::Message message;
+	for (uint8_t fragment = 0; fragment < 3; ++fragment)
+	{
+		this->messageCounter = 0x10;
+		createMessage(message, fragment);
+		driver->receiveList.append(message);
+
+		// the same counter does not confuse messages of different sources
+		createMessage(message, 2 - fragment);
+		message.identifier = otherIdentifier;
+		driver->receiveList.append(message);
+	}
+
+	connector->update();
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+	TEST_ASSERT_EQUALS(connector->getPacketHeader(), xpccHeader);
+	TEST_ASSERT_EQUALS_ARRAY(
+			connector->getPacketPayload().getPointer(),
+			fragmentedPayload,
+			sizeof(fragmentedPayload));
+	connector->dropPacket();
+
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+	TEST_ASSERT_EQUALS(connector->getPacketHeader(), otherHeader);
+	TEST_ASSERT_EQUALS_ARRAY(
+			connector->getPacketPayload().getPointer(),
+			fragmentedPayload,
+			sizeof(fragmentedPayload));
+	connector->dropPacket();
+
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+}
+
+void
+CanConnectorTest::testReceiveTimeout()
+{
+	using test_clock = modm_test::chrono::milli_clock;
+	test_clock::setTime(1000);
+
+	this->messageCounter = 0x20;
+	modm::can::Message message;
+	createMessage(message, 0);
+	driver->receiveList.append(message);
+	createMessage(message, 1);
+	driver->receiveList.append(message);
+	connector->update();
+
+	// the message is discarded, if the last fragment is too late
+	test_clock::increment(xpcc::CanConnectorBase::reassemblyTimeout + 1ms);
+	connector->update();
+	createMessage(message, 2);
+	driver->receiveList.append(message);
+	connector->update();
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+
+	// but not if the fragments arrive in time
+	createMessage(message, 0);
+	driver->receiveList.append(message);
+	connector->update();
+	test_clock::increment(xpcc::CanConnectorBase::reassemblyTimeout);
+	connector->update();
+	createMessage(message, 1);
+	driver->receiveList.append(message);
+	connector->update();
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+	connector->dropPacket();
+}
+
+void
+CanConnectorTest::testReassemblyTableFull()
+{
+	using test_clock = modm_test::chrono::milli_clock;
+	test_clock::setTime(0);
+
+	// more incomplete messages than reassembly slots
+	modm::can::Message message;
+	for (uint8_t counter = 0; counter < 5; ++counter)
+	{
+		this->messageCounter = counter << 4;
+		createMessage(message, 0);
+		driver->receiveList.append(message);
+		connector->update();
+		test_clock::increment(1);
+	}
+
+	// all but the oldest message can still be completed
+	for (uint8_t counter = 1; counter < 5; ++counter)
+	{
+		this->messageCounter = counter << 4;
+		createMessage(message, 1);
+		driver->receiveList.append(message);
+		createMessage(message, 2);
+		driver->receiveList.append(message);
+	}
+	connector->update();
+	for (uint8_t counter = 1; counter < 5; ++counter)
+	{
+		TEST_ASSERT_TRUE(connector->isPacketAvailable());
+		TEST_ASSERT_EQUALS(connector->getPacketPayload().getPointer()[0], 0);
+		connector->dropPacket();
+	}
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+
+	// the first fragment of the oldest message was replaced
+	this->messageCounter = 0x00;
+	createMessage(message, 1);
+	driver->receiveList.append(message);
+	createMessage(message, 2);
+	driver->receiveList.append(message);
+	connector->update();
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+}
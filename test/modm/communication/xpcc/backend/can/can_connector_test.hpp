@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012-2013, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -59,6 +60,27 @@ public:
     void
     testReceiveFragmentedMessage();
 
+    void
+    testSendFlexibleData();
+
+    void
+    testReceiveFlexibleData();
+
+    void
+    testSendInterleaved();
+
+    void
+    testSendInterleavedLimit();
+
+    void
+    testReceiveInterleaved();
+
+    void
+    testReceiveTimeout();
+
+    void
+    testReassemblyTableFull();
+
 private:
 	TestingCanConnector *connector;
 	modm_test::platform::CanDriver *driver;
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2010, Georgi Grinshpun
  * Copyright (c) 2012-2013, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,7 +15,8 @@
 
 #include "testing_can_connector.hpp"
 
-TestingCanConnector::TestingCanConnector(modm_test::platform::CanDriver *driver) :
-	xpcc::CanConnector<modm_test::platform::CanDriver>(driver)
+TestingCanConnector::TestingCanConnector(modm_test::platform::CanDriver *driver,
+		bool flexibleData) :
+	xpcc::CanConnector<modm_test::platform::CanDriver>(driver, flexibleData)
 {
 }
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, 2018, Fabian Greif
  * Copyright (c) 2012-2014, 2017, Niklas Hauser
  * Copyright (c) 2013, Kevin Läufer
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -23,7 +24,8 @@
 class TestingCanConnector : public xpcc::CanConnector<modm_test::platform::CanDriver>
 {
 public:
-	TestingCanConnector(modm_test::platform::CanDriver *driver);
+	TestingCanConnector(modm_test::platform::CanDriver *driver,
+			bool flexibleData = false);
 
 	// expose the internal variable for testing
 	using xpcc::CanConnector<modm_test::platform::CanDriver>::messageCounter;
@@ -528,3 +528,48 @@ DispatcherTest::testResponseRetransmission()
 
 	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 0U);
 }
+
+void
+DispatcherTest::testManyOutstandingActions()
+{
+	// first half is sent now, second half 50ms later
+	for (uint8_t id = 0; id < 100; id++) {
+		component1->callAction(10, id);
+	}
+	dispatcher->update();
+	test_clock::increment(50);
+	for (uint8_t id = 100; id < 200; id++) {
+		component1->callAction(10, id);
+	}
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 200U);
+	backend->messagesSend.removeAll();
+
+	// acknowledge every odd action, last one first
+	for (int id = 199; id > 0; id -= 2)
+	{
+		backend->messagesToReceive.append(
+				Message(xpcc::Header(xpcc::Header::Type::REQUEST, true, 1, 10, uint8_t(id)),
+						modm::SmartPointer()));
+	}
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 0U);
+
+	// only the unacknowledged actions of the first half expired
+	test_clock::increment(60);
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 50U);
+	uint8_t id = 0;
+	for (const auto &message : backend->messagesSend)
+	{
+		TEST_ASSERT_EQUALS(message.header,
+				xpcc::Header(xpcc::Header::Type::REQUEST, false, 10, 1, id));
+		id += 2;
+	}
+	backend->messagesSend.removeAll();
+
+	test_clock::increment(50);
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 50U);
+	backend->messagesSend.removeAll();
+}
@@ -112,6 +112,10 @@ public:
 	void
 	testResponseRetransmission();
 
+	// Acknowledges in arbitrary order only stop the matching retransmissions
+	void
+	testManyOutstandingActions();
+
 private:
 	xpcc::Dispatcher *dispatcher;
 	FakeBackend *backend;
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/communication/xpcc/postman/dynamic_postman.hpp>
+
+#include "dynamic_postman_test.hpp"
+
+namespace
+{
+	class Component : public xpcc::Communicatable
+	{
+	public:
+		void
+		event(const xpcc::Header&)
+		{
+			eventCalls++;
+		}
+
+		void
+		eventPayload(const xpcc::Header&, const uint16_t& payload)
+		{
+			eventCalls++;
+			lastPayload = payload;
+		}
+
+		void
+		action(const xpcc::ResponseHandle& response)
+		{
+			actionCalls++;
+			lastSource = response.getDestination();
+		}
+
+		void
+		actionPayload(const xpcc::ResponseHandle& response, const uint16_t& payload)
+		{
+			actionCalls++;
+			lastSource = response.getDestination();
+			lastPayload = payload;
+		}
+
+		uint8_t eventCalls = 0;
+		uint8_t actionCalls = 0;
+		uint8_t lastSource = 0;
+		uint16_t lastPayload = 0;
+	};
+}
+
+void
+DynamicPostmanTest::testEvents()
+{
+	xpcc::DynamicPostman postman;
+	Component component1;
+	Component component2;
+
+	postman.registerEventListener(0x10, &component1, &Component::event);
+	postman.registerEventListener(0x10, &component2, &Component::eventPayload);
+	postman.registerEventListener(0xff, &component2, &Component::event);
+
+	const uint16_t data = 0x1234;
+	modm::SmartPointer payload(&data);
+
+	xpcc::Header header(xpcc::Header::Type::REQUEST, false, 0, 5, 0x10);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::OK);
+	TEST_ASSERT_EQUALS(component1.eventCalls, 1);
+	TEST_ASSERT_EQUALS(component2.eventCalls, 1);
+	TEST_ASSERT_EQUALS(component2.lastPayload, 0x1234);
+
+	header.packetIdentifier = 0xff;
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::OK);
+	TEST_ASSERT_EQUALS(component1.eventCalls, 1);
+	TEST_ASSERT_EQUALS(component2.eventCalls, 2);
+
+	header.packetIdentifier = 0x11;
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::NO_EVENT);
+}
+
+void
+DynamicPostmanTest::testActions()
+{
+	xpcc::DynamicPostman postman;
+	Component component;
+
+	TEST_ASSERT_FALSE(postman.isComponentAvailable(0x20));
+
+	postman.registerActionHandler(0x20, 0x01, &component, &Component::action);
+	postman.registerActionHandler(0x20, 0xff, &component, &Component::actionPayload);
+
+	TEST_ASSERT_TRUE(postman.isComponentAvailable(0x20));
+	TEST_ASSERT_FALSE(postman.isComponentAvailable(0x21));
+
+	const uint16_t data = 0xabcd;
+	modm::SmartPointer payload(&data);
+
+	xpcc::Header header(xpcc::Header::Type::REQUEST, false, 0x20, 0x07, 0x01);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::OK);
+	TEST_ASSERT_EQUALS(component.actionCalls, 1);
+	TEST_ASSERT_EQUALS(component.lastSource, 0x07);
+
+	header.packetIdentifier = 0xff;
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::OK);
+	TEST_ASSERT_EQUALS(component.actionCalls, 2);
+	TEST_ASSERT_EQUALS(component.lastPayload, 0xabcd);
+
+	header.packetIdentifier = 0x02;
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::NO_ACTION);
+
+	header.destination = 0x21;
+	TEST_ASSERT_EQUALS(postman.deliverPacket(header, payload), xpcc::Postman::NO_COMPONENT);
+	TEST_ASSERT_EQUALS(component.actionCalls, 2);
+}
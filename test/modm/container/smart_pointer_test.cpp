@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/smart_pointer.hpp>
+
+#include "smart_pointer_test.hpp"
+
+void
+SmartPointerTest::testEmpty()
+{
+	modm::SmartPointer empty;
+	TEST_ASSERT_EQUALS(empty.getSize(), 0U);
+
+	modm::SmartPointer zero(uint16_t(0));
+	TEST_ASSERT_EQUALS(zero.getSize(), 0U);
+
+	modm::SmartPointer copy(empty);
+	TEST_ASSERT_EQUALS(copy.getSize(), 0U);
+	TEST_ASSERT_TRUE(copy == empty);
+
+	copy = zero;
+	TEST_ASSERT_EQUALS(copy.getSize(), 0U);
+}
+
+void
+SmartPointerTest::testCopy()
+{
+	const uint32_t value = 0x12345678;
+	modm::SmartPointer ptr(&value);
+	TEST_ASSERT_EQUALS(ptr.getSize(), 4U);
+	TEST_ASSERT_EQUALS(ptr.get<uint32_t>(), 0x12345678U);
+
+	{
+		modm::SmartPointer copy(ptr);
+		TEST_ASSERT_TRUE(copy == ptr);
+
+		// the data is shared, not copied
+		copy.getPointer()[0] = 0xab;
+		TEST_ASSERT_EQUALS(ptr.getPointer()[0], 0xab);
+	}
+
+	// the block is still valid after the copy was destroyed
+	uint32_t result = 0;
+	TEST_ASSERT_TRUE(ptr.get(result));
+	TEST_ASSERT_EQUALS(result, 0x123456abU);
+
+	uint16_t wrongSize;
+	TEST_ASSERT_FALSE(ptr.get(wrongSize));
+}
+
+void
+SmartPointerTest::testMove()
+{
+	const uint16_t value = 0x4321;
+	modm::SmartPointer ptr(&value);
+	const uint8_t *data = ptr.getPointer();
+
+	modm::SmartPointer moved(std::move(ptr));
+	TEST_ASSERT_EQUALS(moved.getSize(), 2U);
+	TEST_ASSERT_TRUE(moved.getPointer() == data);
+	TEST_ASSERT_EQUALS(ptr.getSize(), 0U);
+
+	modm::SmartPointer assigned;
+	assigned = std::move(moved);
+	TEST_ASSERT_EQUALS(assigned.getSize(), 2U);
+	TEST_ASSERT_EQUALS(assigned.get<uint16_t>(), 0x4321U);
+	TEST_ASSERT_TRUE(assigned.getPointer() == data);
+	TEST_ASSERT_EQUALS(moved.getSize(), 0U);
+}
+
+void
+SmartPointerTest::testAssignment()
+{
+	const uint8_t a = 0x0a;
+	const uint16_t b = 0x0b0b;
+
+	modm::SmartPointer ptrA(&a);
+	modm::SmartPointer ptrB(&b);
+
+	modm::SmartPointer& self = ptrA;
+	ptrA = self;
+	TEST_ASSERT_EQUALS(ptrA.getSize(), 1U);
+	TEST_ASSERT_EQUALS(ptrA.get<uint8_t>(), 0x0a);
+
+	ptrA = ptrB;
+	TEST_ASSERT_TRUE(ptrA == ptrB);
+	TEST_ASSERT_EQUALS(ptrA.getSize(), 2U);
+	TEST_ASSERT_EQUALS(ptrA.get<uint16_t>(), 0x0b0bU);
+
+	ptrB = modm::SmartPointer();
+	TEST_ASSERT_EQUALS(ptrB.getSize(), 0U);
+	TEST_ASSERT_EQUALS(ptrA.get<uint16_t>(), 0x0b0bU);
+}
+
+void
+SmartPointerTest::testManyBlocks()
+{
+	// exceeds the default pool sizes, so that every pool overflows into the
+	// next larger one and finally onto the heap
+	constexpr uint8_t count = 54;
+	const auto getSize = [](uint8_t index) -> uint16_t
+	{
+		return (index < 40) ? 16 : (index < 52) ? 64 : 200;
+	};
+
+	for (uint8_t round = 0; round < 2; ++round)
+	{
+		modm::SmartPointer pointers[count];
+		for (uint8_t ii = 0; ii < count; ++ii)
+		{
+			pointers[ii] = modm::SmartPointer(getSize(ii));
+			TEST_ASSERT_EQUALS(pointers[ii].getSize(), getSize(ii));
+			std::memset(pointers[ii].getPointer(), ii + round, getSize(ii));
+		}
+
+		// no block must overlap with another one
+		for (uint8_t ii = 0; ii < count; ++ii)
+		{
+			const uint8_t *data = pointers[ii].getPointer();
+			bool intact = true;
+			for (uint16_t jj = 0; jj < getSize(ii); ++jj) {
+				intact &= (data[jj] == uint8_t(ii + round));
+			}
+			TEST_ASSERT_TRUE(intact);
+		}
+	}
+}
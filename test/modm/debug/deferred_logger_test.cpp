@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "deferred_logger_test.hpp"
+
+#include <modm/debug/logger/deferred.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <modm-test/mock/iodevice.hpp>
+#include <cstring>
+
+#undef	MODM_LOG_LEVEL
+#define	MODM_LOG_LEVEL modm::log::INFO
+
+using test_clock = modm_test::chrono::micro_clock;
+
+static modm_test::platform::IODevice device;
+static modm::IOStream stream(device);
+
+/// Formats the next record and compares it without the line ending
+#define TEST_ASSERT_RECORD(logger, string) \
+	do { \
+		device.clear(); \
+		TEST_ASSERT_TRUE((logger).process(stream)); \
+		TEST_ASSERT_EQUALS(device.bytesWritten, std::strlen(string) + 2); \
+		TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, std::strlen(string)); \
+	} while (0)
+
+void
+DeferredLoggerTest::setUp()
+{
+	device.clear();
+	test_clock::setTime(1234);
+}
+
+void
+DeferredLoggerTest::testIntegers()
+{
+	modm::log::DeferredLogger<4> logger;
+	TEST_ASSERT_FALSE(logger.process(stream));
+
+	TEST_ASSERT_TRUE(logger.log(modm::log::INFO, "%d %u %x", -5, 7u, uint8_t(0xab)));
+	test_clock::increment(1);
+	TEST_ASSERT_TRUE(logger.log(modm::log::ERROR, "%ld %lld %%", int64_t(-1) << 40, uint64_t(1) << 40));
+	TEST_ASSERT_TRUE(logger.log(modm::log::DEBUG, "%c%04X", 'A', 0xbeefu));
+
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    -5 7 ab");
+	TEST_ASSERT_RECORD(logger, "[      1235] Error:   -1099511627776 1099511627776 %");
+	TEST_ASSERT_RECORD(logger, "[      1235] Debug:   ABEEF");
+	TEST_ASSERT_FALSE(logger.process(stream));
+	TEST_ASSERT_TRUE(logger.isEmpty());
+}
+
+void
+DeferredLoggerTest::testFloats()
+{
+	modm::log::DeferredLogger<4> logger;
+
+	logger.log(modm::log::INFO, "%.2f %.3e", 1.5f, -2.25);
+	logger.log(modm::log::INFO, "%g", 3);
+
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    1.50 -2.250e+00");
+	// integers are converted for floating point conversions
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    3");
+}
+
+void
+DeferredLoggerTest::testStrings()
+{
+	modm::log::DeferredLogger<4> logger;
+	char buffer[] = "abc";
+
+	logger.log(modm::log::INFO, "%s|%5s|%s", "x", buffer, static_cast<const char*>(nullptr));
+	buffer[0] = 'z';
+	// strings are truncated to the remaining space of the record
+	logger.log(modm::log::INFO, "%d %s", 1, "0123456789abcdefghijklmnopqrstuvwxyz");
+
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    x|  abc|");
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    1 0123456789abcdefg");
+}
+
+void
+DeferredLoggerTest::testMismatch()
+{
+	modm::log::DeferredLogger<4> logger;
+
+	logger.log(modm::log::INFO, "%s %d %d %y", 1, 1.0, 2);
+	logger.log(modm::log::INFO, "%d %d", 1);
+
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    ? ? 2 ?");
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    1 ?");
+}
+
+void
+DeferredLoggerTest::testLevelFilter()
+{
+	modm::log::DeferredLogger<4> logger;
+
+	MODM_LOG_DEFERRED_DEBUG(logger, "%d", 1);
+	MODM_LOG_DEFERRED_INFO(logger, "%d", 2);
+	MODM_LOG_DEFERRED_WARNING(logger, "%d", 3);
+
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    2");
+	TEST_ASSERT_RECORD(logger, "[      1234] Warning: 3");
+	TEST_ASSERT_FALSE(logger.process(stream));
+}
+
+void
+DeferredLoggerTest::testDropped()
+{
+	modm::log::DeferredLogger<2> logger;
+
+	TEST_ASSERT_TRUE(logger.log(modm::log::INFO, "a"));
+	TEST_ASSERT_TRUE(logger.log(modm::log::INFO, "b"));
+	TEST_ASSERT_FALSE(logger.log(modm::log::INFO, "c"));
+	TEST_ASSERT_FALSE(logger.log(modm::log::INFO, "d"));
+
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    a");
+	TEST_ASSERT_TRUE(logger.log(modm::log::INFO, "e"));
+	TEST_ASSERT_RECORD(logger, "[      1234] Info:    b");
+	TEST_ASSERT_RECORD(logger, "[      1234] Warning: 2 log records dropped\n\r"
+							   "[      1234] Info:    e");
+}
+
+void
+DeferredLoggerTest::testTransmit()
+{
+	modm::log::DeferredLogger<2> logger;
+	static const char format[] = "%d";
+	logger.log(modm::log::WARNING, format, int16_t(-2));
+
+	TEST_ASSERT_TRUE(logger.transmit(device));
+	TEST_ASSERT_FALSE(logger.transmit(device));
+
+	uint8_t expected[1 + sizeof(uintptr_t) + 8 + 5] = {modm::log::DeferredSync};
+	const uintptr_t address = reinterpret_cast<uintptr_t>(format);
+	const uint32_t timestamp = 1234;
+	const int32_t value = -2;
+	uint8_t* data = expected + 1;
+	std::memcpy(data, &address, sizeof(address));
+	data += sizeof(address);
+	std::memcpy(data, &timestamp, 4);
+	data += 4;
+	*data++ = modm::log::WARNING;
+	*data++ = 5;
+	*data++ = 0;
+	*data++ = 0;
+	*data++ = uint8_t(modm::log::DeferredType::Signed);
+	std::memcpy(data, &value, 4);
+
+	TEST_ASSERT_EQUALS(device.bytesWritten, sizeof(expected));
+	TEST_ASSERT_EQUALS_ARRAY(reinterpret_cast<const char*>(expected), device.buffer, sizeof(expected));
+}
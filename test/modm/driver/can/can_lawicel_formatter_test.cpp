@@ -6,6 +6,7 @@
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012-2015, 2017-2018, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -175,3 +176,72 @@ CanLawicelFormatterTest::testInvalidInput()
 	// invalid character in id
 	TEST_ASSERT_FALSE(toCanMessage("t0f.3000000", message));
 }
+
+void
+CanLawicelFormatterTest::testFlexibleData()
+{
+	const auto& toCanMessage = modm::CanLawicelFormatter::convertToCanMessage;
+	const auto& toString = modm::CanLawicelFormatter::convertToString;
+	modm::can::Message message;
+	char buffer[modm::CanLawicelFormatter::MaxStringLength];
+
+	// classic length code, but CAN FD frame format
+	TEST_ASSERT_TRUE(toCanMessage("d1232A55A", message));
+	TEST_ASSERT_EQUALS(message.identifier, 0x123U);
+	TEST_ASSERT_EQUALS(message.length, 2U);
+	TEST_ASSERT_FALSE(message.isExtended());
+	TEST_ASSERT_TRUE(message.isFlexibleData());
+	TEST_ASSERT_FALSE(message.isBitRateSwitching());
+	TEST_ASSERT_EQUALS(message.data[0], 0xa5);
+	TEST_ASSERT_EQUALS(message.data[1], 0x5a);
+	TEST_ASSERT_TRUE(toString(message, buffer));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, "d1232A55A\0", 10);
+
+	// a classic frame must not carry the CAN FD flags of the previous one
+	TEST_ASSERT_TRUE(toCanMessage("t1230", message));
+	TEST_ASSERT_FALSE(message.isFlexibleData());
+	TEST_ASSERT_FALSE(message.isBitRateSwitching());
+
+	if constexpr (modm::can::Message::capacity > 8)
+	{
+		// length code 9 is 12 bytes
+		TEST_ASSERT_TRUE(toCanMessage("B000004569000102030405060708090A0B", message));
+		TEST_ASSERT_EQUALS(message.identifier, 0x456U);
+		TEST_ASSERT_TRUE(message.isExtended());
+		TEST_ASSERT_FALSE(message.isRemoteTransmitRequest());
+		TEST_ASSERT_TRUE(message.isFlexibleData());
+		TEST_ASSERT_TRUE(message.isBitRateSwitching());
+		TEST_ASSERT_EQUALS(message.length, 12U);
+		TEST_ASSERT_EQUALS(message.getDataLengthCode(), 9U);
+		for (uint8_t ii = 0; ii < 12; ++ii) {
+			TEST_ASSERT_EQUALS(message.data[ii], ii);
+		}
+		TEST_ASSERT_TRUE(toString(message, buffer));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, "B000004569000102030405060708090A0B\0", 35);
+
+		// message -> string -> message with the maximum length
+		modm::can::Message msg(0x7ff, 64);
+		msg.setExtended(false);
+		for (uint8_t ii = 0; ii < 64; ++ii) {
+			msg.data[ii] = ii * 3;
+		}
+		TEST_ASSERT_TRUE(toString(msg, buffer));
+		TEST_ASSERT_EQUALS(std::strlen(buffer), 5U + 128U);
+		TEST_ASSERT_EQUALS(buffer[0], 'd');
+		TEST_ASSERT_EQUALS(buffer[4], 'F');
+
+		modm::can::Message myMsg;
+		TEST_ASSERT_TRUE(toCanMessage(buffer, myMsg));
+		TEST_ASSERT_TRUE(msg == myMsg);
+	}
+	else
+	{
+		// does not fit into the message
+		TEST_ASSERT_FALSE(toCanMessage("B000004569000102030405060708090A0B", message));
+	}
+
+	// payload does not match the length code
+	TEST_ASSERT_FALSE(toCanMessage("d1239000102030405060708090A", message));
+	// invalid length code
+	TEST_ASSERT_FALSE(toCanMessage("d123G", message));
+}
@@ -5,6 +5,7 @@
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012-2015, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -54,4 +55,8 @@ public:
 	// check if invalid input is rejected as expected
 	void
 	testInvalidInput();
+
+	// CAN FD frames with up to 64 bytes
+	void
+	testFlexibleData();
 };
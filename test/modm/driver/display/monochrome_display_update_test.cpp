@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/driver/display/ssd1306.hpp>
+#include <modm/driver/display/sh1106.hpp>
+#include <modm/driver/display/ea_dog.hpp>
+#include <modm/platform/gpio/unused.hpp>
+#include <modm-test/mock/i2c_master.hpp>
+#include <modm-test/mock/spi_master.hpp>
+
+#include "monochrome_display_update_test.hpp"
+
+using I2cMaster = modm_test::platform::I2cMaster;
+using SpiMaster = modm_test::platform::SpiMaster;
+using modm::platform::GpioUnused;
+
+// ----------------------------------------------------------------------------
+void
+MonochromeDisplayUpdateTest::testSsd1306()
+{
+	modm::Ssd1306<I2cMaster> display;
+
+	// the whole buffer is sent at once after clearing:
+	// address, control byte and 6 commands, then address, control byte and data
+	display.clear();
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 2u);
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8u + 2u + 1024u);
+	TEST_ASSERT_FALSE(display.isDirty());
+
+	// nothing changed
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 0u);
+
+	// a single pixel in page 2
+	display.setPixel({10, 20});
+	TEST_ASSERT_TRUE(display.isDirty());
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 2u);
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8u + 3u);
+	const uint8_t *log = I2cMaster::getLog();
+	TEST_ASSERT_EQUALS(log[1], 0x00);	// Transfer::COMMAND_BURST
+	TEST_ASSERT_EQUALS(log[2], 0x21);	// ColumnAddress
+	TEST_ASSERT_EQUALS(log[3], 10);
+	TEST_ASSERT_EQUALS(log[4], 10);
+	TEST_ASSERT_EQUALS(log[5], 0x22);	// PageAddress
+	TEST_ASSERT_EQUALS(log[6], 2);
+	TEST_ASSERT_EQUALS(log[7], 2);
+	TEST_ASSERT_EQUALS(log[9], 0x40);	// Transfer::DATA_BURST
+	TEST_ASSERT_EQUALS(log[10], 1 << 4);
+
+	// two digits of 5 columns with one column between them in page 1
+	display.setCursor({40, 8});
+	display << 42;
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 2u);
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8u + 2u + 11u);
+	TEST_ASSERT_EQUALS(log[3], 40);
+	TEST_ASSERT_EQUALS(log[4], 50);
+	TEST_ASSERT_EQUALS(log[6], 1);
+
+	// a page is sent again after a failed transfer
+	display.setPixel({100, 40});
+	I2cMaster::setError(true);
+	display.update();
+	I2cMaster::setError(false);
+	TEST_ASSERT_TRUE(display.isDirty());
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 2u);
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8u + 3u);
+	TEST_ASSERT_EQUALS(log[3], 100);
+	TEST_ASSERT_EQUALS(log[6], 5);
+	TEST_ASSERT_FALSE(display.isDirty());
+
+	// clearing the display sends the whole buffer again
+	display.clear();
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8u + 2u + 1024u);
+	TEST_ASSERT_EQUALS(log[7], 7);	// last page
+
+	// the window of the whole buffer ends with the last page of the display
+	modm::Ssd1306<I2cMaster, 32> display32;
+	display32.clear();
+	I2cMaster::clear();
+	display32.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8u + 2u + 512u);
+	TEST_ASSERT_EQUALS(log[5], 0x22);	// PageAddress
+	TEST_ASSERT_EQUALS(log[6], 0);
+	TEST_ASSERT_EQUALS(log[7], 3);
+}
+
+// ----------------------------------------------------------------------------
+void
+MonochromeDisplayUpdateTest::testSh1106()
+{
+	modm::Sh1106<I2cMaster> display;
+
+	// every page: address, control byte and 3 commands, then address,
+	// control byte and data
+	display.clear();
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 16u);
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 8 * (5u + 2u + 128u));
+
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 0u);
+
+	// the visible columns start at column 2
+	display.setPixel({30, 63});
+	I2cMaster::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactions(), 2u);
+	TEST_ASSERT_EQUALS(I2cMaster::getBytes(), 5u + 3u);
+	const uint8_t *log = I2cMaster::getLog();
+	TEST_ASSERT_EQUALS(log[2], 0x10 | 2);	// HigherColumnStartAddress
+	TEST_ASSERT_EQUALS(log[3], 0x00 | 0);	// LowerColumnStartAddress
+	TEST_ASSERT_EQUALS(log[4], 0xB0 | 7);	// PageStartAddress
+	TEST_ASSERT_EQUALS(log[7], 1 << 7);
+}
+
+// ----------------------------------------------------------------------------
+void
+MonochromeDisplayUpdateTest::testSt7565()
+{
+	modm::DogM128<SpiMaster, GpioUnused, GpioUnused, GpioUnused, true> display;
+	uint8_t tx[1100];
+
+	// every page: 3 commands and 128 columns
+	display.clear();
+	SpiMaster::clearBuffers();
+	display.update();
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 8 * (3u + 128u));
+	SpiMaster::clearBuffers();
+
+	display.update();
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 0u);
+
+	// a horizontal line in page 1, the top view has an offset of 4 columns
+	display.drawLine({20, 12}, {59, 12});
+	display.update();
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 3u + 40u);
+	SpiMaster::popTxBuffer(tx);
+	TEST_ASSERT_EQUALS(tx[0], ST7565_PAGE_ADDRESS | 1);
+	TEST_ASSERT_EQUALS(tx[1], ST7565_COL_ADDRESS_MSB | 1);
+	TEST_ASSERT_EQUALS(tx[2], ST7565_COL_ADDRESS_LSB | 8);
+	TEST_ASSERT_EQUALS(tx[3], 1 << 4);
+	TEST_ASSERT_EQUALS(tx[42], 1 << 4);
+}
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, 2012, 2017, Fabian Greif
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012, 2017, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,7 @@
 
 #include "block_allocator_test.hpp"
 
+#include <cstring>
 #include <modm/driver/storage/block_allocator.hpp>
 
 void
@@ -100,3 +102,151 @@ BlockAllocatorTest::testAlignment()
 
 	delete[] heap;
 }
+
+void
+BlockAllocatorTest::testReallocate()
+{
+	uint8_t *heap = new uint8_t[512];
+
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + 512);
+
+	// behaves like allocate()
+	uint8_t *first = static_cast<uint8_t *>(allocator.reallocate(nullptr, 12));
+	TEST_ASSERT_TRUE(first != nullptr);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 480U);
+	std::memset(first, 0xa5, 12);
+
+	// grow in place into the following free blocks
+	TEST_ASSERT_TRUE(allocator.reallocate(first, 60) == first);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 432U);
+
+	// shrink in place
+	TEST_ASSERT_TRUE(allocator.reallocate(first, 28) == first);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 464U);
+
+	// grow by moving, since the following block is allocated
+	void *second = allocator.allocate(12);
+	TEST_ASSERT_TRUE(second != nullptr);
+	uint8_t *moved = static_cast<uint8_t *>(allocator.reallocate(first, 100));
+	TEST_ASSERT_TRUE(moved != nullptr);
+	TEST_ASSERT_FALSE(moved == first);
+	for (uint8_t ii = 0; ii < 12; ++ii) {
+		TEST_ASSERT_EQUALS(moved[ii], 0xa5);
+	}
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 496U - 16 - 112);
+
+	// fails without touching the memory
+	TEST_ASSERT_TRUE(allocator.reallocate(moved, 1000) == nullptr);
+	TEST_ASSERT_EQUALS(moved[0], 0xa5);
+
+	allocator.free(moved);
+	allocator.free(second);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 496U);
+	TEST_ASSERT_TRUE(allocator.allocate(492) != nullptr);
+
+	delete[] heap;
+}
+
+void
+BlockAllocatorTest::testSizeQueries()
+{
+	uint8_t *heap = new uint8_t[512];
+
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + 512);
+
+	TEST_ASSERT_EQUALS(allocator.getTotalSize(), 496U);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 492U);
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(nullptr), 0U);
+
+	// 2 blocks, 4 bytes are used for the size markers
+	void *a = allocator.allocate(13);
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(a), 28U);
+	void *b = allocator.allocate(100);
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(b), 108U);
+	void *c = allocator.allocate(1);
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(c), 12U);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 492U - 160U);
+
+	// only a hole of two blocks below the large free area
+	allocator.free(a);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 492U - 160U);
+
+	// fill the rest, the hole is the largest free area
+	void *d = allocator.allocate(492 - 160);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 32U);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 28U);
+
+	allocator.free(d);
+	allocator.free(b);
+	allocator.free(c);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 492U);
+
+	delete[] heap;
+}
+
+void
+BlockAllocatorTest::testRandomTrace()
+{
+	constexpr std::size_t heapSize = 1024;
+	uint8_t *heap = new uint8_t[heapSize];
+
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + heapSize);
+	const std::size_t available = allocator.getAvailableSize();
+
+	constexpr uint8_t count = 16;
+	uint8_t *pointers[count] = {};
+	uint16_t sizes[count] = {};
+
+	uint32_t random = 42;
+	const auto next = [&random]()
+	{
+		// linear congruential generator from Numerical Recipes
+		random = random * 1664525 + 1013904223;
+		return random >> 16;
+	};
+
+	bool intact = true;
+	for (uint16_t step = 0; step < 2000; ++step)
+	{
+		const uint8_t ii = next() % count;
+		if (pointers[ii]) {
+			for (uint16_t jj = 0; jj < sizes[ii]; ++jj) {
+				intact &= (pointers[ii][jj] == ii);
+			}
+		}
+
+		// mostly small sizes with a few large ones
+		const uint16_t size = (next() % 8) ? (next() % 40) : (next() % 200);
+		switch (next() % 3)
+		{
+			case 0:
+				allocator.free(pointers[ii]);
+				pointers[ii] = nullptr;
+				break;
+			case 1:
+				if (pointers[ii]) break;
+				[[fallthrough]];
+			default:
+				if (uint8_t *ptr = static_cast<uint8_t *>(allocator.reallocate(pointers[ii], size)))
+				{
+					pointers[ii] = ptr;
+					std::memset(ptr, ii, size);
+					sizes[ii] = size;
+				}
+				break;
+		}
+	}
+	TEST_ASSERT_TRUE(intact);
+
+	for (uint8_t *ptr : pointers) {
+		allocator.free(ptr);
+	}
+	// all free areas must have been merged again
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), available);
+	TEST_ASSERT_TRUE(allocator.allocate(available - 4) != nullptr);
+
+	delete[] heap;
+}
@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, 2012, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2012, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -32,6 +33,17 @@ public:
 
 	void
 	testAlignment();
+
+	void
+	testReallocate();
+
+	void
+	testSizeQueries();
+
+	/// Random allocations, reallocations and frees must neither overlap
+	/// nor leak memory
+	void
+	testRandomTrace();
 };
 
 #endif	// BLOCK_ALLOCATOR_TEST_HPP
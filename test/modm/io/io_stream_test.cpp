@@ -6,6 +6,7 @@
  * Copyright (c) 2016-2017, Sascha Schade
  * Copyright (c) 2017, Marten Junga
  * Copyright (c) 2018, Raphael Lehmann
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -623,3 +624,27 @@ IoStreamTest::testPointer()
 	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, bytesWritten);
 	TEST_ASSERT_EQUALS(device.bytesWritten, bytesWritten);
 }
+
+void
+IoStreamTest::testBlockWrite()
+{
+	// every formatted value is written to the device at once
+	(*stream) << int32_t(-2147483647) << modm::endl;
+	TEST_ASSERT_EQUALS_ARRAY("-2147483647\n\r", device.buffer, 13);
+	TEST_ASSERT_EQUALS(device.blocksWritten, 2U);
+
+	device.clear();
+	(*stream) << modm::hex << uint32_t(0x12ABCDEF) << modm::bin << uint16_t(0x8001);
+	TEST_ASSERT_EQUALS_ARRAY("12ABCDEF1000000000000001", device.buffer, 24);
+	TEST_ASSERT_EQUALS(device.blocksWritten, 2U);
+
+	device.clear();
+	(*stream).printf("%s=%d", "value", 42);
+	TEST_ASSERT_EQUALS_ARRAY("value=42", device.buffer, 8);
+	TEST_ASSERT_EQUALS(device.blocksWritten, 1U);
+
+	device.clear();
+	(*stream).write("abc", 3);
+	TEST_ASSERT_EQUALS_ARRAY("abc", device.buffer, 3);
+	TEST_ASSERT_EQUALS(device.blocksWritten, 1U);
+}
@@ -169,6 +169,9 @@ public:
 	void
 	testPointer();
 
+	void
+	testBlockWrite();
+
 private:
 	modm::IOStream *stream;
 };
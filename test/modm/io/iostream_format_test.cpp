@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "iostream_format_test.hpp"
+
+#include <modm/io/iostream_format.hpp>
+#include <modm-test/mock/iodevice.hpp>
+#include <limits>
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+static modm_test::platform::IODevice device;
+static modm::IOStream stream(device);
+
+#define TEST_ASSERT_FORMAT(string) \
+	TEST_ASSERT_EQUALS(device.bytesWritten, strlen(string)); \
+	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, strlen(string)); \
+	device.clear()
+
+// errors are found when compiling
+using modm::detail::FormatError;
+static_assert(modm::detail::parsedFormat<"{} {{}} {:>08.3f}">.result.error == FormatError::None);
+static_assert(modm::detail::parsedFormat<"{} {{}} {:>08.3f}">.result.arguments == 2);
+static_assert(modm::detail::parsedFormat<"{">.result.error == FormatError::UnmatchedBrace);
+static_assert(modm::detail::parsedFormat<"}">.result.error == FormatError::UnmatchedBrace);
+static_assert(modm::detail::parsedFormat<"{:q}">.result.error == FormatError::InvalidSpecification);
+static_assert(modm::detail::parsedFormat<"{:.}">.result.error == FormatError::InvalidSpecification);
+static_assert(modm::detail::isFormatValid<float>({.type = 'f', .width = 8, .precision = 3}));
+static_assert(not modm::detail::isFormatValid<int>({.type = 'f'}));
+static_assert(not modm::detail::isFormatValid<const char*>({.type = 'x'}));
+
+void
+IoStreamFormatTest::setUp()
+{
+	device.clear();
+}
+
+void
+IoStreamFormatTest::testLiteral()
+{
+	stream << modm::format<"">();
+	TEST_ASSERT_EQUALS(device.bytesWritten, 0U);
+
+	stream << modm::format<"Hello World">();
+	TEST_ASSERT_FORMAT("Hello World");
+
+	stream << modm::format<"{{}} {{{}}}">(1);
+	TEST_ASSERT_FORMAT("{} {1}");
+}
+
+void
+IoStreamFormatTest::testInteger()
+{
+	stream << modm::format<"{} {} {} {}">(uint8_t(255), int8_t(-128), uint16_t(65535), int16_t(-32768));
+	TEST_ASSERT_FORMAT("255 -128 65535 -32768");
+
+	stream << modm::format<"{} {}">(std::numeric_limits<int32_t>::min(), std::numeric_limits<uint32_t>::max());
+	TEST_ASSERT_FORMAT("-2147483648 4294967295");
+
+	stream << modm::format<"{} {}">(std::numeric_limits<int64_t>::min(), std::numeric_limits<uint64_t>::max());
+	TEST_ASSERT_FORMAT("-9223372036854775808 18446744073709551615");
+
+	stream << modm::format<"{}">(0);
+	TEST_ASSERT_FORMAT("0");
+}
+
+void
+IoStreamFormatTest::testIntegerSpecification()
+{
+	stream << modm::format<"{:x} {:X} {:b} {:o}">(0xabcdu, 0xabcdu, 5, 8);
+	TEST_ASSERT_FORMAT("abcd ABCD 101 10");
+
+	stream << modm::format<"{:x} {:b}">(-255, int8_t(-1));
+	TEST_ASSERT_FORMAT("-ff 11111111");
+
+	stream << modm::format<"[{:5}] [{:<5}] [{:*>5}] [{:_<5}]">(42, 42, 42, -42);
+	TEST_ASSERT_FORMAT("[   42] [42   ] [***42] [-42__]");
+
+	stream << modm::format<"{:05} {:08X} {:04}">(-42, 0xbeefu, 123456);
+	TEST_ASSERT_FORMAT("-0042 0000BEEF 123456");
+
+	// zero padding is not limited by the digits of the type
+	stream << modm::format<"{:010} {:010} {:<06}">(uint8_t(5), int8_t(-5), 7);
+	TEST_ASSERT_FORMAT("0000000005 -000000005 000007");
+}
+
+void
+IoStreamFormatTest::testCharacter()
+{
+	stream << modm::format<"{}{:c}{:d}{:x}[{:3}]">('a', 98, 'c', 'd', 'e');
+	TEST_ASSERT_FORMAT("ab9964[e  ]");
+}
+
+void
+IoStreamFormatTest::testString()
+{
+	const char* string = "modm";
+	stream << modm::format<"{} {:s} {:.2} [{:6}] [{:>6}]">("abc", string, string, string, string);
+	TEST_ASSERT_FORMAT("abc modm mo [modm  ] [  modm]");
+}
+
+void
+IoStreamFormatTest::testFloat()
+{
+	stream << modm::format<"{:f} {:.3f} {:.0f} {:.0f} {:.0f}">(1.5, -3.14159f, 0.5, 1.5, 2.5);
+	TEST_ASSERT_FORMAT("1.500000 -3.142 0 2 2");
+
+	stream << modm::format<"{:.2f} {:.9f} {:.1f}">(0.999, 0.123456789, 9.96);
+	TEST_ASSERT_FORMAT("1.00 0.123456789 10.0");
+
+	stream << modm::format<"[{:8.2f}] [{:<8.2f}] [{:08.2f}]">(-1.005, 2.5, -2.5);
+	TEST_ASSERT_FORMAT("[   -1.00] [2.50    ] [-0002.50]");
+
+	stream << modm::format<"{:040.2f}">(-1.5);
+	TEST_ASSERT_FORMAT("-000000000000000000000000000000000001.50");
+
+	stream << modm::format<"{:f} {:f} {:.1f}">(NAN, -INFINITY, INFINITY);
+	TEST_ASSERT_FORMAT("nan -inf inf");
+
+	// the default and large values are written like the stream operator
+	char string[40];
+	stream << 1.25f << ' ' << 1e12;
+	const std::size_t length = device.bytesWritten;
+	memcpy(string, device.buffer, length);
+	device.clear();
+	stream << modm::format<"{} {:f}">(1.25f, 1e12);
+	TEST_ASSERT_EQUALS(device.bytesWritten, length);
+	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, length);
+}
+
+void
+IoStreamFormatTest::testOther()
+{
+	stream << modm::format<"{} {}">(true, false);
+	TEST_ASSERT_FORMAT("true false");
+
+	char string[40];
+	const void* pointer = reinterpret_cast<const void*>(0x1234);
+	stream << pointer;
+	const std::size_t length = device.bytesWritten;
+	memcpy(string, device.buffer, length);
+	device.clear();
+	stream << modm::format<"{:p}">(pointer);
+	TEST_ASSERT_EQUALS(device.bytesWritten, length);
+	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, length);
+}
+
+void
+IoStreamFormatTest::testBlockWrite()
+{
+	// one block per literal text, argument and padding
+	stream << modm::format<"x={} y={:5}\n">(-123456, "abc");
+	TEST_ASSERT_EQUALS(device.blocksWritten, 6U);
+	TEST_ASSERT_FORMAT("x=-123456 y=abc  \n");
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_io
+class IoStreamFormatTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testLiteral();
+
+	void
+	testInteger();
+
+	void
+	testIntegerSpecification();
+
+	void
+	testCharacter();
+
+	void
+	testString();
+
+	void
+	testFloat();
+
+	void
+	testOther();
+
+	void
+	testBlockWrite();
+};
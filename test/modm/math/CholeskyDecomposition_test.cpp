@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <modm/math/matrix.hpp>
+#include <modm/math/cholesky_decomposition.hpp>
+#include "CholeskyDecomposition_test.hpp"
+
+void
+CholeskyDecompositionTest::testDecompose()
+{
+	const float m[] = {
+		  4.f,  12.f, -16.f,
+		 12.f,  37.f, -43.f,
+		-16.f, -43.f,  98.f
+	};
+	const float expected[] = {
+		 2.f, 0.f, 0.f,
+		 6.f, 1.f, 0.f,
+		-8.f, 5.f, 3.f
+	};
+
+	modm::Matrix<float, 3, 3> A(m);
+	modm::Matrix<float, 3, 3> l;
+	TEST_ASSERT_TRUE(modm::CholeskyDecomposition::decompose(A, &l));
+	for (uint8_t i = 0; i < 9; ++i) {
+		TEST_ASSERT_EQUALS_FLOAT(l.element[i], expected[i]);
+	}
+	TEST_ASSERT_TRUE(l * l.asTransposed() == A);
+
+	// only the lower triangle is changed
+	TEST_ASSERT_TRUE(modm::CholeskyDecomposition::decomposeInPlace(&A));
+	TEST_ASSERT_EQUALS_FLOAT(A[2][1], 5.f);
+	TEST_ASSERT_EQUALS_FLOAT(A[1][2], -43.f);
+
+	// not positive-definite
+	const float n[] = {
+		1.f, 2.f,
+		2.f, 1.f
+	};
+	modm::Matrix<float, 2, 2> B(n);
+	modm::Matrix<float, 2, 2> lb;
+	TEST_ASSERT_FALSE(modm::CholeskyDecomposition::decompose(B, &lb));
+}
+
+void
+CholeskyDecompositionTest::testSolve()
+{
+	// symmetric positive-definite 6x6: 2 on the diagonal, -1 next to it
+	modm::Matrix<float, 6, 6> A = modm::Matrix<float, 6, 6>::zeroMatrix();
+	for (uint8_t j = 0; j < 6; ++j)
+	{
+		A[j][j] = 2.f;
+		if (j > 0) A[j][j-1] = A[j-1][j] = -1.f;
+	}
+
+	const float x[] = {1.f, -2.f, 3.f, 0.5f, -1.f, 2.f};
+	const modm::Matrix<float, 6, 1> expected(x);
+	modm::Matrix<float, 6, 1> b = A * expected;
+
+	modm::Matrix<float, 6, 6> l;
+	TEST_ASSERT_TRUE(modm::CholeskyDecomposition::decompose(A, &l));
+	modm::CholeskyDecomposition::solve(l, &b);
+	for (uint8_t i = 0; i < 6; ++i) {
+		TEST_ASSERT_EQUALS_FLOAT(b[i][0], x[i]);
+	}
+
+	// same result as the LU decomposition
+	modm::Matrix<float, 6, 1> c = A * expected;
+	TEST_ASSERT_TRUE(modm::LUDecomposition::solve(A, &c));
+	for (uint8_t i = 0; i < 6; ++i) {
+		TEST_ASSERT_EQUALS_FLOAT(c[i][0], b[i][0]);
+	}
+}
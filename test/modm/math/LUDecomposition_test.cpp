@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -74,3 +75,50 @@ LUDecompositionTest::testLUD()
 	TEST_ASSERT_EQUALS(b[2][0],  4.f);
 }
 
+
+void
+LUDecompositionTest::testInPlace()
+{
+	const float m[] = {
+		1.f, 2.f, 3.f,
+		0.f, 1.f, 2.f,
+		3.f, 4.f, 6.f
+	};
+
+	modm::Matrix<float, 3, 3> lu(m);
+	modm::Vector<int8_t, 3> p;
+	int8_t sign;
+	TEST_ASSERT_TRUE(modm::LUDecomposition::decomposeInPlace(&lu, &p, &sign));
+
+	// the largest pivot is moved to the top
+	TEST_ASSERT_EQUALS(p[0], 2);
+	TEST_ASSERT_EQUALS(lu[0][0], 3.f);
+	// det(A) = 1
+	TEST_ASSERT_EQUALS_FLOAT(sign * lu[0][0] * lu[1][1] * lu[2][2], 1.f);
+
+	// reuse the decomposition for two right-hand sides
+	const float n[] = {
+		0.f, 1.f,
+		1.f, 0.f,
+		2.f, 0.f
+	};
+	modm::Matrix<float, 3, 2> b(n);
+	modm::LUDecomposition::solveInPlace(lu, p, &b);
+	TEST_ASSERT_EQUALS_FLOAT(b[0][0],  2.f);
+	TEST_ASSERT_EQUALS_FLOAT(b[1][0], -7.f);
+	TEST_ASSERT_EQUALS_FLOAT(b[2][0],  4.f);
+	const modm::Matrix<float, 3, 3> a(m);
+	const modm::Matrix<float, 3, 2> rhs(n);
+	TEST_ASSERT_TRUE(a * b == rhs);
+
+	// singular
+	const float s[] = {
+		1.f, 2.f, 3.f,
+		2.f, 4.f, 6.f,
+		3.f, 4.f, 6.f
+	};
+	modm::Matrix<float, 3, 3> singular(s);
+	TEST_ASSERT_FALSE(modm::LUDecomposition::decomposeInPlace(&singular, &p));
+	modm::Matrix<float, 3, 1> c(n);
+	TEST_ASSERT_FALSE(modm::LUDecomposition::solve(modm::Matrix<float, 3, 3>(s), &c));
+}
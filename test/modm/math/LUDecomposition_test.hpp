@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -16,4 +17,7 @@ class LUDecompositionTest : public unittest::TestSuite
 public:
 	void
 	testLUD();
+
+	void
+	testInPlace();
 };
@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012, Kevin Läufer
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -12,6 +13,7 @@
  */
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <modm/math/filter/fir.hpp>
 
 #include "fir_test.hpp"
@@ -59,3 +61,79 @@ void FirTest::testFilter(const float (&coeff)[N],
 		TEST_ASSERT_EQUALS(filter.getValue(), results[i]);
 	}
 }
+
+template<typename T, int N, int BLOCK_SIZE, int ScaleFactor>
+void FirTest::testBlock(const float (&coeff)[N], const T input[], int length)
+{
+	modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor> reference(coeff);
+	modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor> block(coeff);
+	modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor> inplace(coeff);
+
+	T output[64];
+	T buffer[64];
+	const int chunks[] = {1, 3, 4, 7, 0, 16, 2, 31};
+	int ii = 0;
+	for(int chunk : chunks)
+	{
+		chunk = std::min(chunk, length - ii);
+		block.process(input + ii, output, chunk);
+		std::copy(input + ii, input + ii + chunk, buffer);
+		inplace.process(buffer, buffer, chunk);
+		for(int k = 0; k < chunk; k++)
+		{
+			reference.append(input[ii + k]);
+			reference.update();
+			TEST_ASSERT_EQUALS(output[k], reference.getValue());
+			TEST_ASSERT_EQUALS(buffer[k], reference.getValue());
+		}
+		ii += chunk;
+		TEST_ASSERT_EQUALS(block.getValue(), reference.getValue());
+	}
+	TEST_ASSERT_EQUALS(ii, length);
+}
+
+void
+FirTest::testBlockFloat()
+{
+	const float coeffs[7] = {0.05f, -0.1f, 0.2f, 0.7f, 0.2f, -0.1f, 0.05f};
+	float input[64];
+	for(int i = 0; i < 64; i++){
+		input[i] = float((i * 37) % 23) - 11.f;
+	}
+	testBlock<float, 7, 0, 1>(coeffs, input, 64);
+	testBlock<float, 7, 5, 1>(coeffs, input, 64);
+	testBlock<float, 7, 7, 1>(coeffs, input, 64);
+	testBlock<float, 7, 32, 1>(coeffs, input, 64);
+
+	// a delay line delivers exactly the input
+	const float delay[5] = {0, 0, 1, 0, 0};
+	modm::filter::Fir<float, 5, 5> filter(delay);
+	float output[64];
+	filter.process(input, output, 64);
+	TEST_ASSERT_EQUALS_FLOAT(output[0], 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(output[1], 0.f);
+	for(int i = 2; i < 64; i++){
+		TEST_ASSERT_EQUALS_FLOAT(output[i], input[i - 2]);
+	}
+}
+
+void
+FirTest::testBlockFixedPoint()
+{
+	const float coeffs[9] = {0.02f, 0.06f, 0.12f, 0.18f, 0.24f, 0.18f, 0.12f, 0.06f, 0.02f};
+	int16_t input[64];
+	for(int i = 0; i < 64; i++){
+		input[i] = int16_t(((i * 7919) % 65536) - 32768);
+	}
+	// Q15: the products do not fit into 16 bit
+	testBlock<int16_t, 9, 9, 32768>(coeffs, input, 64);
+	testBlock<int16_t, 9, 3, 32768>(coeffs, input, 64);
+
+	// a full scale step settles at the sum of the coefficients
+	modm::filter::Fir<int16_t, 9, 9, 32768> filter(coeffs);
+	int16_t step[16];
+	std::fill(step, step + 16, int16_t(32767));
+	filter.process(step, step, 16);
+	TEST_ASSERT_EQUALS_DELTA(step[15], int16_t(32767), int16_t(4));
+	TEST_ASSERT_EQUALS_DELTA(step[0], int16_t(655), int16_t(2));
+}
@@ -4,6 +4,7 @@
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2012, Kevin Läufer
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -23,9 +24,19 @@ public:
 	void
 	testFir();
 
+	void
+	testBlockFloat();
+
+	void
+	testBlockFixedPoint();
+
 private:
 	/* Length of results array needs to be len(taps) + len(coeff) */
 	template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
 	void testFilter(const float (&coeff)[N],
 		const T taps[], int taps_length, const T results[]);
+
+	/* Compares process() in chunks of different lengths with append()/update() */
+	template<typename T, int N, int BLOCK_SIZE, int ScaleFactor>
+	void testBlock(const float (&coeff)[N], const T input[], int length);
 };
@@ -3,6 +3,7 @@
  * Copyright (c) 2009, Thorsten Lajewski
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -13,6 +14,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/interpolation/linear.hpp>
+#include <modm/math/interpolation/uniform_linear.hpp>
 
 #include "linear_interpolation_test.hpp"
 
@@ -75,3 +77,89 @@ LinearInterpolationTest::testInterpolationFlash()
 	TEST_ASSERT_EQUALS(value.interpolate(230), 20000);
 	TEST_ASSERT_EQUALS(value.interpolate(250), 20000);
 }
+
+void
+LinearInterpolationTest::testBinarySearch()
+{
+	modm::interpolation::Linear<MyPair, modm::accessor::Flash, modm::interpolation::Search::Binary> \
+		value(modm::accessor::asFlash(flashValues), 6);
+	modm::interpolation::Linear<MyPair, modm::accessor::Flash> \
+		reference(modm::accessor::asFlash(flashValues), 6);
+
+	for (uint16_t x = 0; x <= 255; ++x) {
+		TEST_ASSERT_EQUALS(value.interpolate(x), reference.interpolate(x));
+	}
+
+	// a large table with uneven spacing and a step at x = 307
+	typedef modm::Pair<int16_t, int32_t> Point;
+	Point points[300];
+	for (int16_t i = 0; i < 300; ++i) {
+		points[i] = Point(int16_t(i * 3 + (i >= 100) * 7 - (i == 101) * 3),
+						  int32_t(i * i - 1000));
+	}
+	modm::interpolation::Linear<Point, modm::accessor::Ram,
+								modm::interpolation::Search::Binary> large(points, 300);
+	modm::interpolation::Linear<Point> largeReference(points, 300);
+
+	for (int16_t x = -10; x < 920; ++x) {
+		TEST_ASSERT_EQUALS(large.interpolate(x), largeReference.interpolate(x));
+	}
+
+	// a single point
+	modm::interpolation::Linear<Point, modm::accessor::Ram,
+								modm::interpolation::Search::Binary> single(points, 1);
+	TEST_ASSERT_EQUALS(single.interpolate(-5), -1000);
+	TEST_ASSERT_EQUALS(single.interpolate(5), -1000);
+}
+
+FLASH_STORAGE(int16_t uniformValues[6]) =
+{
+	-200, 0, 50, 2050, 3000, 20000
+};
+
+void
+LinearInterpolationTest::testUniformInteger()
+{
+	// points at 30, 46, 62, 78, 94, 110
+	modm::interpolation::UniformLinear<uint8_t, int16_t, 30, 16, modm::accessor::Flash> \
+		value(modm::accessor::asFlash(uniformValues), 6);
+	TEST_ASSERT_EQUALS(value.getEnd(), 110);
+
+	TEST_ASSERT_EQUALS(value.interpolate(  0),  -200);
+	TEST_ASSERT_EQUALS(value.interpolate( 30),  -200);
+	TEST_ASSERT_EQUALS(value.interpolate( 34),  -150);
+	TEST_ASSERT_EQUALS(value.interpolate( 46),     0);
+	TEST_ASSERT_EQUALS(value.interpolate( 54),    25);
+	TEST_ASSERT_EQUALS(value.interpolate( 70),  1050);
+	TEST_ASSERT_EQUALS(value.interpolate(109), 18937);
+	TEST_ASSERT_EQUALS(value.interpolate(110), 20000);
+	TEST_ASSERT_EQUALS(value.interpolate(255), 20000);
+
+	// must give the same results as the general interpolation
+	typedef modm::Pair<int16_t, uint16_t> Point;
+	Point points[4] = { {-100, 50}, {-40, 10}, {20, 0}, {80, 1000} };
+	const uint16_t outputs[4] = { 50, 10, 0, 1000 };
+
+	modm::interpolation::Linear<Point> reference(points, 4);
+	modm::interpolation::UniformLinear<int16_t, uint16_t, -100, 60> uniform(outputs, 4);
+
+	for (int16_t x = -120; x <= 100; ++x) {
+		TEST_ASSERT_EQUALS(uniform.interpolate(x), reference.interpolate(x));
+	}
+}
+
+void
+LinearInterpolationTest::testUniformFloat()
+{
+	const float outputs[5] = { 0.f, 1.f, 4.f, 9.f, 16.f };
+	modm::interpolation::UniformLinear<float, float, -1.f, 0.5f> value(outputs, 5);
+
+	TEST_ASSERT_EQUALS_FLOAT(value.getEnd(), 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(-2.f), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(-0.75f), 0.5f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(-0.5f), 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(0.6f), 10.4f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(0.99999f), 15.99986f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(1.f), 16.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.f), 16.f);
+}
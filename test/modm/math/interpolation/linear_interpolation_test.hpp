@@ -3,6 +3,7 @@
  * Copyright (c) 2009, Thorsten Lajewski
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -22,5 +23,14 @@ struct LinearInterpolationTest : public unittest::TestSuite
 
 	void
 	testInterpolationFlash();
+
+	void
+	testBinarySearch();
+
+	void
+	testUniformInteger();
+
+	void
+	testUniformFloat();
 };
 
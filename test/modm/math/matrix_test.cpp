@@ -2,6 +2,7 @@
  * Copyright (c) 2011, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2017, Marten Junga
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -621,3 +622,166 @@ MatrixTest::testDeterminant()
 	modm::Matrix<int16_t, 1, 1> d = a.subMatrix<1, 1>(1, 1);
 	TEST_ASSERT_EQUALS(d.determinant(), 5);
 }
+
+void
+MatrixTest::testDeterminantLarge()
+{
+	// needs a row swap for a zero pivot
+	const int32_t m[16] = {
+		0, 2, 1, 3,
+		4, 1, 0, 2,
+		1, 5, 3, 1,
+		2, 0, 6, 1
+	};
+	modm::Matrix<int32_t, 4, 4> a(m);
+	TEST_ASSERT_EQUALS(a.determinant(), -335);
+
+	a.replaceRow(3, a.getRow(0) * 2);
+	TEST_ASSERT_EQUALS(a.determinant(), 0);
+
+	const float n[16] = {
+		0.f, 2.f, 1.f, 3.f,
+		4.f, 1.f, 0.f, 2.f,
+		1.f, 5.f, 3.f, 1.f,
+		2.f, 0.f, 6.f, 1.f
+	};
+	modm::Matrix<float, 4, 4> b(n);
+	TEST_ASSERT_EQUALS_FLOAT(b.determinant() / -335.f, 1.f);
+
+	// det(k*I + ones) = k^(N-1) * (k + N)
+	modm::Matrix<float, 9, 9> c;
+	for (uint8_t j = 0; j < 9; ++j) {
+		for (uint8_t i = 0; i < 9; ++i) {
+			c[j][i] = (i == j) ? 3.f : 1.f;
+		}
+	}
+	TEST_ASSERT_EQUALS_FLOAT(c.determinant() / 2816.f, 1.f);
+
+	modm::Matrix<float, 9, 9> z = modm::Matrix<float, 9, 9>::zeroMatrix();
+	TEST_ASSERT_EQUALS_FLOAT(z.determinant(), 0.f);
+}
+
+void
+MatrixTest::testInverse()
+{
+	const float m[9] = {
+		1.f, 2.f, 3.f,
+		0.f, 1.f, 4.f,
+		5.f, 6.f, 0.f
+	};
+	const float inv[9] = {
+		-24.f, 18.f,  5.f,
+		 20.f, -15.f, -4.f,
+		 -5.f,  4.f,  1.f
+	};
+
+	modm::Matrix<float, 3, 3> a(m);
+	modm::Matrix<float, 3, 3> b = a.asInversed();
+	for (uint8_t i = 0; i < 9; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(b.element[i], inv[i], 1e-4f);
+	}
+
+	TEST_ASSERT_TRUE(a.inverse());
+	TEST_ASSERT_TRUE(a == b);
+
+	// singular matrices are not changed
+	const float n[4] = {
+		1.f, 2.f,
+		2.f, 4.f
+	};
+	modm::Matrix<float, 2, 2> c(n);
+	const modm::Matrix<float, 2, 2> d(n);
+	TEST_ASSERT_FALSE(c.inverse());
+	TEST_ASSERT_TRUE(c == d);
+}
+
+void
+MatrixTest::testGemm()
+{
+	const int16_t m[6] = {
+		1, 2, 3,
+		4, 5, 6
+	};
+	const int16_t n[6] = {
+		 7,  8,
+		 9, 10,
+		11, 12
+	};
+	const int16_t o[4] = {
+		1, -1,
+		2,  3
+	};
+	modm::Matrix<int16_t, 2, 3> a(m);
+	modm::Matrix<int16_t, 3, 2> b(n);
+	modm::Matrix<int16_t, 2, 2> c(o);
+
+	// a*b = {{58, 64}, {139, 154}}
+	modm::Matrix<int16_t, 2, 2> d;
+	modm::gemm<int16_t>(1, a, b, 0, &d);
+	TEST_ASSERT_TRUE(d == a * b);
+
+	modm::gemm<int16_t>(2, a, b, -3, &c);
+	TEST_ASSERT_EQUALS(c[0][0], 113);
+	TEST_ASSERT_EQUALS(c[0][1], 131);
+	TEST_ASSERT_EQUALS(c[1][0], 272);
+	TEST_ASSERT_EQUALS(c[1][1], 299);
+
+	// A*B + C*D - E in two steps
+	const float p[9] = {
+		1.f, 2.f, 0.f,
+		0.f, 1.f, 3.f,
+		4.f, 0.f, 1.f
+	};
+	modm::Matrix3f A(p);
+	modm::Matrix3f B = A.asTransposed();
+	modm::Matrix3f C = A * 0.5f;
+	modm::Matrix3f D = modm::Matrix3f::identityMatrix() * 2.f;
+	modm::Matrix3f E = B - C;
+
+	modm::Matrix3f X = E;
+	modm::gemm(1.f, A, B, -1.f, &X);
+	modm::gemm(1.f, C, D, 1.f, &X);
+	TEST_ASSERT_TRUE(X == A * B + C * D - E);
+}
+
+void
+MatrixTest::testView()
+{
+	const int16_t m[12] = {
+		1,  2,  3,  4,
+		5,  6,  7,  8,
+		9, 10, 11, 12
+	};
+	modm::Matrix<int16_t, 3, 4> a(m);
+	const modm::Matrix<int16_t, 3, 4> &ca = a;
+
+	TEST_ASSERT_TRUE(ca.rowView(1) == a.getRow(1));
+	TEST_ASSERT_TRUE(ca.columnView(2) == a.getColumn(2));
+	TEST_ASSERT_TRUE((ca.subView<2, 2>(1, 1) == a.subMatrix<2, 2>(1, 1)));
+	TEST_ASSERT_EQUALS(ca.columnView(3)[2][0], 12);
+	TEST_ASSERT_EQUALS((ca.subView<2, 3>(1, 1)[1][2]), 12);
+
+	modm::Matrix<int16_t, 3, 1> column = a.columnView(0);
+	TEST_ASSERT_EQUALS(column[1][0], 5);
+
+	// writing through the views changes the matrix
+	a.columnView(0) *= 2;
+	TEST_ASSERT_EQUALS(a[0][0], 2);
+	TEST_ASSERT_EQUALS(a[1][0], 10);
+	TEST_ASSERT_EQUALS(a[2][0], 18);
+	TEST_ASSERT_EQUALS(a[2][1], 10);
+
+	a.subView<2, 2>(0, 2) = modm::Matrix<int16_t, 2, 2>::zeroMatrix();
+	TEST_ASSERT_EQUALS(a[0][1], 2);
+	TEST_ASSERT_EQUALS(a[0][2], 0);
+	TEST_ASSERT_EQUALS(a[1][3], 0);
+	TEST_ASSERT_EQUALS(a[2][3], 12);
+
+	a.rowView(2) = a.rowView(1);
+	TEST_ASSERT_TRUE(a.getRow(2) == a.getRow(1));
+
+	a.rowView(0) += a.getRow(1);
+	TEST_ASSERT_EQUALS(a[0][0], 12);
+	TEST_ASSERT_EQUALS(a[0][1], 8);
+	TEST_ASSERT_EQUALS(a[0][3], 0);
+}
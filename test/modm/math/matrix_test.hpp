@@ -61,4 +61,16 @@ public:
 
 	void
 	testDeterminant();
+
+	void
+	testDeterminantLarge();
+
+	void
+	testInverse();
+
+	void
+	testGemm();
+
+	void
+	testView();
 };
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/utils/crc.hpp>
+
+#include "crc_test.hpp"
+
+using namespace modm::math;
+
+// The check values of the catalogue of the CRC RevEng project
+static constexpr uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+using Crc5Usb = Crc<uint8_t, 0x05, 0x1F, 0x1F, true, 5>;
+using Crc7Mmc = Crc<uint8_t, 0x09, 0x00, 0x00, false, 7>;
+using Crc8 = Crc<uint8_t, 0x07, 0x00, 0x00, false>;
+using Crc8Maxim = Crc<uint8_t, 0x31, 0x00, 0x00, true>;
+using Crc15Can = Crc<uint16_t, 0x4599, 0x0000, 0x0000, false, 15>;
+using Crc16Xmodem = Crc<uint16_t, 0x1021, 0x0000, 0x0000, false>;
+using Crc16Arc = Crc<uint16_t, 0x8005, 0x0000, 0x0000, true>;
+using Crc24OpenPgp = Crc<uint32_t, 0x864CFB, 0xB704CE, 0x000000, false, 24>;
+using Crc32Bzip2 = Crc<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false>;
+using Crc64Xz = Crc<uint64_t, 0x42F0E1EBA9EA3693, ~0ull, ~0ull, true>;
+using Crc64Ecma = Crc<uint64_t, 0x42F0E1EBA9EA3693, 0, 0, false>;
+
+// the tables are generated when compiling, so the CRC can be too
+static_assert(Crc32::compute(check, sizeof(check)) == 0xCBF43926);
+
+void
+CrcTest::testCheckValues()
+{
+	TEST_ASSERT_EQUALS(Crc5Usb::compute(check, sizeof(check)), 0x19);
+	TEST_ASSERT_EQUALS(Crc7Mmc::compute(check, sizeof(check)), 0x75);
+	TEST_ASSERT_EQUALS(Crc8::compute(check, sizeof(check)), 0xF4);
+	TEST_ASSERT_EQUALS(Crc8Ccitt::compute(check, sizeof(check)), 0xFB);
+	TEST_ASSERT_EQUALS(Crc8Maxim::compute(check, sizeof(check)), 0xA1);
+	TEST_ASSERT_EQUALS(Crc15Can::compute(check, sizeof(check)), 0x059E);
+	TEST_ASSERT_EQUALS(Crc16Xmodem::compute(check, sizeof(check)), 0x31C3);
+	TEST_ASSERT_EQUALS(Crc16Arc::compute(check, sizeof(check)), 0xBB3D);
+	TEST_ASSERT_EQUALS(Crc16Ccitt::compute(check, sizeof(check)), 0x6F91);
+	TEST_ASSERT_EQUALS(Crc24OpenPgp::compute(check, sizeof(check)), 0x21CF02u);
+	TEST_ASSERT_EQUALS(Crc32::compute(check, sizeof(check)), 0xCBF43926u);
+	TEST_ASSERT_EQUALS(Crc32Bzip2::compute(check, sizeof(check)), 0xFC891918u);
+	TEST_ASSERT_EQUALS(Crc32c::compute(check, sizeof(check)), 0xE3069283u);
+	TEST_ASSERT_TRUE(Crc64Xz::compute(check, sizeof(check)) == 0x995DC9BBDF1939FAull);
+	TEST_ASSERT_TRUE(Crc64Ecma::compute(check, sizeof(check)) == 0x6C40DF5F0B497347ull);
+}
+
+template< class Crc, class Sliced >
+static void
+testSliced(const uint8_t *data)
+{
+	// all lengths and alignments around the slice size
+	for (uint8_t offset = 0; offset < 8; offset++)
+	{
+		for (uint8_t length = 0; length < 40; length++)
+		{
+			TEST_ASSERT_TRUE(Crc::compute(data + offset, length) ==
+							 Sliced::compute(data + offset, length));
+		}
+	}
+}
+
+template< class T, T Polynomial, T Init, T XorOut, bool Reflected, uint8_t Width = sizeof(T) * 8 >
+static void
+testAllSlices(const uint8_t *data)
+{
+	using Crc1 = Crc<T, Polynomial, Init, XorOut, Reflected, Width, 1>;
+	testSliced<Crc1, Crc<T, Polynomial, Init, XorOut, Reflected, Width, 2>>(data);
+	testSliced<Crc1, Crc<T, Polynomial, Init, XorOut, Reflected, Width, 3>>(data);
+	testSliced<Crc1, Crc<T, Polynomial, Init, XorOut, Reflected, Width, 4>>(data);
+	testSliced<Crc1, Crc<T, Polynomial, Init, XorOut, Reflected, Width, 8>>(data);
+}
+
+void
+CrcTest::testSlices()
+{
+	uint8_t data[48];
+	uint32_t seed = 0x12345678;
+	for (uint8_t &byte : data)
+	{
+		seed = seed * 1664525 + 1013904223;
+		byte = seed >> 24;
+	}
+
+	testAllSlices<uint8_t, 0x05, 0x1F, 0x1F, true, 5>(data);
+	testAllSlices<uint8_t, 0x09, 0x00, 0x00, false, 7>(data);
+	testAllSlices<uint8_t, 0x07, 0xFF, 0x00, false>(data);
+	testAllSlices<uint16_t, 0x4599, 0x0000, 0x0000, false, 15>(data);
+	testAllSlices<uint16_t, 0x1021, 0xFFFF, 0x0000, true>(data);
+	testAllSlices<uint16_t, 0x1021, 0x1D0F, 0x0000, false>(data);
+	testAllSlices<uint32_t, 0x864CFB, 0xB704CE, 0x000000, false, 24>(data);
+	testAllSlices<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true>(data);
+	testAllSlices<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false>(data);
+	testAllSlices<uint64_t, 0x42F0E1EBA9EA3693, ~0ull, ~0ull, true>(data);
+	testAllSlices<uint64_t, 0x42F0E1EBA9EA3693, 0, 0, false>(data);
+}
+
+void
+CrcTest::testIncremental()
+{
+	Crc32 crc;
+	TEST_ASSERT_EQUALS(crc.value(), 0u);
+
+	crc.update(check, 4).update(check[4]).update(check + 5, 4);
+	TEST_ASSERT_EQUALS(crc.value(), 0xCBF43926u);
+
+	crc.reset();
+	for (uint8_t byte : check) crc.update(byte);
+	TEST_ASSERT_EQUALS(crc.value(), 0xCBF43926u);
+
+	Crc15Can crc15;
+	crc15.update(check, 2).update(check + 2, 7);
+	TEST_ASSERT_EQUALS(crc15.value(), 0x059E);
+}
+
+void
+CrcTest::testFunctions()
+{
+	TEST_ASSERT_EQUALS(crc16_ccitt(check, sizeof(check)), 0x6F91);
+	TEST_ASSERT_EQUALS(crc32(check, sizeof(check)), 0xCBF43926u);
+
+	uint32_t crc{crc32_init};
+	for (uint8_t byte : check) crc = crc32_update(crc, byte);
+	TEST_ASSERT_EQUALS(~crc, 0xCBF43926u);
+
+#ifndef __AVR__
+	// the bitwise implementation which the messages of AMNB depend on
+	uint8_t crc8{crc8_ccitt_init};
+	for (uint8_t byte : check)
+	{
+		crc8 ^= byte;
+		for (uint8_t ii = 0; ii < 8; ii++)
+		{
+			crc8 <<= 1;
+			if (crc8 & 0x80) crc8 ^= 0x07;
+		}
+	}
+	TEST_ASSERT_EQUALS(crc8_ccitt(check, sizeof(check)), crc8);
+	TEST_ASSERT_EQUALS(crc8_ccitt(check, sizeof(check)), 0x9B);
+#endif
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_TEST_MOCK_I2C_MASTER_HPP
+#define MODM_TEST_MOCK_I2C_MASTER_HPP
+
+#include <modm/architecture/interface/i2c_master.hpp>
+#include <modm/architecture/interface/i2c_transaction.hpp>
+
+namespace modm_test
+{
+
+namespace platform
+{
+
+/**
+ * Mock I2C master for unittests.
+ *
+ * Every transaction is executed immediately when it is started and all
+ * written bytes, including the address byte, are recorded. Read operations
+ * return zeros. With setError() every transaction ends with a bus error, like
+ * a slave that does not acknowledge.
+ *
+ * @author	Thomas Sommer
+ *
+ * @ingroup modm_test_mock_i2c_master
+ */
+class I2cMaster : public modm::I2cMaster
+{
+public:
+	static constexpr std::size_t LogSize = 2048;
+
+private:
+	static inline std::size_t transactions{0};
+	static inline std::size_t bytes{0};
+	static inline uint8_t log[LogSize];
+	static inline bool error{false};
+
+public:
+	static bool
+	start(modm::I2cTransaction *transaction, ConfigurationHandler handler = nullptr)
+	{
+		if (transaction == nullptr or not transaction->attaching()) {
+			return false;
+		}
+		if (handler) {
+			handler();
+		}
+		transactions++;
+
+		modm::I2cTransaction::Starting starting = transaction->starting();
+		record(starting.address);
+		Operation operation = Operation(starting.next);
+		while (operation != Operation::Stop)
+		{
+			switch (operation)
+			{
+				case Operation::Write:
+				{
+					const modm::I2cTransaction::Writing writing = transaction->writing();
+					for (std::size_t ii = 0; ii < writing.length; ii++) {
+						record(writing.buffer[ii]);
+					}
+					operation = Operation(writing.next);
+					break;
+				}
+				case Operation::Read:
+				{
+					const modm::I2cTransaction::Reading reading = transaction->reading();
+					for (std::size_t ii = 0; ii < reading.length; ii++) {
+						reading.buffer[ii] = 0;
+					}
+					operation = Operation(reading.next);
+					break;
+				}
+				case Operation::Restart:
+					starting = transaction->starting();
+					record(starting.address);
+					operation = Operation(starting.next);
+					break;
+				default:
+					operation = Operation::Stop;
+					break;
+			}
+		}
+
+		transaction->detaching(error ? DetachCause::ErrorCondition : DetachCause::NormalStop);
+		return true;
+	}
+
+	static Error
+	getErrorCode()
+	{
+		return error ? Error::AddressNack : Error::NoError;
+	}
+
+	static void
+	reset()
+	{
+	}
+
+public:
+	/// Number of transactions since the last clear()
+	static std::size_t
+	getTransactions()
+	{
+		return transactions;
+	}
+
+	/// Number of bytes written since the last clear(), including address bytes
+	static std::size_t
+	getBytes()
+	{
+		return bytes;
+	}
+
+	/// The first `LogSize` bytes written since the last clear()
+	static const uint8_t*
+	getLog()
+	{
+		return log;
+	}
+
+	static void
+	clear()
+	{
+		transactions = 0;
+		bytes = 0;
+	}
+
+	/// Let all following transactions fail
+	static void
+	setError(bool fail)
+	{
+		error = fail;
+	}
+
+private:
+	static void
+	record(uint8_t byte)
+	{
+		if (bytes < LogSize) {
+			log[bytes] = byte;
+		}
+		bytes++;
+	}
+};
+
+} // namespace platform
+
+} // namespace modm_test
+
+#endif // MODM_TEST_MOCK_I2C_MASTER_HPP
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2009-2012, Fabian Greif
  * Copyright (c) 2020, Sascha Schade
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -27,7 +28,7 @@ class IODevice : public modm::IODevice
 {
 public:
 	inline IODevice() :
-		bytesWritten(0) {}
+		bytesWritten(0), blocksWritten(0) {}
 
 	/// Write a single char to the buffer.
 	inline virtual void
@@ -39,6 +40,15 @@ public:
 
 	using modm::IODevice::write;
 
+	/// Write a block of chars to the buffer and count the calls.
+	inline virtual void
+	write(const char* data, std::size_t length)
+	{
+		memcpy(this->buffer + this->bytesWritten, data, length);
+		this->bytesWritten += length;
+		this->blocksWritten++;
+	}
+
 	inline virtual void
 	flush()
 	{
@@ -58,11 +68,13 @@ public:
 	{
 		memset(this->buffer, 0, this->buffer_length);
 		this->bytesWritten = 0;
+		this->blocksWritten = 0;
 	}
 
 	static constexpr std::size_t buffer_length = 100;
 	char buffer[buffer_length];
 	size_t bytesWritten;
+	size_t blocksWritten;
 };
 
 } // modm_test::platform namespace
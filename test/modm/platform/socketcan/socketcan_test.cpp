@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "socketcan_test.hpp"
+
+#include <sys/socket.h>
+#include <time.h>
+#include <vector>
+
+void
+SocketCanTest::setUp()
+{
+	// datagram boundaries are preserved like on a CAN socket
+	int sockets[2];
+	TEST_ASSERT_EQUALS(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets), 0);
+	TEST_ASSERT_TRUE(can0.attach(sockets[0]));
+	TEST_ASSERT_TRUE(can1.attach(sockets[1]));
+}
+
+void
+SocketCanTest::tearDown()
+{
+	can0.close();
+	can1.close();
+}
+
+void
+SocketCanTest::testClassic()
+{
+	TEST_ASSERT_FALSE(can1.isMessageAvailable());
+
+	modm::can::Message message(0x12345678, 7);
+	for (uint8_t ii = 0; ii < 7; ++ii) {
+		message.data[ii] = 0xa0 + ii;
+	}
+	TEST_ASSERT_TRUE(can0.sendMessage(message));
+
+	modm::can::Message standard(0x123, 0);
+	standard.setExtended(false);
+	standard.setRemoteTransmitRequest();
+	TEST_ASSERT_TRUE(can0.sendMessage(standard));
+
+	modm::can::Message received;
+	TEST_ASSERT_TRUE(can1.isMessageAvailable());
+	TEST_ASSERT_TRUE(can1.getMessage(received));
+	TEST_ASSERT_EQUALS(received.getIdentifier(), 0x12345678U);
+	TEST_ASSERT_EQUALS(received.getLength(), 7U);
+	TEST_ASSERT_TRUE(received.isExtended());
+	TEST_ASSERT_FALSE(received.isRemoteTransmitRequest());
+	TEST_ASSERT_FALSE(received.isFlexibleData());
+	TEST_ASSERT_TRUE(received == message);
+
+	TEST_ASSERT_TRUE(can1.getMessage(received));
+	TEST_ASSERT_EQUALS(received.getIdentifier(), 0x123U);
+	TEST_ASSERT_FALSE(received.isExtended());
+	TEST_ASSERT_TRUE(received.isRemoteTransmitRequest());
+
+	TEST_ASSERT_FALSE(can1.isMessageAvailable());
+	TEST_ASSERT_FALSE(can1.getMessage(received));
+}
+
+void
+SocketCanTest::testFlexibleData()
+{
+	if constexpr (modm::can::Message::capacity <= 8) {
+		return;
+	}
+
+	modm::can::Message message(0x1abcdef, 64);
+	message.setBitRateSwitching();
+	for (uint8_t ii = 0; ii < 64; ++ii) {
+		message.data[ii] = ii;
+	}
+	TEST_ASSERT_TRUE(message.isFlexibleData());
+	TEST_ASSERT_TRUE(can1.sendMessage(message));
+
+	// 8 bytes in the CAN FD frame format
+	modm::can::Message short_message(0x42, 8);
+	short_message.setExtended(false);
+	short_message.setFlexibleData();
+	TEST_ASSERT_TRUE(can1.sendMessage(short_message));
+
+	modm::can::Message received;
+	TEST_ASSERT_TRUE(can0.getMessage(received));
+	TEST_ASSERT_EQUALS(received.getLength(), 64U);
+	TEST_ASSERT_EQUALS(received.getDataLengthCode(), 15U);
+	TEST_ASSERT_TRUE(received.isFlexibleData());
+	TEST_ASSERT_TRUE(received.isBitRateSwitching());
+	TEST_ASSERT_TRUE(received == message);
+
+	TEST_ASSERT_TRUE(can0.getMessage(received));
+	TEST_ASSERT_EQUALS(received.getIdentifier(), 0x42U);
+	TEST_ASSERT_EQUALS(received.getLength(), 8U);
+	TEST_ASSERT_TRUE(received.isFlexibleData());
+	TEST_ASSERT_FALSE(received.isBitRateSwitching());
+}
+
+void
+SocketCanTest::testBatches()
+{
+	// more than one batch with a partially filled last batch
+	constexpr std::size_t count = 2 * modm::platform::SocketCan::BatchSize + 5;
+	std::vector<modm::can::Message> messages;
+	for (std::size_t ii = 0; ii < count; ++ii)
+	{
+		modm::can::Message message(0x100 + ii, ii % 9);
+		message.setExtended(false);
+		std::fill_n(message.data, message.length, uint8_t(ii));
+		messages.push_back(message);
+	}
+	TEST_ASSERT_EQUALS(can0.sendMessages(messages), count);
+	TEST_ASSERT_EQUALS(can0.sendMessages({}), 0U);
+
+	// single messages are received in order across batches
+	modm::can::Message received;
+	for (std::size_t ii = 0; ii < count; ++ii)
+	{
+		TEST_ASSERT_TRUE(can1.getMessage(received));
+		TEST_ASSERT_TRUE(received == messages[ii]);
+	}
+	TEST_ASSERT_FALSE(can1.getMessage(received));
+
+	// a batch started before is continued after new frames arrive
+	TEST_ASSERT_EQUALS(can0.sendMessages({messages.data(), 3}), 3U);
+	TEST_ASSERT_TRUE(can1.getMessage(received));
+	TEST_ASSERT_TRUE(received == messages[0]);
+	TEST_ASSERT_TRUE(can0.sendMessage(messages[3]));
+	for (std::size_t ii = 1; ii < 4; ++ii)
+	{
+		TEST_ASSERT_TRUE(can1.getMessage(received));
+		TEST_ASSERT_TRUE(received == messages[ii]);
+	}
+	TEST_ASSERT_FALSE(can1.isMessageAvailable());
+}
+
+void
+SocketCanTest::testWait()
+{
+	using namespace std::chrono_literals;
+
+	TEST_ASSERT_TRUE(can1.getFileDescriptor() >= 0);
+	TEST_ASSERT_FALSE(can1.waitForMessage(1ms));
+
+	modm::can::Message message(0x42, 1);
+	TEST_ASSERT_TRUE(can0.sendMessage(message));
+	TEST_ASSERT_TRUE(can0.sendMessage(message));
+	TEST_ASSERT_TRUE(can1.waitForMessage(100ms));
+
+	// the second message is already buffered, the socket is not readable
+	modm::can::Message received;
+	TEST_ASSERT_TRUE(can1.getMessage(received));
+	TEST_ASSERT_TRUE(can1.waitForMessage(0ms));
+	TEST_ASSERT_TRUE(can1.getMessage(received));
+	TEST_ASSERT_FALSE(can1.waitForMessage(0ms));
+
+	can1.close();
+	TEST_ASSERT_EQUALS(can1.getFileDescriptor(), -1);
+	TEST_ASSERT_FALSE(can1.isMessageAvailable());
+}
+
+void
+SocketCanTest::testTimestamp()
+{
+	// a socketpair does not provide kernel timestamps, so the receive time
+	// of the batch is used instead
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	const auto before = std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+
+	modm::can::Message message(0x42, 1);
+	TEST_ASSERT_TRUE(can0.sendMessage(message));
+	TEST_ASSERT_TRUE(can0.sendMessage(message));
+
+	modm::can::Message received;
+	modm::platform::SocketCan::Timestamp first{}, second{};
+	TEST_ASSERT_TRUE(can1.getMessage(received, &first));
+	TEST_ASSERT_TRUE(can1.getMessage(received, &second));
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	const auto after = std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+
+	TEST_ASSERT_TRUE(first >= before);
+	TEST_ASSERT_TRUE(first <= second);
+	TEST_ASSERT_TRUE(second <= after);
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+#include <modm/platform/can/socketcan.hpp>
+
+/// Exchanges frames between two SocketCan instances connected by a
+/// `socketpair()`, so that no (virtual) CAN interface is required.
+/// @ingroup modm_test_test_platform_socketcan
+class SocketCanTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp() override;
+
+	void
+	tearDown() override;
+
+	void
+	testClassic();
+
+	void
+	testFlexibleData();
+
+	void
+	testBatches();
+
+	void
+	testWait();
+
+	void
+	testTimestamp();
+
+private:
+	modm::platform::SocketCan can0;
+	modm::platform::SocketCan can1;
+};
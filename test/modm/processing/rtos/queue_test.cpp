@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <chrono>
+#include <thread>
+#include <modm/processing/rtos.hpp>
+
+#include "queue_test.hpp"
+
+namespace
+{
+using namespace std::chrono_literals;
+
+/// Not default-constructible, counts the living instances
+struct Item
+{
+	static inline int alive{0};
+
+	explicit Item(int value) : value(value) { alive++; }
+	Item(const Item& other) : value(other.value) { alive++; }
+	Item& operator = (const Item&) = default;
+	~Item() { alive--; }
+
+	int value;
+};
+}
+
+void
+QueueTest::testOrder()
+{
+	modm::rtos::Queue<int> queue(3);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+
+	TEST_ASSERT_TRUE(queue.append(2));
+	TEST_ASSERT_TRUE(queue.append(3));
+	TEST_ASSERT_TRUE(queue.prepend(1));
+	TEST_ASSERT_EQUALS(queue.getSize(), 3U);
+
+	int value{0};
+	TEST_ASSERT_TRUE(queue.peek(value));
+	TEST_ASSERT_EQUALS(value, 1);
+	TEST_ASSERT_EQUALS(queue.getSize(), 3U);
+
+	// wrap around the end of the ring buffer in both directions
+	for (int ii = 1; ii <= 3; ++ii)
+	{
+		TEST_ASSERT_TRUE(queue.get(value));
+		TEST_ASSERT_EQUALS(value, ii);
+		TEST_ASSERT_TRUE(queue.append(ii + 3));
+	}
+	TEST_ASSERT_TRUE(queue.get(value));
+	TEST_ASSERT_TRUE(queue.prepend(10));
+	TEST_ASSERT_TRUE(queue.get(value));
+	TEST_ASSERT_EQUALS(value, 10);
+	TEST_ASSERT_TRUE(queue.get(value));
+	TEST_ASSERT_EQUALS(value, 5);
+	TEST_ASSERT_TRUE(queue.get(value));
+	TEST_ASSERT_EQUALS(value, 6);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+}
+
+void
+QueueTest::testNonBlocking()
+{
+	modm::rtos::Queue<int> queue(2);
+	int value{0};
+
+	TEST_ASSERT_FALSE(queue.getFromInterrupt(value));
+	TEST_ASSERT_FALSE(queue.peek(value, 0));
+
+	TEST_ASSERT_TRUE(queue.appendFromInterrupt(1));
+	TEST_ASSERT_TRUE(queue.prependFromInterrupt(0));
+	TEST_ASSERT_FALSE(queue.appendFromInterrupt(2));
+	TEST_ASSERT_FALSE(queue.prepend(2, 0));
+	TEST_ASSERT_EQUALS(queue.getSize(), 2U);
+
+	TEST_ASSERT_TRUE(queue.getFromInterrupt(value));
+	TEST_ASSERT_EQUALS(value, 0);
+}
+
+void
+QueueTest::testTimeout()
+{
+	modm::rtos::Queue<int> queue(1);
+	int value{0};
+
+	auto start = std::chrono::steady_clock::now();
+	TEST_ASSERT_FALSE(queue.get(value, 20));
+	TEST_ASSERT_TRUE(std::chrono::steady_clock::now() - start >= 20ms);
+
+	TEST_ASSERT_TRUE(queue.append(1, 20));
+	start = std::chrono::steady_clock::now();
+	TEST_ASSERT_FALSE(queue.append(2, 20));
+	TEST_ASSERT_TRUE(std::chrono::steady_clock::now() - start >= 20ms);
+	TEST_ASSERT_EQUALS(queue.getSize(), 1U);
+}
+
+void
+QueueTest::testBlockingGet()
+{
+	modm::rtos::Queue<int> queue(1);
+
+	std::thread producer([&queue]
+	{
+		std::this_thread::sleep_for(10ms);
+		queue.append(42);
+	});
+
+	// blocks until the producer appended an item
+	int value{0};
+	TEST_ASSERT_TRUE(queue.get(value));
+	producer.join();
+	TEST_ASSERT_EQUALS(value, 42);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+}
+
+void
+QueueTest::testBlockingAppend()
+{
+	modm::rtos::Queue<int> queue(1);
+	TEST_ASSERT_TRUE(queue.append(1));
+
+	std::thread consumer([&queue]
+	{
+		std::this_thread::sleep_for(10ms);
+		int value;
+		queue.get(value);
+	});
+
+	// blocks until the consumer made room
+	TEST_ASSERT_TRUE(queue.append(2, 1000));
+	consumer.join();
+
+	int value{0};
+	TEST_ASSERT_TRUE(queue.get(value, 0));
+	TEST_ASSERT_EQUALS(value, 2);
+}
+
+void
+QueueTest::testItemLifetime()
+{
+	{
+		modm::rtos::Queue<Item> queue(4);
+		TEST_ASSERT_EQUALS(Item::alive, 0);
+
+		queue.append(Item(1));
+		queue.prepend(Item(0));
+		queue.append(Item(2));
+		TEST_ASSERT_EQUALS(Item::alive, 3);
+
+		Item item(-1);
+		TEST_ASSERT_TRUE(queue.get(item));
+		TEST_ASSERT_EQUALS(item.value, 0);
+		TEST_ASSERT_EQUALS(Item::alive, 3);
+		TEST_ASSERT_TRUE(queue.peek(item));
+		TEST_ASSERT_EQUALS(item.value, 1);
+		TEST_ASSERT_EQUALS(Item::alive, 3);
+	}
+	// the remaining items are destroyed with the queue
+	TEST_ASSERT_EQUALS(Item::alive, 0);
+}
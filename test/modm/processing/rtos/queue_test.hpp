@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Tests the stdlib implementation, only available on hosted targets.
+/// @ingroup modm_test_test_processing
+class QueueTest : public unittest::TestSuite
+{
+public:
+	void
+	testOrder();
+
+	void
+	testNonBlocking();
+
+	void
+	testTimeout();
+
+	void
+	testBlockingGet();
+
+	void
+	testBlockingAppend();
+
+	void
+	testItemLifetime();
+};
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, Thomas Sommer
  *
  * This file is part of the modm project.
  *
@@ -90,3 +91,120 @@ SchedulerTest::testScheduler()
 	TEST_ASSERT_EQUALS(task3.order, 3);
 	TEST_ASSERT_EQUALS(task4.order, 1);
 }
+
+void
+SchedulerTest::testPeriods()
+{
+	modm::Scheduler scheduler;
+
+	TestTask task1;
+	TestTask task2;
+	TestTask task3;
+
+	TEST_ASSERT_TRUE(scheduler.scheduleTask(task1, 2, 10));
+	TEST_ASSERT_TRUE(scheduler.scheduleTask(task2, 5, 20));
+	TEST_ASSERT_TRUE(scheduler.scheduleTask(task3, 100'000, 30));
+
+	uint32_t runs1 = 0, runs2 = 0;
+	for (uint32_t tick = 1; tick <= 100'000; tick++)
+	{
+		count = 1;
+		task1.order = 0;
+		task2.order = 0;
+		task3.order = 0;
+
+		scheduler.schedule();
+
+		runs1 += (task1.order != 0);
+		runs2 += (task2.order != 0);
+		TEST_ASSERT_EQUALS(task1.order != 0, tick % 2 == 0);
+		TEST_ASSERT_EQUALS(task2.order != 0, tick % 5 == 0);
+		TEST_ASSERT_EQUALS(task3.order != 0, tick == 100'000);
+	}
+	TEST_ASSERT_EQUALS(runs1, 50'000u);
+	TEST_ASSERT_EQUALS(runs2, 20'000u);
+
+	// higher priority first
+	TEST_ASSERT_EQUALS(task3.order, 1);
+	TEST_ASSERT_EQUALS(task2.order, 2);
+	TEST_ASSERT_EQUALS(task1.order, 3);
+}
+
+void
+SchedulerTest::testRemoveTask()
+{
+	modm::Scheduler scheduler;
+
+	TestTask task1;
+	TestTask task2;
+	TestTask task3;
+
+	scheduler.scheduleTask(task1, 1, 10);
+	scheduler.scheduleTask(task2, 1, 20);
+	scheduler.scheduleTask(task3, 1, 30);
+
+	TEST_ASSERT_TRUE(scheduler.removeTask(task2));
+	TEST_ASSERT_FALSE(scheduler.removeTask(task2));
+
+	count = 1;
+	scheduler.schedule();
+
+	TEST_ASSERT_EQUALS(task1.order, 2);
+	TEST_ASSERT_EQUALS(task2.order, 0);
+	TEST_ASSERT_EQUALS(task3.order, 1);
+
+	TEST_ASSERT_TRUE(scheduler.removeTask(task3));
+	TEST_ASSERT_TRUE(scheduler.removeTask(task1));
+
+	count = 1;
+	task1.order = 0;
+	task3.order = 0;
+	scheduler.schedule();
+
+	TEST_ASSERT_EQUALS(task1.order, 0);
+	TEST_ASSERT_EQUALS(task3.order, 0);
+
+	// a removed task can be added again
+	TEST_ASSERT_TRUE(scheduler.scheduleTask(task2, 1));
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(task2.order, 1);
+}
+
+// ----------------------------------------------------------------------------
+class RemovingTask : public modm::Scheduler::Task
+{
+public:
+	RemovingTask(modm::Scheduler& scheduler) :
+		scheduler(scheduler), runs(0), removed(false)
+	{
+	}
+
+	virtual void
+	run()
+	{
+		runs++;
+		removed = scheduler.removeTask(*this);
+	}
+
+	modm::Scheduler& scheduler;
+	uint8_t runs;
+	bool removed;
+};
+
+void
+SchedulerTest::testRemoveRunningTask()
+{
+	modm::Scheduler scheduler;
+
+	RemovingTask task(scheduler);
+	scheduler.scheduleTask(task, 1);
+
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(task.runs, 1);
+	TEST_ASSERT_TRUE(task.removed);
+
+	scheduler.schedule();
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(task.runs, 1);
+	TEST_ASSERT_FALSE(scheduler.removeTask(task));
+}
@@ -19,4 +19,13 @@ class SchedulerTest : public unittest::TestSuite
 public:
 	void
 	testScheduler();
+
+	void
+	testPeriods();
+
+	void
+	testRemoveTask();
+
+	void
+	testRemoveRunningTask();
 };
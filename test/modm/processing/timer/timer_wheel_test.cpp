@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "timer_wheel_test.hpp"
+#include <modm/processing/timer.hpp>
+#include <modm-test/mock/clock.hpp>
+
+using namespace std::chrono_literals;
+using test_clock = modm_test::chrono::milli_clock;
+
+void
+TimerWheelTest::setUp()
+{
+	test_clock::setTime(0);
+}
+
+void
+TimerWheelTest::testTimeout()
+{
+	modm::TimerWheel wheel;
+	modm::TimerWheel::Timeout timeout{wheel};
+
+	TEST_ASSERT_TRUE(timeout.isStopped());
+	TEST_ASSERT_FALSE(timeout.execute());
+
+	timeout.restart(10ms);
+	TEST_ASSERT_TRUE(timeout.isArmed());
+	TEST_ASSERT_EQUALS(wheel.size(), 1u);
+
+	test_clock::setTime(9);
+	TEST_ASSERT_EQUALS(wheel.update(), 0u);
+	TEST_ASSERT_TRUE(timeout.isArmed());
+	TEST_ASSERT_EQUALS(timeout.remaining(), 1ms);
+
+	// expires only with the update of the wheel
+	test_clock::setTime(10);
+	TEST_ASSERT_FALSE(timeout.execute());
+	TEST_ASSERT_EQUALS(wheel.update(), 1u);
+	TEST_ASSERT_EQUALS(wheel.size(), 0u);
+	TEST_ASSERT_EQUALS(timeout.state(), modm::TimerState::Expired);
+	TEST_ASSERT_TRUE(timeout.execute());
+	TEST_ASSERT_FALSE(timeout.execute());
+	TEST_ASSERT_TRUE(timeout.isExpired());
+
+	test_clock::setTime(15);
+	TEST_ASSERT_EQUALS(timeout.remaining(), -5ms);
+
+	timeout.restart();
+	test_clock::setTime(20);
+	timeout.stop();
+	TEST_ASSERT_EQUALS(wheel.size(), 0u);
+	test_clock::setTime(30);
+	TEST_ASSERT_EQUALS(wheel.update(), 0u);
+	TEST_ASSERT_TRUE(timeout.isStopped());
+	TEST_ASSERT_FALSE(timeout.execute());
+
+	// zero duration expires immediately
+	timeout.restart(0ms);
+	TEST_ASSERT_TRUE(timeout.isExpired());
+	TEST_ASSERT_TRUE(timeout.execute());
+
+	{
+		modm::TimerWheel::Timeout other{wheel, 1s};
+		TEST_ASSERT_EQUALS(wheel.size(), 1u);
+	}
+	TEST_ASSERT_EQUALS(wheel.size(), 0u);
+}
+
+void
+TimerWheelTest::testPeriodicTimer()
+{
+	modm::TimerWheel wheel;
+	modm::TimerWheel::PeriodicTimer timer{wheel, 10ms};
+
+	test_clock::setTime(9);
+	wheel.update();
+	TEST_ASSERT_EQUALS(timer.execute(), 0u);
+
+	test_clock::setTime(10);
+	wheel.update();
+	TEST_ASSERT_EQUALS(timer.execute(), 1u);
+	TEST_ASSERT_EQUALS(timer.execute(), 0u);
+	TEST_ASSERT_TRUE(timer.isArmed());
+
+	// late updates count the missed periods
+	test_clock::setTime(45);
+	TEST_ASSERT_EQUALS(wheel.update(), 3u);
+	TEST_ASSERT_TRUE(timer.isExpired());
+	TEST_ASSERT_EQUALS(timer.execute(), 3u);
+
+	// the period stays accurate
+	test_clock::setTime(49);
+	wheel.update();
+	TEST_ASSERT_EQUALS(timer.execute(), 0u);
+	test_clock::setTime(50);
+	wheel.update();
+	TEST_ASSERT_EQUALS(timer.execute(), 1u);
+
+	timer.stop();
+	test_clock::setTime(100);
+	wheel.update();
+	TEST_ASSERT_EQUALS(timer.execute(), 0u);
+	TEST_ASSERT_TRUE(timer.isStopped());
+}
+
+// ----------------------------------------------------------------------------
+template< class Wheel >
+class CountingEntry final : public Wheel::Entry
+{
+public:
+	using Wheel::Entry::Entry;
+
+	uint32_t time{0};
+	uint32_t count{0};
+
+protected:
+	void
+	expired() override
+	{
+		time = modm::Clock::now().time_since_epoch().count();
+		count++;
+	}
+};
+
+void
+TimerWheelTest::testEntry()
+{
+	modm::TimerWheel wheel;
+	CountingEntry<modm::TimerWheel> entry1{wheel};
+	CountingEntry<modm::TimerWheel> entry2{wheel};
+
+	wheel.insert(entry1, modm::TimerWheel::duration{100});
+	wheel.insert(entry2, modm::TimerWheel::duration{100});
+	TEST_ASSERT_TRUE(entry1.isLinked());
+
+	// rearming replaces the old expiration
+	wheel.insert(entry1, modm::TimerWheel::duration{200});
+	wheel.remove(entry2);
+	TEST_ASSERT_FALSE(entry2.isLinked());
+	TEST_ASSERT_EQUALS(wheel.size(), 1u);
+
+	for (uint32_t time = 1; time <= 300; time++)
+	{
+		test_clock::setTime(time);
+		wheel.update();
+	}
+	TEST_ASSERT_EQUALS(entry1.count, 1u);
+	TEST_ASSERT_EQUALS(entry1.time, 200u);
+	TEST_ASSERT_EQUALS(entry2.count, 0u);
+	TEST_ASSERT_FALSE(entry1.isLinked());
+
+	// an empty wheel that was not updated for a long time starts at the
+	// current time again
+	test_clock::setTime(0x9000'0000);
+	wheel.insert(entry1, modm::TimerWheel::duration{10});
+	test_clock::setTime(0x9000'0009);
+	TEST_ASSERT_EQUALS(wheel.update(), 0u);
+	test_clock::setTime(0x9000'000a);
+	TEST_ASSERT_EQUALS(wheel.update(), 1u);
+	TEST_ASSERT_EQUALS(entry1.count, 2u);
+	TEST_ASSERT_EQUALS(entry1.time, 0x9000'000au);
+}
+
+template< class Wheel >
+static void
+testWheelExpiration(uint32_t start)
+{
+	static constexpr uint32_t intervals[] = {
+		1, 2, 3, 15, 16, 17, 63, 64, 65, 127, 128, 255, 256, 257, 1000, 4095, 4096,
+		4097, 65'535, 65'536, 100'000, 262'143, 262'144, 1'000'000, 16'777'215,
+		16'777'216, 20'000'000};
+	constexpr uint8_t Entries = std::size(intervals);
+
+	test_clock::setTime(start);
+	Wheel wheel;
+	CountingEntry<Wheel> *entries[Entries];
+	for (uint8_t ii = 0; ii < Entries; ii++)
+	{
+		// stagger the start times
+		test_clock::setTime(start + ii);
+		entries[ii] = new CountingEntry<Wheel>(wheel);
+		wheel.insert(*entries[ii], typename Wheel::duration{intervals[ii]});
+	}
+
+	// the intervals are sorted, so the entries expire in order
+	for (uint8_t ii = 0; ii < Entries; ii++)
+	{
+		const uint32_t time = start + ii + intervals[ii];
+		test_clock::setTime(time - 1);
+		wheel.update();
+		TEST_ASSERT_EQUALS(entries[ii]->count, 0u);
+
+		test_clock::setTime(time);
+		wheel.update();
+		TEST_ASSERT_EQUALS(entries[ii]->count, 1u);
+		TEST_ASSERT_EQUALS(entries[ii]->time, time);
+		TEST_ASSERT_EQUALS(wheel.size(), Entries - 1u - ii);
+	}
+	for (uint8_t ii = 0; ii < Entries; ii++) {
+		delete entries[ii];
+	}
+}
+
+void
+TimerWheelTest::testExpiration()
+{
+	testWheelExpiration<modm::TimerWheel>(0);
+	testWheelExpiration<modm::TimerWheel>(0xffff'ff00);
+	testWheelExpiration<modm::GenericTimerWheel<modm::Clock, 8, 4>>(123'456);
+	testWheelExpiration<modm::GenericTimerWheel<modm::Clock, 2, 3>>(0xffff'fff0);
+	testWheelExpiration<modm::GenericTimerWheel<modm::Clock, 4, 1>>(7);
+}
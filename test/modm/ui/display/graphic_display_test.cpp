@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026, Thomas Sommer
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/ui/display/monochrome_graphic_display_horizontal.hpp>
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+
+#include "graphic_display_test.hpp"
+
+using modm::glcd::Point;
+
+constexpr uint16_t Width = 48;
+constexpr uint16_t Height = 32;
+
+// Only implements the pixel access, so every drawing function uses the
+// default implementation drawing pixel by pixel.
+class ReferenceDisplay : public modm::GraphicDisplay<Width, Height>
+{
+public:
+	std::size_t getBufferWidth() const final { return Width; }
+	std::size_t getBufferHeight() const final { return Height; }
+	void clear() final { std::fill(&pixels[0][0], &pixels[0][0] + sizeof(pixels), false); }
+	void update() final {}
+
+	bool
+	getPixel(Point pos) const
+	{ return pointOnScreen(pos) and pixels[pos.y][pos.x]; }
+
+protected:
+	void setPixelFast(Point pos) final { pixels[pos.y][pos.x] = true; }
+	void clearPixelFast(Point pos) final { pixels[pos.y][pos.x] = false; }
+	void setClipping(Point, Point) final {}
+
+	bool pixels[Height][Width] = {};
+};
+
+class VerticalDisplay : public modm::MonochromeGraphicDisplayVertical<Width, Height>
+{
+public:
+	// like a driver, which transfers the modified part of the buffer
+	void update() final { for (std::size_t row = 0; row < Height / 8; row++) this->takeDirty(row); }
+
+protected:
+	void setClipping(Point, Point) final {}
+};
+
+class HorizontalDisplay : public modm::MonochromeGraphicDisplayHorizontal<Width, Height>
+{
+public:
+	// like a driver, which transfers the modified part of the buffer
+	void update() final { for (std::size_t row = 0; row < Height; row++) this->takeDirty(row); }
+
+protected:
+	void setClipping(Point, Point) final {}
+};
+
+static ReferenceDisplay reference;
+static VerticalDisplay vertical;
+static HorizontalDisplay horizontal;
+
+template< typename Function >
+static void
+draw(Function&& function)
+{
+	function(reference);
+	function(vertical);
+	function(horizontal);
+}
+
+static void
+clear()
+{
+	draw([](auto& display) { display.clear(); });
+	draw([](auto& display) { display.update(); });
+}
+
+// number of pixels different from the reference display
+template< class Display >
+static std::size_t
+compare(const Display& display)
+{
+	std::size_t errors = 0;
+	for (int16_t y = 0; y < int16_t(Height); y++) {
+		for (int16_t x = 0; x < int16_t(Width); x++) {
+			if (display.getPixel({x, y}) != reference.getPixel({x, y})) errors++;
+		}
+	}
+	return errors;
+}
+
+static std::size_t
+count()
+{
+	std::size_t pixels = 0;
+	for (int16_t y = 0; y < int16_t(Height); y++) {
+		for (int16_t x = 0; x < int16_t(Width); x++) {
+			pixels += reference.getPixel({x, y});
+		}
+	}
+	return pixels;
+}
+
+// ----------------------------------------------------------------------------
+void
+GraphicDisplayTest::testFillRectangle()
+{
+	clear();
+	draw([](auto& display) { display.fillRectangle({3, 5}, 10, 12); });
+	TEST_ASSERT_EQUALS(count(), 120u);
+	TEST_ASSERT_FALSE(reference.getPixel({2, 5}));
+	TEST_ASSERT_TRUE(reference.getPixel({3, 5}));
+	TEST_ASSERT_TRUE(reference.getPixel({12, 16}));
+	TEST_ASSERT_FALSE(reference.getPixel({13, 16}));
+	TEST_ASSERT_FALSE(reference.getPixel({12, 17}));
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+
+	// within a single page and a single byte
+	clear();
+	draw([](auto& display) { display.fillRectangle({9, 9}, 5, 3); });
+	TEST_ASSERT_EQUALS(count(), 15u);
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+
+	// clipped at all borders
+	clear();
+	draw([](auto& display) { display.fillRectangle({-5, -3}, 8, 6); });
+	draw([](auto& display) { display.fillRectangle({40, 29}, 20, 20); });
+	draw([](auto& display) { display.fillRectangle({-10, 20}, 100, 1); });
+	TEST_ASSERT_EQUALS(count(), 3u * 3u + 8u * 3u + 48u);
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+
+	// completely outside
+	clear();
+	draw([](auto& display) { display.fillRectangle({-10, 0}, 10, 10); });
+	draw([](auto& display) { display.fillRectangle({0, 32}, 10, 10); });
+	TEST_ASSERT_EQUALS(count(), 0u);
+	TEST_ASSERT_FALSE(vertical.isDirty());
+	TEST_ASSERT_FALSE(horizontal.isDirty());
+
+	clear();
+	draw([](auto& display) { display.fillRectangle({0, 0}, Width, Height); });
+	TEST_ASSERT_EQUALS(count(), std::size_t(Width * Height));
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+}
+
+void
+GraphicDisplayTest::testLine()
+{
+	clear();
+	draw([](auto& display) { display.drawLine({2, 3}, {40, 11}); });
+	TEST_ASSERT_EQUALS(count(), 39u);
+	TEST_ASSERT_TRUE(reference.getPixel({2, 3}));
+	TEST_ASSERT_TRUE(reference.getPixel({40, 11}));
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+
+	clear();
+	draw([](auto& display) { display.drawLine({30, 2}, {25, 30}); });
+	TEST_ASSERT_EQUALS(count(), 29u);
+	TEST_ASSERT_TRUE(reference.getPixel({30, 2}));
+	TEST_ASSERT_TRUE(reference.getPixel({25, 30}));
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+
+	// horizontal, vertical and partially outside of the screen
+	clear();
+	draw([](auto& display) { display.drawLine({-5, 7}, {20, 7}); });
+	draw([](auto& display) { display.drawLine({45, -4}, {45, 40}); });
+	draw([](auto& display) { display.drawLine({-8, 40}, {50, -10}); });
+	draw([](auto& display) { display.drawLine({10, -20}, {30, 50}); });
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+
+	clear();
+	draw([](auto& display) {
+		for (int16_t i = 0; i < 48; i += 3) display.drawLine({24, 16}, {i, 0});
+		for (int16_t i = 0; i < 32; i += 3) display.drawLine({24, 16}, {47, i});
+	});
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+}
+
+void
+GraphicDisplayTest::testImage()
+{
+	// 12x12 pixels, two pages of 12 bytes
+	static const uint8_t image[] = {
+		0xff, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xaa, 0x55, 0xff,
+		0x0f, 0x08, 0x08, 0x08, 0x08, 0x00, 0x01, 0x02, 0x04, 0x0a, 0x05, 0x0f,
+	};
+	const auto data = modm::accessor::asFlash(image);
+
+	const Point positions[] = {
+		{0, 0}, {5, 8}, {7, 3}, {20, 13}, {-4, -5}, {-3, 6}, {40, 25}, {44, -9}, {-11, -11},
+	};
+	for (const Point pos : positions)
+	{
+		for (const uint16_t height : {12u, 8u, 5u})
+		{
+			// the image must replace the background
+			clear();
+			draw([](auto& display) { display.fillRectangle({0, 0}, Width, Height); });
+			draw([&](auto& display) { display.drawImageRaw(pos, 12, height, data); });
+			TEST_ASSERT_EQUALS(compare(vertical), 0u);
+			TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+		}
+	}
+
+	clear();
+	draw([&](auto& display) { display.drawImageRaw({5, 9}, 12, 12, data); });
+	TEST_ASSERT_TRUE(reference.getPixel({5, 9}));
+	TEST_ASSERT_TRUE(reference.getPixel({5, 20}));
+	TEST_ASSERT_FALSE(reference.getPixel({6, 10}));
+	TEST_ASSERT_TRUE(reference.getPixel({16, 20}));
+	TEST_ASSERT_FALSE(reference.getPixel({16, 21}));
+
+	// completely outside
+	clear();
+	draw([&](auto& display) { display.drawImageRaw({48, 0}, 12, 12, data); });
+	draw([&](auto& display) { display.drawImageRaw({0, -12}, 12, 12, data); });
+	TEST_ASSERT_EQUALS(count(), 0u);
+	TEST_ASSERT_FALSE(vertical.isDirty());
+	TEST_ASSERT_FALSE(horizontal.isDirty());
+}
+
+void
+GraphicDisplayTest::testText()
+{
+	clear();
+	draw([](auto& display) {
+		display.setCursor({1, 3});
+		display << "modm";
+		display.setCursor({-2, 26});
+		display << 1234567890;
+	});
+	TEST_ASSERT_TRUE(count() > 0);
+	TEST_ASSERT_EQUALS(compare(vertical), 0u);
+	TEST_ASSERT_EQUALS(compare(horizontal), 0u);
+}
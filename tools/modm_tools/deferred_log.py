@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026, Thomas Sommer
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+"""
+### Deferred Logging
+
+The `modm::log::DeferredLogger` sends binary records with `transmit()`, which
+only contain the address of the format string, a timestamp and the raw
+arguments. The records are decoded on the host with the format strings from the
+ELF file of the firmware:
+
+```sh
+python3 modm/modm_tools/deferred_log.py path/to/project.elf log.bin
+```
+
+The records can also be read from a serial port in raw mode:
+
+```sh
+stty -F /dev/ttyUSB0 raw 115200
+python3 modm/modm_tools/deferred_log.py path/to/project.elf /dev/ttyUSB0
+```
+
+Corrupted records are skipped until the next valid record.
+"""
+
+import re
+import struct
+import sys
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+
+SYNC = 0xA5
+ARGUMENT_SIZE = 24
+LEVELS = ["Debug:   ", "Info:    ", "Warning: ", "Error:   "]
+STRING = 6
+FLOATS = (4, 5)
+WIDE = (2, 3)
+TYPES = {0: "i", 1: "I", 2: "q", 3: "Q", 4: "f", 5: "d"}
+SPECIFICATION = re.compile(r"%([-+ #0-9.]*)[hljztL]*(.)", flags=re.DOTALL)
+
+
+class FormatStrings:
+    """Reads the format strings from the allocated sections of an ELF file."""
+    def __init__(self, source):
+        self.sections = []
+        with open(source, "rb") as src:
+            elf = ELFFile(src)
+            self.pointer_size = 8 if elf.elfclass == 64 else 4
+            self.endian = "<" if elf.little_endian else ">"
+            for section in elf.iter_sections():
+                if (section["sh_type"] == "SHT_PROGBITS" and section["sh_addr"] and
+                        section["sh_flags"] & SH_FLAGS.SHF_ALLOC):
+                    self.sections.append((section["sh_addr"], section.data()))
+
+    def get(self, address):
+        for start, data in self.sections:
+            if start <= address < start + len(data):
+                end = data.find(b"\0", address - start)
+                if end < 0:
+                    return None
+                return data[address - start:end].decode("utf-8", errors="replace")
+        return None
+
+
+def parse_arguments(data, endian):
+    """Returns a list of (type, value) tuples or None if the data is corrupt."""
+    arguments = []
+    index = 0
+    while index < len(data):
+        kind = data[index]
+        index += 1
+        if kind == STRING:
+            if index >= len(data):
+                return None
+            length = data[index]
+            value = bytes(data[index + 1:index + 1 + length])
+            if len(value) != length:
+                return None
+            arguments.append((kind, value.decode("utf-8", errors="replace")))
+            index += 1 + length
+        elif kind in TYPES:
+            fmt = endian + TYPES[kind]
+            if index + struct.calcsize(fmt) > len(data):
+                return None
+            arguments.append((kind, struct.unpack_from(fmt, data, index)[0]))
+            index += struct.calcsize(fmt)
+        else:
+            return None
+    return arguments
+
+
+def format_message(fmt, arguments):
+    """Mirrors the formatting of modm::log::DeferredLogger::process()."""
+    arguments = iter(arguments)
+
+    def replace(match):
+        flags, conversion = match.group(1), match.group(2)
+        if conversion == "%":
+            return "%"
+        try:
+            kind, value = next(arguments)
+        except StopIteration:
+            return "?"
+        if (kind == STRING) != (conversion == "s"):
+            return "?"
+        if conversion == "s":
+            return ("%" + flags + "s") % value
+        if conversion in "fFeEgG":
+            return ("%" + flags + conversion) % float(value)
+        if kind in FLOATS or conversion not in "diuoxXcp":
+            return "?"
+        bits = 64 if kind in WIDE else 32
+        unsigned = value & ((1 << bits) - 1)
+        if conversion in "di":
+            signed = unsigned - (1 << bits) if unsigned >> (bits - 1) else unsigned
+            return ("%" + flags + "d") % signed
+        if conversion == "u":
+            return ("%" + flags + "d") % unsigned
+        if conversion == "c":
+            return ("%" + flags + "c") % chr(unsigned & 0xff)
+        if conversion == "p":
+            return "0x%x" % unsigned
+        return ("%" + flags + conversion) % unsigned
+
+    return SPECIFICATION.sub(replace, fmt)
+
+
+def decode(stream, strings):
+    """Yields the records of the stream as text lines."""
+    header = struct.Struct(strings.endian + ("Q" if strings.pointer_size == 8 else "I") + "IBBH")
+    data = bytearray()
+    while True:
+        # do not wait for a full block from a serial port
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        data += chunk
+        while True:
+            start = data.find(SYNC)
+            if start < 0:
+                data.clear()
+                break
+            del data[:start]
+            if len(data) < 1 + header.size:
+                break
+            address, timestamp, level, length, dropped = header.unpack_from(data, 1)
+            fmt = strings.get(address)
+            if fmt is None or length > ARGUMENT_SIZE or level >= len(LEVELS):
+                del data[:1]
+                continue
+            end = 1 + header.size + length
+            if len(data) < end:
+                break
+            arguments = parse_arguments(data[1 + header.size:end], strings.endian)
+            if arguments is None:
+                del data[:1]
+                continue
+            del data[:end]
+
+            if dropped:
+                yield "[{:10d}] {}{} log records dropped".format(timestamp, LEVELS[2], dropped)
+            yield "[{:10d}] {}{}".format(timestamp, LEVELS[level], format_message(fmt, arguments))
+
+
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser(description="Decode binary deferred log records.")
+    parser.add_argument(
+            dest="elf",
+            metavar="ELF",
+            help="The firmware containing the format strings.")
+    parser.add_argument(
+            dest="source",
+            nargs="?",
+            default="-",
+            help="File or serial port with the records, default stdin.")
+
+    args = parser.parse_args()
+    strings = FormatStrings(args.elf)
+    if args.source == "-":
+        stream = sys.stdin.buffer
+    else:
+        stream = open(args.source, "rb", buffering=0)
+    try:
+        for line in decode(stream, strings):
+            print(line, flush=True)
+    except KeyboardInterrupt:
+        pass